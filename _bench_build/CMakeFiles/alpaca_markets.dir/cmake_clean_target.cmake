@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libalpaca_markets.a"
+)
@@ -0,0 +1,54 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/models/account.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/account.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/account.cpp.o.d"
+  "/root/repo/src/models/announcement.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/announcement.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/announcement.cpp.o.d"
+  "/root/repo/src/models/asset.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/asset.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/asset.cpp.o.d"
+  "/root/repo/src/models/asset_universe.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/asset_universe.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/asset_universe.cpp.o.d"
+  "/root/repo/src/models/auction.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/auction.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/auction.cpp.o.d"
+  "/root/repo/src/models/bars.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/bars.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/bars.cpp.o.d"
+  "/root/repo/src/models/bulk_job.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/bulk_job.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/bulk_job.cpp.o.d"
+  "/root/repo/src/models/calendar.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/calendar.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/calendar.cpp.o.d"
+  "/root/repo/src/models/client_order_id.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/client_order_id.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/client_order_id.cpp.o.d"
+  "/root/repo/src/models/clock.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/clock.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/clock.cpp.o.d"
+  "/root/repo/src/models/columns.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/columns.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/columns.cpp.o.d"
+  "/root/repo/src/models/compact_order.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/compact_order.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/compact_order.cpp.o.d"
+  "/root/repo/src/models/corporate_action.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/corporate_action.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/corporate_action.cpp.o.d"
+  "/root/repo/src/models/crypto.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/crypto.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/crypto.cpp.o.d"
+  "/root/repo/src/models/decimal.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/decimal.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/decimal.cpp.o.d"
+  "/root/repo/src/models/history.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/history.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/history.cpp.o.d"
+  "/root/repo/src/models/multi_quote.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/multi_quote.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/multi_quote.cpp.o.d"
+  "/root/repo/src/models/multi_trade.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/multi_trade.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/multi_trade.cpp.o.d"
+  "/root/repo/src/models/news.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/news.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/news.cpp.o.d"
+  "/root/repo/src/models/option.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/option.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/option.cpp.o.d"
+  "/root/repo/src/models/order.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/order.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/order.cpp.o.d"
+  "/root/repo/src/models/order_cache.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/order_cache.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/order_cache.cpp.o.d"
+  "/root/repo/src/models/order_request.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/order_request.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/order_request.cpp.o.d"
+  "/root/repo/src/models/portfolio.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/portfolio.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/portfolio.cpp.o.d"
+  "/root/repo/src/models/position.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/position.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/position.cpp.o.d"
+  "/root/repo/src/models/position_ledger.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/position_ledger.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/position_ledger.cpp.o.d"
+  "/root/repo/src/models/quote.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/quote.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/quote.cpp.o.d"
+  "/root/repo/src/models/response_cache.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/response_cache.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/response_cache.cpp.o.d"
+  "/root/repo/src/models/risk_checks.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/risk_checks.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/risk_checks.cpp.o.d"
+  "/root/repo/src/models/simdjson_decode.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/simdjson_decode.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/simdjson_decode.cpp.o.d"
+  "/root/repo/src/models/snapshot.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/snapshot.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/snapshot.cpp.o.d"
+  "/root/repo/src/models/status.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/status.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/status.cpp.o.d"
+  "/root/repo/src/models/symbol.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/symbol.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/symbol.cpp.o.d"
+  "/root/repo/src/models/trade.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/trade.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/trade.cpp.o.d"
+  "/root/repo/src/models/trade_update.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/trade_update.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/trade_update.cpp.o.d"
+  "/root/repo/src/models/watchlist.cpp" "CMakeFiles/alpaca_markets_models.dir/src/models/watchlist.cpp.o" "gcc" "CMakeFiles/alpaca_markets_models.dir/src/models/watchlist.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
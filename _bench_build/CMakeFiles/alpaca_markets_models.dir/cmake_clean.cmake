@@ -0,0 +1,79 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alpaca_markets_models.dir/src/models/account.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/account.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/announcement.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/announcement.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/asset.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/asset.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/asset_universe.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/asset_universe.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/auction.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/auction.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/bars.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/bars.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/bulk_job.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/bulk_job.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/calendar.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/calendar.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/client_order_id.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/client_order_id.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/clock.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/clock.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/columns.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/columns.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/compact_order.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/compact_order.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/corporate_action.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/corporate_action.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/crypto.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/crypto.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/decimal.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/decimal.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/history.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/history.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/multi_quote.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/multi_quote.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/multi_trade.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/multi_trade.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/news.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/news.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/option.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/option.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order_cache.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order_cache.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order_request.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/order_request.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/portfolio.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/portfolio.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/position.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/position.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/position_ledger.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/position_ledger.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/quote.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/quote.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/response_cache.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/response_cache.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/risk_checks.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/risk_checks.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/simdjson_decode.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/simdjson_decode.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/snapshot.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/snapshot.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/status.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/status.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/symbol.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/symbol.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/trade.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/trade.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/trade_update.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/trade_update.cpp.o.d"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/watchlist.cpp.o"
+  "CMakeFiles/alpaca_markets_models.dir/src/models/watchlist.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alpaca_markets_models.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rest/client.cpp" "CMakeFiles/alpaca_markets_rest.dir/src/rest/client.cpp.o" "gcc" "CMakeFiles/alpaca_markets_rest.dir/src/rest/client.cpp.o.d"
+  "/root/repo/src/rest/config.cpp" "CMakeFiles/alpaca_markets_rest.dir/src/rest/config.cpp.o" "gcc" "CMakeFiles/alpaca_markets_rest.dir/src/rest/config.cpp.o.d"
+  "/root/repo/src/rest/order_gateway.cpp" "CMakeFiles/alpaca_markets_rest.dir/src/rest/order_gateway.cpp.o" "gcc" "CMakeFiles/alpaca_markets_rest.dir/src/rest/order_gateway.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
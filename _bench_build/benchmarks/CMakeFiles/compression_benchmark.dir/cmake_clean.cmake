@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compression_benchmark.dir/compression_benchmark.cpp.o"
+  "CMakeFiles/compression_benchmark.dir/compression_benchmark.cpp.o.d"
+  "compression_benchmark"
+  "compression_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compression_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
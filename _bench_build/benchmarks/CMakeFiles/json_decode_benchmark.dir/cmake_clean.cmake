@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_decode_benchmark.dir/json_decode_benchmark.cpp.o"
+  "CMakeFiles/json_decode_benchmark.dir/json_decode_benchmark.cpp.o.d"
+  "json_decode_benchmark"
+  "json_decode_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_decode_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
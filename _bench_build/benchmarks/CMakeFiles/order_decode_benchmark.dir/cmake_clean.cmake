@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order_decode_benchmark.dir/order_decode_benchmark.cpp.o"
+  "CMakeFiles/order_decode_benchmark.dir/order_decode_benchmark.cpp.o.d"
+  "order_decode_benchmark"
+  "order_decode_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order_decode_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order_gateway_benchmark.dir/order_gateway_benchmark.cpp.o"
+  "CMakeFiles/order_gateway_benchmark.dir/order_gateway_benchmark.cpp.o.d"
+  "order_gateway_benchmark"
+  "order_gateway_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order_gateway_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/check_market_status.dir/check_market_status.cpp.o"
+  "CMakeFiles/check_market_status.dir/check_market_status.cpp.o.d"
+  "check_market_status"
+  "check_market_status.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/check_market_status.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
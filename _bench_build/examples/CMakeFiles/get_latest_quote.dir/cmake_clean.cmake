@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/get_latest_quote.dir/get_latest_quote.cpp.o"
+  "CMakeFiles/get_latest_quote.dir/get_latest_quote.cpp.o.d"
+  "get_latest_quote"
+  "get_latest_quote.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/get_latest_quote.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/view_account_info.dir/view_account_info.cpp.o"
+  "CMakeFiles/view_account_info.dir/view_account_info.cpp.o.d"
+  "view_account_info"
+  "view_account_info.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/view_account_info.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
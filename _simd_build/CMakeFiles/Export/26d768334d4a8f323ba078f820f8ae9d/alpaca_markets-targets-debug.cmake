@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "alpaca::markets" for configuration "Debug"
+set_property(TARGET alpaca::markets APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(alpaca::markets PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libalpaca_markets.a"
+  )
+
+list(APPEND _cmake_import_check_targets alpaca::markets )
+list(APPEND _cmake_import_check_files_for_alpaca::markets "${_IMPORT_PREFIX}/lib/libalpaca_markets.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "libalpaca_markets.a"
+  "libalpaca_markets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alpaca_markets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/client.cpp.o"
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/client.cpp.o.d"
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/config.cpp.o"
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/config.cpp.o.d"
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/order_gateway.cpp.o"
+  "CMakeFiles/alpaca_markets_rest.dir/src/rest/order_gateway.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alpaca_markets_rest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alpaca_markets_stream.dir/src/stream/streaming.cpp.o"
+  "CMakeFiles/alpaca_markets_stream.dir/src/stream/streaming.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alpaca_markets_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,58 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/account_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/account_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/account_test.cpp.o.d"
+  "/root/repo/tests/announcement_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/announcement_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/announcement_test.cpp.o.d"
+  "/root/repo/tests/asset_universe_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/asset_universe_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/asset_universe_test.cpp.o.d"
+  "/root/repo/tests/auction_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/auction_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/auction_test.cpp.o.d"
+  "/root/repo/tests/bars_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/bars_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/bars_test.cpp.o.d"
+  "/root/repo/tests/bulk_job_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/bulk_job_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/bulk_job_test.cpp.o.d"
+  "/root/repo/tests/chunks_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/chunks_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/chunks_test.cpp.o.d"
+  "/root/repo/tests/client_order_id_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/client_order_id_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/client_order_id_test.cpp.o.d"
+  "/root/repo/tests/client_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/client_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/client_test.cpp.o.d"
+  "/root/repo/tests/compact_order_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/compact_order_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/compact_order_test.cpp.o.d"
+  "/root/repo/tests/config_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/config_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/config_test.cpp.o.d"
+  "/root/repo/tests/corporate_action_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/corporate_action_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/corporate_action_test.cpp.o.d"
+  "/root/repo/tests/crypto_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/crypto_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/crypto_test.cpp.o.d"
+  "/root/repo/tests/fields_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/fields_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/fields_test.cpp.o.d"
+  "/root/repo/tests/history_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/history_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/history_test.cpp.o.d"
+  "/root/repo/tests/multi_data_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/multi_data_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/multi_data_test.cpp.o.d"
+  "/root/repo/tests/news_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/news_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/news_test.cpp.o.d"
+  "/root/repo/tests/option_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/option_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/option_test.cpp.o.d"
+  "/root/repo/tests/order_batch_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/order_batch_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/order_batch_test.cpp.o.d"
+  "/root/repo/tests/order_cache_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/order_cache_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/order_cache_test.cpp.o.d"
+  "/root/repo/tests/order_gateway_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/order_gateway_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/order_gateway_test.cpp.o.d"
+  "/root/repo/tests/order_request_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/order_request_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/order_request_test.cpp.o.d"
+  "/root/repo/tests/order_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/order_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/order_test.cpp.o.d"
+  "/root/repo/tests/pagination_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/pagination_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/pagination_test.cpp.o.d"
+  "/root/repo/tests/position_ledger_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/position_ledger_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/position_ledger_test.cpp.o.d"
+  "/root/repo/tests/quote_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/quote_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/quote_test.cpp.o.d"
+  "/root/repo/tests/rate_limiter_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/rate_limiter_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/rate_limiter_test.cpp.o.d"
+  "/root/repo/tests/response_cache_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/response_cache_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/response_cache_test.cpp.o.d"
+  "/root/repo/tests/risk_checks_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/risk_checks_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/risk_checks_test.cpp.o.d"
+  "/root/repo/tests/simdjson_decode_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/simdjson_decode_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/simdjson_decode_test.cpp.o.d"
+  "/root/repo/tests/single_flight_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/single_flight_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/single_flight_test.cpp.o.d"
+  "/root/repo/tests/snapshot_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/snapshot_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/snapshot_test.cpp.o.d"
+  "/root/repo/tests/status_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/status_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/status_test.cpp.o.d"
+  "/root/repo/tests/streaming_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/streaming_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/streaming_test.cpp.o.d"
+  "/root/repo/tests/symbol_map_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/symbol_map_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/symbol_map_test.cpp.o.d"
+  "/root/repo/tests/symbol_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/symbol_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/symbol_test.cpp.o.d"
+  "/root/repo/tests/trade_test.cpp" "tests/CMakeFiles/alpaca_markets_tests.dir/trade_test.cpp.o" "gcc" "tests/CMakeFiles/alpaca_markets_tests.dir/trade_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_simd_build/CMakeFiles/alpaca_markets.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "/root/repo/_simd_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,84 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/alpaca_markets_tests.dir/account_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/account_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/announcement_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/announcement_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/asset_universe_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/asset_universe_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/auction_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/auction_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/bars_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/bars_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/bulk_job_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/bulk_job_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/chunks_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/chunks_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/client_order_id_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/client_order_id_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/client_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/client_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/compact_order_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/compact_order_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/config_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/config_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/corporate_action_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/corporate_action_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/crypto_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/crypto_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/fields_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/fields_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/history_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/history_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/multi_data_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/multi_data_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/news_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/news_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/option_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/option_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/order_batch_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/order_batch_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/order_cache_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/order_cache_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/order_gateway_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/order_gateway_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/order_request_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/order_request_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/order_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/order_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/pagination_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/pagination_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/position_ledger_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/position_ledger_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/quote_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/quote_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/rate_limiter_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/rate_limiter_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/response_cache_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/response_cache_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/risk_checks_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/risk_checks_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/simdjson_decode_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/simdjson_decode_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/single_flight_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/single_flight_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/snapshot_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/snapshot_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/status_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/status_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/streaming_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/streaming_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/symbol_map_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/symbol_map_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/symbol_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/symbol_test.cpp.o.d"
+  "CMakeFiles/alpaca_markets_tests.dir/trade_test.cpp.o"
+  "CMakeFiles/alpaca_markets_tests.dir/trade_test.cpp.o.d"
+  "alpaca_markets_tests"
+  "alpaca_markets_tests.pdb"
+  "alpaca_markets_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/alpaca_markets_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_simd_build/tests/alpaca_markets_tests[1]_tests.cmake")
+  include("/root/repo/_simd_build/tests/alpaca_markets_tests[1]_tests.cmake")
+else()
+  add_test(alpaca_markets_tests_NOT_BUILT alpaca_markets_tests_NOT_BUILT)
+endif()
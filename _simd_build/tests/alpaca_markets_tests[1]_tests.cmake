@@ -0,0 +1,531 @@
+add_test([=[AccountTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AccountTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AccountTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AccountTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AccountTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AccountTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AccountConfigurationsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AccountConfigurationsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AccountConfigurationsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TradeActivityTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TradeActivityTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TradeActivityTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NonTradeActivityTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=NonTradeActivityTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NonTradeActivityTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnnouncementTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AnnouncementTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnnouncementTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnnouncementTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AnnouncementTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnnouncementTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnnouncementTest.SplitAnnouncement]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AnnouncementTest.SplitAnnouncement]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnnouncementTest.SplitAnnouncement]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnnouncementTypeTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AnnouncementTypeTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnnouncementTypeTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AnnouncementDateTypeTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AnnouncementDateTypeTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AnnouncementDateTypeTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetMaskTest.SetTestAndCount]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetMaskTest.SetTestAndCount]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetMaskTest.SetTestAndCount]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetMaskTest.AllSetIgnoresPaddingBits]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetMaskTest.AllSetIgnoresPaddingBits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetMaskTest.AllSetIgnoresPaddingBits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetMaskTest.Combine]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetMaskTest.Combine]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetMaskTest.Combine]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.LookupBySymbol]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.LookupBySymbol]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.LookupBySymbol]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.SelectByFlags]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.SelectByFlags]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.SelectByFlags]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.RefreshKeepsIndices]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.RefreshKeepsIndices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.RefreshKeepsIndices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.DuplicateSymbolsInOneResult]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.DuplicateSymbolsInOneResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.DuplicateSymbolsInOneResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.Upsert]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.Upsert]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.Upsert]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AssetUniverseTest.LargeUniverse]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AssetUniverseTest.LargeUniverse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AssetUniverseTest.LargeUniverse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AuctionTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AuctionTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolAuctionsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolAuctionsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolAuctionsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[AuctionsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=AuctionsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AuctionsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BarTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BarTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BarTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BarTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BarTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BarTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BarsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BarsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BarsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BarsTest.FromJSONSkipsMistypedFields]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BarsTest.FromJSONSkipsMistypedFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BarsTest.FromJSONSkipsMistypedFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BarsTest.FromJSONRejectsMalformedInput]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BarsTest.FromJSONRejectsMalformedInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BarsTest.FromJSONRejectsMalformedInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.CheckpointRoundTrip]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.CheckpointRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.CheckpointRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.RunsToCompletionAndRetriesTransientErrors]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.RunsToCompletionAndRetriesTransientErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.RunsToCompletionAndRetriesTransientErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.ResumesFromCheckpointAfterFailure]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.ResumesFromCheckpointAfterFailure]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.ResumesFromCheckpointAfterFailure]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.TruncatesSinkAndDropsRedeliveredItems]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.TruncatesSinkAndDropsRedeliveredItems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.TruncatesSinkAndDropsRedeliveredItems]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.KeepsRowsTheSinkHeldBeforeTheJobStarted]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.KeepsRowsTheSinkHeldBeforeTheJobStarted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.KeepsRowsTheSinkHeldBeforeTheJobStarted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.DropsOverlapWhenTokenRewindsIntoDeliveredItems]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.DropsOverlapWhenTokenRewindsIntoDeliveredItems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.DropsOverlapWhenTokenRewindsIntoDeliveredItems]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.RejectsCheckpointForAnotherQuery]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.RejectsCheckpointForAnotherQuery]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.RejectsCheckpointForAnotherQuery]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BulkJobTest.ColumnsDiscardPageDeliveredAfterLastCheckpoint]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BulkJobTest.ColumnsDiscardPageDeliveredAfterLastCheckpoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BulkJobTest.ColumnsDiscardPageDeliveredAfterLastCheckpoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChunkSymbolsTest.DropsRepeatedSymbols]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ChunkSymbolsTest.DropsRepeatedSymbols]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChunkSymbolsTest.DropsRepeatedSymbols]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChunkSymbolsTest.ChunkLimitsAddUpToLimit]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ChunkSymbolsTest.ChunkLimitsAddUpToLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChunkSymbolsTest.ChunkLimitsAddUpToLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ChunkSymbolsTest.PageTokensRoundTrip]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ChunkSymbolsTest.PageTokensRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ChunkSymbolsTest.PageTokensRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FanOutPagesTest.SplitsLimitAndKeepsRepeatedSymbolsWhole]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=FanOutPagesTest.SplitsLimitAndKeepsRepeatedSymbolsWhole]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FanOutPagesTest.SplitsLimitAndKeepsRepeatedSymbolsWhole]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FanOutPagesTest.ReportsExceptionsAsErrors]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=FanOutPagesTest.ReportsExceptionsAsErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FanOutPagesTest.ReportsExceptionsAsErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RunWorkersTest.ReturnsFirstException]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RunWorkersTest.ReturnsFirstException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RunWorkersTest.ReturnsFirstException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.FixedWidthFormat]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.FixedWidthFormat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.FixedWidthFormat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.RandomPrefixPerGenerator]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.RandomPrefixPerGenerator]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.RandomPrefixPerGenerator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.PrefixIsSanitized]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.PrefixIsSanitized]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.PrefixIsSanitized]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.UniqueAcrossThreads]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.UniqueAcrossThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.UniqueAcrossThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.RenderWithGeneratedId]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.RenderWithGeneratedId]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.RenderWithGeneratedId]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ClientOrderIdTest.GenerationIsOnByDefault]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ClientOrderIdTest.GenerationIsOnByDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ClientOrderIdTest.GenerationIsOnByDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EnvironmentOriginTest.KeepsSchemeAndPort]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=EnvironmentOriginTest.KeepsSchemeAndPort]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EnvironmentOriginTest.KeepsSchemeAndPort]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.WatchlistMutationsInvalidateCachedList]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.WatchlistMutationsInvalidateCachedList]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.WatchlistMutationsInvalidateCachedList]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.CoalescedCacheRevalidatesWithETag]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.CoalescedCacheRevalidatesWithETag]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.CoalescedCacheRevalidatesWithETag]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.TradingRequestsSendConfiguredAcceptEncoding]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.TradingRequestsSendConfiguredAcceptEncoding]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.TradingRequestsSendConfiguredAcceptEncoding]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.MultiSymbolLatestAndSnapshotsDecode]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.MultiSymbolLatestAndSnapshotsDecode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.MultiSymbolLatestAndSnapshotsDecode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.DownloadTradesKeepsOneConnectionPerWorker]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.DownloadTradesKeepsOneConnectionPerWorker]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.DownloadTradesKeepsOneConnectionPerWorker]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LocalServerTest.CancelAllFallbackPagesOpenOrdersAndKeepsStatuses]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LocalServerTest.CancelAllFallbackPagesOpenOrdersAndKeepsStatuses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LocalServerTest.CancelAllFallbackPagesOpenOrdersAndKeepsStatuses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.AmbiguousFailureFoundByLookup]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.AmbiguousFailureFoundByLookup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.AmbiguousFailureFoundByLookup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.AmbiguousFailureFoundInOrderCache]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.AmbiguousFailureFoundInOrderCache]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.AmbiguousFailureFoundInOrderCache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.ResendsWhenLookupFindsNothing]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.ResendsWhenLookupFindsNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.ResendsWhenLookupFindsNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.DuplicateRejectionOfResendMeansAccepted]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.DuplicateRejectionOfResendMeansAccepted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.DuplicateRejectionOfResendMeansAccepted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.ReturnsClientOrderIdWhenBudgetRunsOut]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.ReturnsClientOrderIdWhenBudgetRunsOut]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.ReturnsClientOrderIdWhenBudgetRunsOut]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitTest.ReturnsClientOrderIdWhenResendsRunOut]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitTest.ReturnsClientOrderIdWhenResendsRunOut]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitTest.ReturnsClientOrderIdWhenResendsRunOut]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrderTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrderTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrderTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrderTest.InPlaceMatchesCopy]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrderTest.InPlaceMatchesCopy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrderTest.InPlaceMatchesCopy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrderTest.FlatValue]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrderTest.FlatValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrderTest.FlatValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrderTest.RejectsBadValues]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrderTest.RejectsBadValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrderTest.RejectsBadValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrdersTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrdersTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrdersTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrdersTest.SkipsUnknownAndNestedValues]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrdersTest.SkipsUnknownAndNestedValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrdersTest.SkipsUnknownAndNestedValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrdersTest.UnescapesStrings]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrdersTest.UnescapesStrings]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrdersTest.UnescapesStrings]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CompactOrdersTest.RejectsMalformedJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CompactOrdersTest.RejectsMalformedJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CompactOrdersTest.RejectsMalformedJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimestampTest.ParseTimestampNanos]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TimestampTest.ParseTimestampNanos]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimestampTest.ParseTimestampNanos]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatusTest.StringConversions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderStatusTest.StringConversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatusTest.StringConversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderStatusTest.UnrecognizedValuesAreUnknown]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderStatusTest.UnrecognizedValuesAreUnknown]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderStatusTest.UnrecognizedValuesAreUnknown]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetryConfigTest.DefaultConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RetryConfigTest.DefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetryConfigTest.DefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetryConfigTest.ShouldRetry]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RetryConfigTest.ShouldRetry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetryConfigTest.ShouldRetry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetryConfigTest.GetDelay]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RetryConfigTest.GetDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetryConfigTest.GetDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetryConfigTest.GetDelayMaxCapped]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RetryConfigTest.GetDelayMaxCapped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetryConfigTest.GetDelayMaxCapped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RetryConfigTest.NoRetries]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RetryConfigTest.NoRetries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RetryConfigTest.NoRetries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeoutConfigTest.DefaultConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TimeoutConfigTest.DefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeoutConfigTest.DefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TimeoutConfigTest.LongTimeouts]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TimeoutConfigTest.LongTimeouts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TimeoutConfigTest.LongTimeouts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EnvironmentConfigTest.RetryConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=EnvironmentConfigTest.RetryConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EnvironmentConfigTest.RetryConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EnvironmentConfigTest.TimeoutConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=EnvironmentConfigTest.TimeoutConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EnvironmentConfigTest.TimeoutConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EnvironmentConfigTest.SymbolChunkConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=EnvironmentConfigTest.SymbolChunkConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EnvironmentConfigTest.SymbolChunkConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolChunkConfigTest.DefaultConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolChunkConfigTest.DefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolChunkConfigTest.DefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BatchConfigTest.DefaultConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=BatchConfigTest.DefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BatchConfigTest.DefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSubmitConfigTest.DefaultConfig]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSubmitConfigTest.DefaultConfig]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSubmitConfigTest.DefaultConfig]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorporateActionTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CorporateActionTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorporateActionTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorporateActionTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CorporateActionTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorporateActionTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorporateActionTest.CashDividend]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CorporateActionTest.CashDividend]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorporateActionTest.CashDividend]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorporateActionTest.NameChange]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CorporateActionTest.NameChange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorporateActionTest.NameChange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CorporateActionsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CorporateActionsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CorporateActionsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoTradeTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoTradeTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoTradeTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoTradeTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoTradeTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoTradeTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoQuoteTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoQuoteTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoQuoteTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoBarTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoBarTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoBarTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoSnapshotTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoSnapshotTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoSnapshotTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoTradesTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoTradesTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoTradesTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoBarsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoBarsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoBarsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoFeedTest.Conversions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=CryptoFeedTest.Conversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoFeedTest.Conversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FieldTableTest.FindsEveryFieldAndRejectsUnknownKeys]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=FieldTableTest.FindsEveryFieldAndRejectsUnknownKeys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FieldTableTest.FindsEveryFieldAndRejectsUnknownKeys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FieldTableTest.AccountConfigurationsRoundTrip]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=FieldTableTest.AccountConfigurationsRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FieldTableTest.AccountConfigurationsRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FieldTableTest.DecodesNestedObjects]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=FieldTableTest.DecodesNestedObjects]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FieldTableTest.DecodesNestedObjects]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.SplitTimeRangeEvenly]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.SplitTimeRangeEvenly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.SplitTimeRangeEvenly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.SplitTimeRangeHandlesOffsetsAndShortRanges]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.SplitTimeRangeHandlesOffsetsAndShortRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.SplitTimeRangeHandlesOffsetsAndShortRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.SplitTimeRangeByDay]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.SplitTimeRangeByDay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.SplitTimeRangeByDay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.SplitTimeRangeRejectsBadInput]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.SplitTimeRangeRejectsBadInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.SplitTimeRangeRejectsBadInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.DownloadRangesMergesInRangeOrder]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.DownloadRangesMergesInRangeOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.DownloadRangesMergesInRangeOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.DownloadRangesReportsFirstError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.DownloadRangesReportsFirstError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.DownloadRangesReportsFirstError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[HistoryTest.DownloadRangesReportsExceptions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=HistoryTest.DownloadRangesReportsExceptions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[HistoryTest.DownloadRangesReportsExceptions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiTradesTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiTradesTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiTradesTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiTradesTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiTradesTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiTradesTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiTradesTest.EmptyTrades]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiTradesTest.EmptyTrades]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiTradesTest.EmptyTrades]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiQuotesTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiQuotesTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiQuotesTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiQuotesTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiQuotesTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiQuotesTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MultiQuotesTest.EmptyQuotes]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MultiQuotesTest.EmptyQuotes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MultiQuotesTest.EmptyQuotes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NewsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=NewsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NewsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NewsTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=NewsTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NewsTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NewsArticlesTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=NewsArticlesTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NewsArticlesTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[NewsArticlesTest.FromJSONInsitu]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=NewsArticlesTest.FromJSONInsitu]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[NewsArticlesTest.FromJSONInsitu]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionContractTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionContractTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionContractTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionContractTest.FromJSONPutOption]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionContractTest.FromJSONPutOption]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionContractTest.FromJSONPutOption]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionContractTest.FromJSONWithDeliverables]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionContractTest.FromJSONWithDeliverables]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionContractTest.FromJSONWithDeliverables]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionContractTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionContractTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionContractTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionContractsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionContractsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionContractsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionTypeTest.Conversions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionTypeTest.Conversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionTypeTest.Conversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionStyleTest.Conversions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionStyleTest.Conversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionStyleTest.Conversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OptionStatusTest.Conversions]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OptionStatusTest.Conversions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OptionStatusTest.Conversions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBatchTest.EmptyBatchSendsNothing]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderBatchTest.EmptyBatchSendsNothing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBatchTest.EmptyBatchSendsNothing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBatchTest.RejectionsKeepInputOrder]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderBatchTest.RejectionsKeepInputOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBatchTest.RejectionsKeepInputOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBatchTest.NotionalRequestsAreCheckedByValue]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderBatchTest.NotionalRequestsAreCheckedByValue]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBatchTest.NotionalRequestsAreCheckedByValue]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBatchTest.InvalidRequestsAreNotSent]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderBatchTest.InvalidRequestsAreNotSent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBatchTest.InvalidRequestsAreNotSent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBatchTest.LegacySubmitRejectsUnparseablePrices]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderBatchTest.LegacySubmitRejectsUnparseablePrices]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBatchTest.LegacySubmitRejectsUnparseablePrices]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TradeUpdateTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TradeUpdateTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TradeUpdateTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.ApplyTradeUpdateJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.ApplyTradeUpdateJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.ApplyTradeUpdateJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.TerminalStatuses]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.TerminalStatuses]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.TerminalStatuses]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.LookupByIdAndClientOrderId]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.LookupByIdAndClientOrderId]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.LookupByIdAndClientOrderId]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.StaleUpdatesAreIgnored]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.StaleUpdatesAreIgnored]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.StaleUpdatesAreIgnored]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.ComparesUpdatedAtAsInstants]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.ComparesUpdatedAtAsInstants]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.ComparesUpdatedAtAsInstants]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.RejectsOrdersWithoutId]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.RejectsOrdersWithoutId]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.RejectsOrdersWithoutId]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.ReconcileReportsVanishedOrders]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.ReconcileReportsVanishedOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.ReconcileReportsVanishedOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.SnapshotsAreImmutable]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.SnapshotsAreImmutable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.SnapshotsAreImmutable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.EvictsOldestClosedOrders]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.EvictsOldestClosedOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.EvictsOldestClosedOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCacheTest.ConcurrentReadersSeeConsistentOrders]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCacheTest.ConcurrentReadersSeeConsistentOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCacheTest.ConcurrentReadersSeeConsistentOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.PrefixHoldsFixedFields]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.PrefixHoldsFixedFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.PrefixHoldsFixedFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.RenderAppendsVariableFields]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.RenderAppendsVariableFields]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.RenderAppendsVariableFields]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.RenderReusesBuffer]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.RenderReusesBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.RenderReusesBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.RenderRejectsUnsafeInput]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.RenderRejectsUnsafeInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.RenderRejectsUnsafeInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.PricesAreSentInCanonicalForm]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.PricesAreSentInCanonicalForm]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.PricesAreSentInCanonicalForm]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTemplateTest.SymbolIsEscaped]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTemplateTest.SymbolIsEscaped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTemplateTest.SymbolIsEscaped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderGatewayTest.WarmUpReportsRejectedCredentials]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderGatewayTest.WarmUpReportsRejectedCredentials]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderGatewayTest.WarmUpReportsRejectedCredentials]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DecimalTest.ParseAndFormatRoundTrip]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=DecimalTest.ParseAndFormatRoundTrip]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DecimalTest.ParseAndFormatRoundTrip]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DecimalTest.ParseRejectsMalformedInput]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=DecimalTest.ParseRejectsMalformedInput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DecimalTest.ParseRejectsMalformedInput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DecimalTest.Comparison]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=DecimalTest.Comparison]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DecimalTest.Comparison]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.RenderLimitOrder]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.RenderLimitOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.RenderLimitOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.RenderNotionalAndTrailingStop]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.RenderNotionalAndTrailingStop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.RenderNotionalAndTrailingStop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.RenderBracket]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.RenderBracket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.RenderBracket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.RenderMultiLeg]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.RenderMultiLeg]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.RenderMultiLeg]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.RenderReusesBuffer]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.RenderReusesBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.RenderReusesBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.ValidateRejectsUnknownEnums]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.ValidateRejectsUnknownEnums]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.ValidateRejectsUnknownEnums]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderRequestTest.ValidateRejectsIncompleteOrders]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderRequestTest.ValidateRejectsIncompleteOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderRequestTest.ValidateRejectsIncompleteOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTest.FromJSONWithTrailingStop]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTest.FromJSONWithTrailingStop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTest.FromJSONWithTrailingStop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTest.FromJSONWithNotional]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTest.FromJSONWithNotional]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTest.FromJSONWithNotional]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderDirectionTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderDirectionTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderDirectionTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderSideTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderSideTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderSideTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTypeTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTypeTest.TrailingStopConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTypeTest.TrailingStopConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTypeTest.TrailingStopConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderTimeInForceTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderTimeInForceTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderTimeInForceTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderClassTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderClassTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderClassTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionIntentTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionIntentTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionIntentTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCancelResultsTest.MultiStatusFromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCancelResultsTest.MultiStatusFromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCancelResultsTest.MultiStatusFromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderCancelResultsTest.PlainOrderArray]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=OrderCancelResultsTest.PlainOrderArray]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderCancelResultsTest.PlainOrderArray]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.SequentialCollectAll]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.SequentialCollectAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.SequentialCollectAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.PrefetchCollectAllMatchesSequential]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.PrefetchCollectAllMatchesSequential]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.PrefetchCollectAllMatchesSequential]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.PrefetchFetchesAheadOfCaller]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.PrefetchFetchesAheadOfCaller]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.PrefetchFetchesAheadOfCaller]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.PrefetchErrorCanBeRetried]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.PrefetchErrorCanBeRetried]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.PrefetchErrorCanBeRetried]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.PrefetchRethrowsFetchException]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.PrefetchRethrowsFetchException]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.PrefetchRethrowsFetchException]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.DestroyWhilePrefetching]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.DestroyWhilePrefetching]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.DestroyWhilePrefetching]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.CopyResumesFromSamePosition]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.CopyResumesFromSamePosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.CopyResumesFromSamePosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.CollectAllMovesItems]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.CollectAllMovesItems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.CollectAllMovesItems]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.CollectIntoSink]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.CollectIntoSink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.CollectIntoSink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PageIteratorTest.CollectIntoColumns]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PageIteratorTest.CollectIntoColumns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PageIteratorTest.CollectIntoColumns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ItemRangeTest.RangeForVisitsEveryItemAcrossPages]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ItemRangeTest.RangeForVisitsEveryItemAcrossPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ItemRangeTest.RangeForVisitsEveryItemAcrossPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ItemRangeTest.ComposesWithViewsAndStopsEarly]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ItemRangeTest.ComposesWithViewsAndStopsEarly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ItemRangeTest.ComposesWithViewsAndStopsEarly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ItemRangeTest.SkipsEmptyPagesAndReportsErrors]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ItemRangeTest.SkipsEmptyPagesAndReportsErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ItemRangeTest.SkipsEmptyPagesAndReportsErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PaginationHelpersTest.BarsIteratorFlattensSymbols]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PaginationHelpersTest.BarsIteratorFlattensSymbols]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PaginationHelpersTest.BarsIteratorFlattensSymbols]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PaginationHelpersTest.NewsIteratorCollectsAllPages]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PaginationHelpersTest.NewsIteratorCollectsAllPages]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PaginationHelpersTest.NewsIteratorCollectsAllPages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.ReconcileParsesRESTResults]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.ReconcileParsesRESTResults]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.ReconcileParsesRESTResults]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.FillsAdjustAverageEntryAndCash]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.FillsAdjustAverageEntryAndCash]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.FillsAdjustAverageEntryAndCash]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.FillThroughZeroFlipsPosition]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.FillThroughZeroFlipsPosition]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.FillThroughZeroFlipsPosition]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.PositionQtyFromEventWins]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.PositionQtyFromEventWins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.PositionQtyFromEventWins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.IgnoresNonFillEventsAndRejectsBadFills]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.IgnoresNonFillEventsAndRejectsBadFills]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.IgnoresNonFillEventsAndRejectsBadFills]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.MarkToMarket]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.MarkToMarket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.MarkToMarket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.ReconcileKeepsRealizedPL]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.ReconcileKeepsRealizedPL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.ReconcileKeepsRealizedPL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.SnapshotsAreConsistent]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.SnapshotsAreConsistent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.SnapshotsAreConsistent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PositionLedgerTest.RejectsMalformedNumbers]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=PositionLedgerTest.RejectsMalformedNumbers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PositionLedgerTest.RejectsMalformedNumbers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuoteTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=QuoteTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuoteTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuoteTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=QuoteTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuoteTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatestQuoteTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LatestQuoteTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatestQuoteTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateLimiterTest.AllowsBurstThenWaitsForWindow]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RateLimiterTest.AllowsBurstThenWaitsForWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RateLimiterTest.AllowsBurstThenWaitsForWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RateLimiterTest.LimitsAcrossThreads]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RateLimiterTest.LimitsAcrossThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RateLimiterTest.LimitsAcrossThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.StoreAndLookup]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.StoreAndLookup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.StoreAndLookup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.LookupChecksType]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.LookupChecksType]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.LookupChecksType]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.ExpiredEntriesKeepETagForRevalidation]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.ExpiredEntriesKeepETagForRevalidation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.ExpiredEntriesKeepETagForRevalidation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.EvictsLeastRecentlyUsed]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.EvictsLeastRecentlyUsed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.EvictsLeastRecentlyUsed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.StoreReplacesExistingEntry]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.StoreReplacesExistingEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.StoreReplacesExistingEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.InvalidateByPrefix]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.InvalidateByPrefix]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.InvalidateByPrefix]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.ValuesOutliveEviction]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.ValuesOutliveEviction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.ValuesOutliveEviction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.ConcurrentAccess]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.ConcurrentAccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.ConcurrentAccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ResponseCacheTest.CacheConfigDefaults]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ResponseCacheTest.CacheConfigDefaults]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ResponseCacheTest.CacheConfigDefaults]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.EmptyPipelineAccepts]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.EmptyPipelineAccepts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.EmptyPipelineAccepts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.MaxNotionalUsesLimitThenQuote]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.MaxNotionalUsesLimitThenQuote]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.MaxNotionalUsesLimitThenQuote]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.MaxPositionCountsHeldShares]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.MaxPositionCountsHeldShares]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.MaxPositionCountsHeldShares]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.PriceBandAgainstQuote]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.PriceBandAgainstQuote]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.PriceBandAgainstQuote]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.PatternDayTrader]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.PatternDayTrader]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.PatternDayTrader]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.ShortableAndEasyToBorrow]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.ShortableAndEasyToBorrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.ShortableAndEasyToBorrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.BuyingPowerIgnoresClosingQuantity]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.BuyingPowerIgnoresClosingQuantity]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.BuyingPowerIgnoresClosingQuantity]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.BatchCountsEarlierOrders]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.BatchCountsEarlierOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.BatchCountsEarlierOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RiskChecksTest.FirstFailureWins]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=RiskChecksTest.FirstFailureWins]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RiskChecksTest.FirstFailureWins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdjsonDecodeTest.BarsMatchRapidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SimdjsonDecodeTest.BarsMatchRapidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdjsonDecodeTest.BarsMatchRapidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdjsonDecodeTest.MultiTradesMatchRapidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SimdjsonDecodeTest.MultiTradesMatchRapidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdjsonDecodeTest.MultiTradesMatchRapidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdjsonDecodeTest.MultiQuotesMatchRapidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SimdjsonDecodeTest.MultiQuotesMatchRapidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdjsonDecodeTest.MultiQuotesMatchRapidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdjsonDecodeTest.CryptoMatchRapidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SimdjsonDecodeTest.CryptoMatchRapidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdjsonDecodeTest.CryptoMatchRapidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdjsonDecodeTest.SnapshotsMatchRapidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SimdjsonDecodeTest.SnapshotsMatchRapidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdjsonDecodeTest.SnapshotsMatchRapidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SingleFlightTest.SequentialCallsEachRun]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SingleFlightTest.SequentialCallsEachRun]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SingleFlightTest.SequentialCallsEachRun]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SingleFlightTest.ConcurrentCallsShareOneResult]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SingleFlightTest.ConcurrentCallsShareOneResult]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SingleFlightTest.ConcurrentCallsShareOneResult]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SingleFlightTest.DistinctKeysDoNotShare]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SingleFlightTest.DistinctKeysDoNotShare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SingleFlightTest.DistinctKeysDoNotShare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SingleFlightTest.ExceptionsReachEveryWaiter]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SingleFlightTest.ExceptionsReachEveryWaiter]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SingleFlightTest.ExceptionsReachEveryWaiter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SingleFlightTest.CoalescingIsOptIn]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SingleFlightTest.CoalescingIsOptIn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SingleFlightTest.CoalescingIsOptIn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SnapshotTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.PartialData]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SnapshotTest.PartialData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.PartialData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SnapshotTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SnapshotsTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SnapshotsTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SnapshotsTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatusTest.DefaultConstructor]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=StatusTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatusTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatusTest.ErrorStatus]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=StatusTest.ErrorStatus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatusTest.ErrorStatus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatusTest.BoolConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=StatusTest.BoolConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatusTest.BoolConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatusTest.Equality]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=StatusTest.Equality]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatusTest.Equality]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StatusTest.ToString]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=StatusTest.ToString]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StatusTest.ToString]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ActionStatusTest.ToStringConversion]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ActionStatusTest.ToStringConversion]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ActionStatusTest.ToStringConversion]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[APIErrorTest.BasicError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=APIErrorTest.BasicError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[APIErrorTest.BasicError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[APIErrorTest.ErrorWithoutCode]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=APIErrorTest.ErrorWithoutCode]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[APIErrorTest.ErrorWithoutCode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[APIErrorTest.ToStatus]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=APIErrorTest.ToStatus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[APIErrorTest.ToStatus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MessageGeneratorTest.Authentication]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MessageGeneratorTest.Authentication]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MessageGeneratorTest.Authentication]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MessageGeneratorTest.Listen]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=MessageGeneratorTest.Listen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MessageGeneratorTest.Listen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.Authorization]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.Authorization]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.Authorization]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.Listening]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.Listening]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.Listening]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.TradeUpdates]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.TradeUpdates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.TradeUpdates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.AccountUpdates]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.AccountUpdates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.AccountUpdates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.InvalidJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.InvalidJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.InvalidJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseReplyTest.UnknownStream]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=ParseReplyTest.UnknownStream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseReplyTest.UnknownStream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolMapTest.SortsEntriesOnConstruction]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolMapTest.SortsEntriesOnConstruction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolMapTest.SortsEntriesOnConstruction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolMapTest.DuplicateSymbolsKeepLastEntry]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolMapTest.DuplicateSymbolsKeepLastEntry]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolMapTest.DuplicateSymbolsKeepLastEntry]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolMapTest.Lookup]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolMapTest.Lookup]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolMapTest.Lookup]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolMapTest.SubscriptInsertsInOrder]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolMapTest.SubscriptInsertsInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolMapTest.SubscriptInsertsInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolMapTest.ConvertsToStdMap]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolMapTest.ConvertsToStdMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolMapTest.ConvertsToStdMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.InternAssignsDenseIds]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.InternAssignsDenseIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.InternAssignsDenseIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.UnknownSymbolsAndIds]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.UnknownSymbolsAndIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.UnknownSymbolsAndIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.GlobalTable]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.GlobalTable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.GlobalTable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.ConcurrentInterning]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.ConcurrentInterning]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.ConcurrentInterning]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.IndexBySymbol]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.IndexBySymbol]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.IndexBySymbol]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SymbolTest.IndexBySymbolMap]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=SymbolTest.IndexBySymbolMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SymbolTest.IndexBySymbolMap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TradeTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TradeTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TradeTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TradeTest.FromJSONParseError]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TradeTest.FromJSONParseError]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TradeTest.FromJSONParseError]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TradeTest.FromJSONInsitu]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=TradeTest.FromJSONInsitu]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TradeTest.FromJSONInsitu]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatestTradeTest.FromJSON]=]  /root/repo/_simd_build/tests/alpaca_markets_tests [==[--gtest_filter=LatestTradeTest.FromJSON]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatestTradeTest.FromJSON]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_simd_build/tests SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  alpaca_markets_tests_TESTS AccountTest.FromJSON AccountTest.FromJSONParseError AccountConfigurationsTest.FromJSON TradeActivityTest.FromJSON NonTradeActivityTest.FromJSON AnnouncementTest.FromJSON AnnouncementTest.FromJSONParseError AnnouncementTest.SplitAnnouncement AnnouncementTypeTest.ToStringConversion AnnouncementDateTypeTest.ToStringConversion AssetMaskTest.SetTestAndCount AssetMaskTest.AllSetIgnoresPaddingBits AssetMaskTest.Combine AssetUniverseTest.LookupBySymbol AssetUniverseTest.SelectByFlags AssetUniverseTest.RefreshKeepsIndices AssetUniverseTest.DuplicateSymbolsInOneResult AssetUniverseTest.Upsert AssetUniverseTest.LargeUniverse AuctionTest.FromJSON AuctionTest.FromJSONParseError SymbolAuctionsTest.FromJSON AuctionsTest.FromJSON BarTest.FromJSON BarTest.FromJSONParseError BarsTest.FromJSON BarsTest.FromJSONSkipsMistypedFields BarsTest.FromJSONRejectsMalformedInput BulkJobTest.CheckpointRoundTrip BulkJobTest.RunsToCompletionAndRetriesTransientErrors BulkJobTest.ResumesFromCheckpointAfterFailure BulkJobTest.TruncatesSinkAndDropsRedeliveredItems BulkJobTest.KeepsRowsTheSinkHeldBeforeTheJobStarted BulkJobTest.DropsOverlapWhenTokenRewindsIntoDeliveredItems BulkJobTest.RejectsCheckpointForAnotherQuery BulkJobTest.ColumnsDiscardPageDeliveredAfterLastCheckpoint ChunkSymbolsTest.DropsRepeatedSymbols ChunkSymbolsTest.ChunkLimitsAddUpToLimit ChunkSymbolsTest.PageTokensRoundTrip FanOutPagesTest.SplitsLimitAndKeepsRepeatedSymbolsWhole FanOutPagesTest.ReportsExceptionsAsErrors RunWorkersTest.ReturnsFirstException ClientOrderIdTest.FixedWidthFormat ClientOrderIdTest.RandomPrefixPerGenerator ClientOrderIdTest.PrefixIsSanitized ClientOrderIdTest.UniqueAcrossThreads ClientOrderIdTest.RenderWithGeneratedId ClientOrderIdTest.GenerationIsOnByDefault EnvironmentOriginTest.KeepsSchemeAndPort LocalServerTest.WatchlistMutationsInvalidateCachedList LocalServerTest.CoalescedCacheRevalidatesWithETag LocalServerTest.TradingRequestsSendConfiguredAcceptEncoding LocalServerTest.MultiSymbolLatestAndSnapshotsDecode LocalServerTest.DownloadTradesKeepsOneConnectionPerWorker LocalServerTest.CancelAllFallbackPagesOpenOrdersAndKeepsStatuses OrderSubmitTest.AmbiguousFailureFoundByLookup OrderSubmitTest.AmbiguousFailureFoundInOrderCache OrderSubmitTest.ResendsWhenLookupFindsNothing OrderSubmitTest.DuplicateRejectionOfResendMeansAccepted OrderSubmitTest.ReturnsClientOrderIdWhenBudgetRunsOut OrderSubmitTest.ReturnsClientOrderIdWhenResendsRunOut CompactOrderTest.FromJSON CompactOrderTest.InPlaceMatchesCopy CompactOrderTest.FlatValue CompactOrderTest.RejectsBadValues CompactOrdersTest.FromJSON CompactOrdersTest.SkipsUnknownAndNestedValues CompactOrdersTest.UnescapesStrings CompactOrdersTest.RejectsMalformedJSON TimestampTest.ParseTimestampNanos OrderStatusTest.StringConversions OrderStatusTest.UnrecognizedValuesAreUnknown RetryConfigTest.DefaultConfig RetryConfigTest.ShouldRetry RetryConfigTest.GetDelay RetryConfigTest.GetDelayMaxCapped RetryConfigTest.NoRetries TimeoutConfigTest.DefaultConfig TimeoutConfigTest.LongTimeouts EnvironmentConfigTest.RetryConfig EnvironmentConfigTest.TimeoutConfig EnvironmentConfigTest.SymbolChunkConfig SymbolChunkConfigTest.DefaultConfig BatchConfigTest.DefaultConfig OrderSubmitConfigTest.DefaultConfig CorporateActionTest.FromJSON CorporateActionTest.FromJSONParseError CorporateActionTest.CashDividend CorporateActionTest.NameChange CorporateActionsTest.FromJSON CryptoTradeTest.FromJSON CryptoTradeTest.FromJSONParseError CryptoQuoteTest.FromJSON CryptoBarTest.FromJSON CryptoSnapshotTest.FromJSON CryptoTradesTest.FromJSON CryptoBarsTest.FromJSON CryptoFeedTest.Conversions FieldTableTest.FindsEveryFieldAndRejectsUnknownKeys FieldTableTest.AccountConfigurationsRoundTrip FieldTableTest.DecodesNestedObjects HistoryTest.SplitTimeRangeEvenly HistoryTest.SplitTimeRangeHandlesOffsetsAndShortRanges HistoryTest.SplitTimeRangeByDay HistoryTest.SplitTimeRangeRejectsBadInput HistoryTest.DownloadRangesMergesInRangeOrder HistoryTest.DownloadRangesReportsFirstError HistoryTest.DownloadRangesReportsExceptions MultiTradesTest.FromJSON MultiTradesTest.FromJSONParseError MultiTradesTest.EmptyTrades MultiQuotesTest.FromJSON MultiQuotesTest.FromJSONParseError MultiQuotesTest.EmptyQuotes NewsTest.FromJSON NewsTest.FromJSONParseError NewsArticlesTest.FromJSON NewsArticlesTest.FromJSONInsitu OptionContractTest.FromJSON OptionContractTest.FromJSONPutOption OptionContractTest.FromJSONWithDeliverables OptionContractTest.FromJSONParseError OptionContractsTest.FromJSON OptionTypeTest.Conversions OptionStyleTest.Conversions OptionStatusTest.Conversions OrderBatchTest.EmptyBatchSendsNothing OrderBatchTest.RejectionsKeepInputOrder OrderBatchTest.NotionalRequestsAreCheckedByValue OrderBatchTest.InvalidRequestsAreNotSent OrderBatchTest.LegacySubmitRejectsUnparseablePrices TradeUpdateTest.FromJSON OrderCacheTest.ApplyTradeUpdateJSON OrderCacheTest.TerminalStatuses OrderCacheTest.LookupByIdAndClientOrderId OrderCacheTest.StaleUpdatesAreIgnored OrderCacheTest.ComparesUpdatedAtAsInstants OrderCacheTest.RejectsOrdersWithoutId OrderCacheTest.ReconcileReportsVanishedOrders OrderCacheTest.SnapshotsAreImmutable OrderCacheTest.EvictsOldestClosedOrders OrderCacheTest.ConcurrentReadersSeeConsistentOrders OrderTemplateTest.PrefixHoldsFixedFields OrderTemplateTest.RenderAppendsVariableFields OrderTemplateTest.RenderReusesBuffer OrderTemplateTest.RenderRejectsUnsafeInput OrderTemplateTest.PricesAreSentInCanonicalForm OrderTemplateTest.SymbolIsEscaped OrderGatewayTest.WarmUpReportsRejectedCredentials DecimalTest.ParseAndFormatRoundTrip DecimalTest.ParseRejectsMalformedInput DecimalTest.Comparison OrderRequestTest.RenderLimitOrder OrderRequestTest.RenderNotionalAndTrailingStop OrderRequestTest.RenderBracket OrderRequestTest.RenderMultiLeg OrderRequestTest.RenderReusesBuffer OrderRequestTest.ValidateRejectsUnknownEnums OrderRequestTest.ValidateRejectsIncompleteOrders OrderTest.FromJSON OrderTest.FromJSONParseError OrderTest.FromJSONWithTrailingStop OrderTest.FromJSONWithNotional OrderDirectionTest.ToStringConversion OrderSideTest.ToStringConversion OrderTypeTest.ToStringConversion OrderTypeTest.TrailingStopConversion OrderTimeInForceTest.ToStringConversion OrderClassTest.ToStringConversion PositionIntentTest.ToStringConversion OrderCancelResultsTest.MultiStatusFromJSON OrderCancelResultsTest.PlainOrderArray PageIteratorTest.SequentialCollectAll PageIteratorTest.PrefetchCollectAllMatchesSequential PageIteratorTest.PrefetchFetchesAheadOfCaller PageIteratorTest.PrefetchErrorCanBeRetried PageIteratorTest.PrefetchRethrowsFetchException PageIteratorTest.DestroyWhilePrefetching PageIteratorTest.CopyResumesFromSamePosition PageIteratorTest.CollectAllMovesItems PageIteratorTest.CollectIntoSink PageIteratorTest.CollectIntoColumns ItemRangeTest.RangeForVisitsEveryItemAcrossPages ItemRangeTest.ComposesWithViewsAndStopsEarly ItemRangeTest.SkipsEmptyPagesAndReportsErrors PaginationHelpersTest.BarsIteratorFlattensSymbols PaginationHelpersTest.NewsIteratorCollectsAllPages PositionLedgerTest.ReconcileParsesRESTResults PositionLedgerTest.FillsAdjustAverageEntryAndCash PositionLedgerTest.FillThroughZeroFlipsPosition PositionLedgerTest.PositionQtyFromEventWins PositionLedgerTest.IgnoresNonFillEventsAndRejectsBadFills PositionLedgerTest.MarkToMarket PositionLedgerTest.ReconcileKeepsRealizedPL PositionLedgerTest.SnapshotsAreConsistent PositionLedgerTest.RejectsMalformedNumbers QuoteTest.FromJSON QuoteTest.FromJSONParseError LatestQuoteTest.FromJSON RateLimiterTest.AllowsBurstThenWaitsForWindow RateLimiterTest.LimitsAcrossThreads ResponseCacheTest.StoreAndLookup ResponseCacheTest.LookupChecksType ResponseCacheTest.ExpiredEntriesKeepETagForRevalidation ResponseCacheTest.EvictsLeastRecentlyUsed ResponseCacheTest.StoreReplacesExistingEntry ResponseCacheTest.InvalidateByPrefix ResponseCacheTest.ValuesOutliveEviction ResponseCacheTest.ConcurrentAccess ResponseCacheTest.CacheConfigDefaults RiskChecksTest.EmptyPipelineAccepts RiskChecksTest.MaxNotionalUsesLimitThenQuote RiskChecksTest.MaxPositionCountsHeldShares RiskChecksTest.PriceBandAgainstQuote RiskChecksTest.PatternDayTrader RiskChecksTest.ShortableAndEasyToBorrow RiskChecksTest.BuyingPowerIgnoresClosingQuantity RiskChecksTest.BatchCountsEarlierOrders RiskChecksTest.FirstFailureWins SimdjsonDecodeTest.BarsMatchRapidJSON SimdjsonDecodeTest.MultiTradesMatchRapidJSON SimdjsonDecodeTest.MultiQuotesMatchRapidJSON SimdjsonDecodeTest.CryptoMatchRapidJSON SimdjsonDecodeTest.SnapshotsMatchRapidJSON SingleFlightTest.SequentialCallsEachRun SingleFlightTest.ConcurrentCallsShareOneResult SingleFlightTest.DistinctKeysDoNotShare SingleFlightTest.ExceptionsReachEveryWaiter SingleFlightTest.CoalescingIsOptIn SnapshotTest.FromJSON SnapshotTest.PartialData SnapshotTest.FromJSONParseError SnapshotsTest.FromJSON StatusTest.DefaultConstructor StatusTest.ErrorStatus StatusTest.BoolConversion StatusTest.Equality StatusTest.ToString ActionStatusTest.ToStringConversion APIErrorTest.BasicError APIErrorTest.ErrorWithoutCode APIErrorTest.ToStatus MessageGeneratorTest.Authentication MessageGeneratorTest.Listen ParseReplyTest.Authorization ParseReplyTest.Listening ParseReplyTest.TradeUpdates ParseReplyTest.AccountUpdates ParseReplyTest.InvalidJSON ParseReplyTest.UnknownStream SymbolMapTest.SortsEntriesOnConstruction SymbolMapTest.DuplicateSymbolsKeepLastEntry SymbolMapTest.Lookup SymbolMapTest.SubscriptInsertsInOrder SymbolMapTest.ConvertsToStdMap SymbolTest.InternAssignsDenseIds SymbolTest.UnknownSymbolsAndIds SymbolTest.GlobalTable SymbolTest.ConcurrentInterning SymbolTest.IndexBySymbol SymbolTest.IndexBySymbolMap TradeTest.FromJSON TradeTest.FromJSONParseError TradeTest.FromJSONInsitu LatestTradeTest.FromJSON)
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Minimal timing helpers shared by the benchmarks. Each benchmark runs a
+// warm-up pass, then times a fixed number of iterations with steady_clock.
+namespace alpaca::markets::bench {
+
+/**
+ * @brief Run fn() warmup + iterations times and return seconds spent in the timed iterations.
+ */
+template <typename Fn>
+double timeIterations(std::size_t iterations, Fn&& fn, std::size_t warmup = 3) {
+    for (std::size_t i = 0; i < warmup; ++i) {
+        fn();
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Print one throughput row: name, per-iteration latency and GB/s over bytes_per_iteration.
+ */
+inline void reportThroughput(const std::string& name, std::size_t bytes_per_iteration, std::size_t iterations,
+                             double seconds) {
+    double per_iteration_us = seconds * 1e6 / static_cast<double>(iterations);
+    double gbps = static_cast<double>(bytes_per_iteration) * static_cast<double>(iterations) / seconds / 1e9;
+    std::printf("%-36s %10.1f us/iter %8.3f GB/s\n", name.c_str(), per_iteration_us, gbps);
+}
+
+/**
+ * @brief Print one latency row: name and nanoseconds per operation.
+ */
+inline void reportLatency(const std::string& name, std::size_t operations, double seconds) {
+    double ns = seconds * 1e9 / static_cast<double>(operations);
+    std::printf("%-36s %10.1f ns/op\n", name.c_str(), ns);
+}
+
+/**
+ * @brief Print one latency distribution row: name, mean, p50, p99 and max in microseconds.
+ */
+inline void reportPercentiles(const std::string& name, std::vector<double> samples_ns) {
+    if (samples_ns.empty()) {
+        return;
+    }
+    std::sort(samples_ns.begin(), samples_ns.end());
+    double sum = 0.0;
+    for (double sample : samples_ns) {
+        sum += sample;
+    }
+    auto at = [&](double q) {
+        return samples_ns[static_cast<std::size_t>(q * static_cast<double>(samples_ns.size() - 1))];
+    };
+    std::printf("%-36s mean %8.1f us  p50 %8.1f us  p99 %8.1f us  max %8.1f us\n", name.c_str(),
+                sum / static_cast<double>(samples_ns.size()) / 1e3, at(0.50) / 1e3, at(0.99) / 1e3,
+                samples_ns.back() / 1e3);
+}
+
+}  // namespace alpaca::markets::bench
@@ -0,0 +1,385 @@
+#include <alpaca/markets/markets.hpp>
+#include <httplib.h>
+#include <rapidjson/document.h>
+#include <zlib.h>
+
+#ifdef ALPACA_MARKETS_BENCH_BROTLI
+#include <brotli/decode.h>
+#include <brotli/encode.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+#include "detail/decode.hpp"
+
+using namespace alpaca::markets;
+
+// Response compression tradeoff: for bars pages of several sizes, measures
+// how much gzip (and brotli, when built with it) shrink the body and what
+// streaming decompression costs, then models the wall time of a request as
+// transfer + decompress + decode at a range of link bandwidths. With --fetch
+// it instead serves each encoding from a local server and times
+// Client::getBars() end to end.
+
+namespace {
+
+// httplib reads the socket in chunks of this size and feeds each to the decompressor
+constexpr std::size_t kChunkSize = 16 * 1024;
+
+std::string makeBarsJSON(int symbols, int bars_per_symbol) {
+    std::ostringstream ss;
+    ss << "{\"bars\":{";
+    for (int s = 0; s < symbols; ++s) {
+        ss << (s == 0 ? "" : ",") << "\"SYM" << s << "\":[";
+        for (int i = 0; i < bars_per_symbol; ++i) {
+            double base = 100.0 + s + i * 0.01;
+            ss << (i == 0 ? "" : ",") << "{\"t\":\"2024-01-02T" << 10 + (i / 60) % 10 << ":" << 10 + i % 50
+               << ":00Z\",\"o\":" << base << ",\"h\":" << base + 0.5 << ",\"l\":" << base - 0.5
+               << ",\"c\":" << base + 0.25 << ",\"v\":" << 1000 + i * 7 << ",\"n\":" << 10 + i % 90
+               << ",\"vw\":" << base + 0.1 << "}";
+        }
+        ss << "]";
+    }
+    ss << "},\"next_page_token\":null}";
+    return ss.str();
+}
+
+std::string zlibCompress(const std::string& data, int window_bits) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = reinterpret_cast<Bytef*>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+std::string gzipCompress(const std::string& data) {
+    // 15 + 16: gzip framing, as sent with Content-Encoding: gzip
+    return zlibCompress(data, 15 + 16);
+}
+
+std::string deflateCompress(const std::string& data) {
+    // Content-Encoding: deflate is the zlib format, not raw deflate
+    return zlibCompress(data, 15);
+}
+
+bool gzipDecompress(const std::string& compressed, std::string& out) {
+    z_stream stream{};
+    inflateInit2(&stream, 15 + 32);
+    char buffer[kChunkSize];
+    int ret = Z_OK;
+    for (std::size_t offset = 0; offset < compressed.size() && ret != Z_STREAM_END; offset += kChunkSize) {
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data() + offset));
+        stream.avail_in = static_cast<uInt>(std::min(kChunkSize, compressed.size() - offset));
+        do {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+            ret = inflate(&stream, Z_NO_FLUSH);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                inflateEnd(&stream);
+                return false;
+            }
+            out.append(buffer, sizeof(buffer) - stream.avail_out);
+        } while (stream.avail_out == 0);
+    }
+    inflateEnd(&stream);
+    return ret == Z_STREAM_END;
+}
+
+#ifdef ALPACA_MARKETS_BENCH_BROTLI
+std::string brotliCompress(const std::string& data) {
+    std::string out(BrotliEncoderMaxCompressedSize(data.size()), '\0');
+    std::size_t size = out.size();
+    // Quality 5 is a typical on-the-fly setting for dynamic responses
+    BrotliEncoderCompress(5, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT, data.size(),
+                          reinterpret_cast<const uint8_t*>(data.data()), &size, reinterpret_cast<uint8_t*>(out.data()));
+    out.resize(size);
+    return out;
+}
+
+bool brotliDecompress(const std::string& compressed, std::string& out) {
+    BrotliDecoderState* state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+    uint8_t buffer[kChunkSize];
+    BrotliDecoderResult result = BROTLI_DECODER_RESULT_NEEDS_MORE_INPUT;
+    for (std::size_t offset = 0; offset < compressed.size() && result != BROTLI_DECODER_RESULT_SUCCESS;
+         offset += kChunkSize) {
+        std::size_t avail_in = std::min(kChunkSize, compressed.size() - offset);
+        const auto* next_in = reinterpret_cast<const uint8_t*>(compressed.data() + offset);
+        do {
+            std::size_t avail_out = sizeof(buffer);
+            uint8_t* next_out = buffer;
+            result = BrotliDecoderDecompressStream(state, &avail_in, &next_in, &avail_out, &next_out, nullptr);
+            if (result == BROTLI_DECODER_RESULT_ERROR) {
+                BrotliDecoderDestroyInstance(state);
+                return false;
+            }
+            out.append(reinterpret_cast<char*>(buffer), sizeof(buffer) - avail_out);
+        } while (result == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT);
+    }
+    BrotliDecoderDestroyInstance(state);
+    return result == BROTLI_DECODER_RESULT_SUCCESS;
+}
+#endif
+
+struct Encoding {
+    std::string name;
+    std::string wire;
+    double decompress_seconds = 0.0;  // Per response
+};
+
+Encoding measure(const std::string& name, std::string wire, const std::string& expected,
+                 const std::function<bool(const std::string&, std::string&)>& decompress, std::size_t iterations) {
+    Encoding encoding{name, std::move(wire), 0.0};
+    if (!decompress) {
+        return encoding;
+    }
+    std::string check;
+    if (!decompress(encoding.wire, check) || check != expected) {
+        std::fprintf(stderr, "%s round trip failed\n", name.c_str());
+        std::exit(1);
+    }
+    double seconds = bench::timeIterations(iterations, [&] {
+        std::string out;
+        out.reserve(expected.size());
+        decompress(encoding.wire, out);
+    });
+    encoding.decompress_seconds = seconds / static_cast<double>(iterations);
+    return encoding;
+}
+
+double decodeSeconds(const std::string& json, std::size_t iterations) {
+    double seconds = bench::timeIterations(iterations, [&] {
+        std::string body = json;
+        rapidjson::Document d;
+        d.ParseInsitu(body.data());
+        Bars bars;
+        detail::decode(d, bars);
+    });
+    return seconds / static_cast<double>(iterations);
+}
+
+void runCase(int symbols, int bars_per_symbol, const std::vector<double>& bandwidths_mbps, std::size_t iterations) {
+    std::string json = makeBarsJSON(symbols, bars_per_symbol);
+    double decode = decodeSeconds(json, iterations);
+
+    std::vector<Encoding> encodings;
+    encodings.push_back(measure("identity", json, json, nullptr, iterations));
+    encodings.push_back(measure("gzip", gzipCompress(json), json, gzipDecompress, iterations));
+#ifdef ALPACA_MARKETS_BENCH_BROTLI
+    encodings.push_back(measure("br", brotliCompress(json), json, brotliDecompress, iterations));
+#endif
+
+    std::printf("\nBars %d symbols x %d bars: %.1f KB body, decode %.2f ms\n", symbols, bars_per_symbol,
+                static_cast<double>(json.size()) / 1e3, decode * 1e3);
+    std::printf("%-10s %12s %7s %14s", "encoding", "wire KB", "ratio", "decompress ms");
+    for (double mbps : bandwidths_mbps) {
+        std::printf(" %9.0f Mbit/s", mbps);
+    }
+    std::printf("\n");
+    for (const Encoding& encoding : encodings) {
+        std::printf("%-10s %12.1f %6.1fx %14.2f", encoding.name.c_str(),
+                    static_cast<double>(encoding.wire.size()) / 1e3,
+                    static_cast<double>(json.size()) / static_cast<double>(encoding.wire.size()),
+                    encoding.decompress_seconds * 1e3);
+        for (double mbps : bandwidths_mbps) {
+            double transfer = static_cast<double>(encoding.wire.size()) * 8.0 / (mbps * 1e6);
+            std::printf(" %13.2f ms", (transfer + encoding.decompress_seconds + decode) * 1e3);
+        }
+        std::printf("\n");
+    }
+}
+
+// An Environment whose market data API is the local server at base_url
+Environment makeStandInEnvironment(const std::string& base_url) {
+    // The ALPACA_MARKETS_* variables take precedence over custom names, so they must not leak in
+    for (const char* name : {"ALPACA_MARKETS_KEY_ID", "ALPACA_MARKETS_SECRET_KEY", "ALPACA_MARKETS_TRADING_URL",
+                             "ALPACA_MARKETS_DATA_URL"}) {
+        ::unsetenv(name);
+    }
+    ::setenv("ALPACA_BENCH_KEY_ID", "key", 1);
+    ::setenv("ALPACA_BENCH_SECRET_KEY", "secret", 1);
+    ::setenv("ALPACA_BENCH_TRADING_URL", base_url.c_str(), 1);
+    ::setenv("ALPACA_BENCH_DATA_URL", base_url.c_str(), 1);
+    Environment env("ALPACA_BENCH_KEY_ID", "ALPACA_BENCH_SECRET_KEY", "ALPACA_BENCH_TRADING_URL",
+                    "ALPACA_BENCH_DATA_URL");
+    if (Status status = env.parse(); !status.ok()) {
+        std::fprintf(stderr, "environment: %s\n", status.getMessage().c_str());
+        std::exit(1);
+    }
+    return env;
+}
+
+bool accepts(std::string_view accept_encoding, std::string_view encoding) {
+    for (std::size_t start = 0; start < accept_encoding.size();) {
+        std::size_t end = std::min(accept_encoding.find(',', start), accept_encoding.size());
+        std::string_view token = accept_encoding.substr(start, end - start);
+        token.remove_prefix(std::min(token.find_first_not_of(' '), token.size()));
+        if (token.substr(0, token.find_first_of(" ;")) == encoding) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+// Serves a bars page from the local server in one encoding at a time
+class BarsServer {
+public:
+    BarsServer() {
+        server_.Get("/v2/stocks/bars", [this](const httplib::Request& req, httplib::Response& res) {
+            const Encoding* encoding = serving_.load();
+            if (encoding->name != "identity" && accepts(req.get_header_value("Accept-Encoding"), encoding->name)) {
+                res.set_header("Content-Encoding", encoding->name);
+                res.set_content(encoding->wire, "application/json");
+                compressed_.store(true);
+            } else {
+                res.set_content(*identity_, "application/json");
+                compressed_.store(false);
+            }
+        });
+        port_ = server_.bind_to_any_port("127.0.0.1");
+        listener_ = std::thread([this] { server_.listen_after_bind(); });
+        server_.wait_until_ready();
+    }
+
+    ~BarsServer() {
+        server_.stop();
+        listener_.join();
+    }
+
+    BarsServer(const BarsServer&) = delete;
+    BarsServer& operator=(const BarsServer&) = delete;
+
+    [[nodiscard]] std::string baseUrl() const { return "http://127.0.0.1:" + std::to_string(port_); }
+
+    void serve(const std::string& identity, const Encoding& encoding) {
+        identity_ = &identity;
+        serving_.store(&encoding);
+    }
+
+    /// Whether the last response was sent in the encoding being served rather than as identity
+    [[nodiscard]] bool compressed() const { return compressed_.load(); }
+
+private:
+    httplib::Server server_;
+    std::thread listener_;
+    int port_ = 0;
+    const std::string* identity_ = nullptr;
+    std::atomic<const Encoding*> serving_{nullptr};
+    std::atomic<bool> compressed_{false};
+};
+
+void fetchCase(BarsServer& server, const Environment& env, int symbols, int bars_per_symbol,
+               std::size_t iterations) {
+    std::string json = makeBarsJSON(symbols, bars_per_symbol);
+    std::vector<Encoding> encodings = {
+        {"identity", json},
+        {"gzip", gzipCompress(json)},
+        {"deflate", deflateCompress(json)},
+    };
+#ifdef ALPACA_MARKETS_BENCH_BROTLI
+    encodings.push_back({"br", brotliCompress(json)});
+#endif
+    std::vector<std::string> symbol_names;
+    for (int s = 0; s < symbols; ++s) {
+        symbol_names.push_back("SYM" + std::to_string(s));
+    }
+
+    std::printf("\nBars %d symbols x %d bars: %.1f KB body\n", symbols, bars_per_symbol,
+                static_cast<double>(json.size()) / 1e3);
+    for (const Encoding& encoding : encodings) {
+        Environment encoding_env = env;
+        encoding_env.setCompressionConfig(encoding.name == "identity" ? CompressionConfig::disabled()
+                                                                      : CompressionConfig());
+        Client client(encoding_env);
+        server.serve(json, encoding);
+
+        auto fetch = [&] {
+            auto [status, bars] = client.getBars(symbol_names, "2024-01-02T00:00:00Z", "2024-01-03T00:00:00Z", "1Min",
+                                                 10000);
+            std::size_t decoded = 0;
+            for (const auto& [symbol, symbol_bars] : bars.bars) {
+                decoded += symbol_bars.size();
+            }
+            if (!status.ok() || decoded != static_cast<std::size_t>(symbols) * bars_per_symbol) {
+                std::fprintf(stderr, "%s fetch failed: %s\n", encoding.name.c_str(), status.getMessage().c_str());
+                std::exit(1);
+            }
+        };
+        fetch();
+        if (encoding.name != "identity" && !server.compressed()) {
+            std::printf("%-36s not requested by this build\n", encoding.name.c_str());
+            continue;
+        }
+
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            fetch();
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(elapsed.count());
+        }
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s (%.1f KB on the wire)", encoding.name.c_str(),
+                      static_cast<double>(encoding.wire.size()) / 1e3);
+        bench::reportPercentiles(name, std::move(samples));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    // Usage: compression_benchmark [iterations] [bandwidth Mbit/s ...]
+    //        compression_benchmark --fetch [iterations]
+    if (argc > 1 && std::string_view(argv[1]) == "--fetch") {
+        std::size_t iterations = argc > 2 ? static_cast<std::size_t>(std::strtoul(argv[2], nullptr, 10)) : 10;
+        if (iterations == 0) {
+            iterations = 1;
+        }
+        BarsServer server;
+        Environment env = makeStandInEnvironment(server.baseUrl());
+        std::printf("Measured Client::getBars() wall time against a local HTTP server (%zu fetches each)\n",
+                    iterations);
+        fetchCase(server, env, 1, 200, iterations);
+        fetchCase(server, env, 10, 1000, iterations);
+        fetchCase(server, env, 20, 10000, iterations);
+        return 0;
+    }
+
+    std::size_t iterations = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 10;
+    if (iterations == 0) {
+        iterations = 1;
+    }
+    std::vector<double> bandwidths_mbps;
+    for (int i = 2; i < argc; ++i) {
+        bandwidths_mbps.push_back(std::strtod(argv[i], nullptr));
+    }
+    if (bandwidths_mbps.empty()) {
+        bandwidths_mbps = {10, 100, 1000};
+    }
+
+    std::printf("Modeled wall time = transfer + decompress + decode (latency and TLS excluded)\n");
+    runCase(1, 200, bandwidths_mbps, iterations);
+    runCase(10, 1000, bandwidths_mbps, iterations);
+    runCase(20, 10000, bandwidths_mbps, iterations);
+    return 0;
+}
@@ -0,0 +1,208 @@
+#include <alpaca/markets/markets.hpp>
+#include <rapidjson/document.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "detail/decode.hpp"
+#include "detail/simdjson_decode.hpp"
+
+using namespace alpaca::markets;
+
+namespace {
+
+constexpr int kSymbols = 20;
+constexpr int kItemsPerSymbol = 5000;
+
+std::string symbolName(int i) {
+    return "SYM" + std::to_string(i);
+}
+
+std::string timestamp(int i) {
+    std::ostringstream ss;
+    ss << "2024-01-02T14:" << (10 + (i / 60) % 50) << ":" << (10 + i % 50) << ".123456789Z";
+    return ss.str();
+}
+
+template <typename WriteItem>
+std::string makePage(const char* name, WriteItem&& write_item) {
+    std::ostringstream ss;
+    ss << "{\"" << name << "\":{";
+    for (int s = 0; s < kSymbols; ++s) {
+        ss << (s == 0 ? "" : ",") << "\"" << symbolName(s) << "\":[";
+        for (int i = 0; i < kItemsPerSymbol; ++i) {
+            ss << (i == 0 ? "" : ",");
+            write_item(ss, s, i);
+        }
+        ss << "]";
+    }
+    ss << "},\"next_page_token\":\"U1lNMTl8MjAyNC0wMS0wMlQxNDo1OTo1OVo=\"}";
+    return ss.str();
+}
+
+std::string makeBarsJSON() {
+    return makePage("bars", [](std::ostringstream& ss, int s, int i) {
+        double base = 100.0 + s + i * 0.01;
+        ss << "{\"t\":\"" << timestamp(i) << "\",\"o\":" << base << ",\"h\":" << base + 0.5 << ",\"l\":" << base - 0.5
+           << ",\"c\":" << base + 0.25 << ",\"v\":" << 1000 + i << ",\"n\":" << 10 + i % 90 << ",\"vw\":" << base + 0.1
+           << "}";
+    });
+}
+
+std::string makeTradesJSON() {
+    return makePage("trades", [](std::ostringstream& ss, int s, int i) {
+        ss << "{\"t\":\"" << timestamp(i) << "\",\"x\":\"V\",\"p\":" << 100.0 + s + i * 0.01 << ",\"s\":" << 1 + i % 500
+           << ",\"c\":[\"@\",\"I\"],\"i\":" << 52983525029461LL + i << ",\"z\":\"C\"}";
+    });
+}
+
+std::string makeQuotesJSON() {
+    return makePage("quotes", [](std::ostringstream& ss, int s, int i) {
+        double bid = 100.0 + s + i * 0.01;
+        ss << "{\"t\":\"" << timestamp(i) << "\",\"ax\":\"Q\",\"ap\":" << bid + 0.02 << ",\"as\":" << 1 + i % 9
+           << ",\"bx\":\"P\",\"bp\":" << bid << ",\"bs\":" << 2 + i % 7 << ",\"c\":[\"R\"],\"z\":\"C\"}";
+    });
+}
+
+std::string makeCryptoBarsJSON() {
+    return makePage("bars", [](std::ostringstream& ss, int s, int i) {
+        double base = 42000.0 + s * 10 + i * 0.5;
+        ss << "{\"t\":\"" << timestamp(i) << "\",\"o\":" << base << ",\"h\":" << base + 5 << ",\"l\":" << base - 5
+           << ",\"c\":" << base + 2.5 << ",\"v\":" << 0.125 * (1 + i % 64) << ",\"n\":" << 1 + i % 40
+           << ",\"vw\":" << base + 1 << "}";
+    });
+}
+
+std::string makeSnapshotsJSON() {
+    std::ostringstream ss;
+    ss << "{\"snapshots\":{";
+    for (int s = 0; s < kSymbols * 100; ++s) {
+        double p = 100.0 + s * 0.01;
+        ss << (s == 0 ? "" : ",") << "\"" << symbolName(s) << "\":{"
+           << "\"latestTrade\":{\"t\":\"" << timestamp(s) << "\",\"x\":\"V\",\"p\":" << p
+           << ",\"s\":100,\"c\":[\"@\"],\"i\":" << s << ",\"z\":\"C\"},"
+           << "\"latestQuote\":{\"t\":\"" << timestamp(s) << "\",\"ax\":\"Q\",\"ap\":" << p + 0.01
+           << ",\"as\":2,\"bx\":\"P\",\"bp\":" << p - 0.01 << ",\"bs\":3,\"c\":[\"R\"]},"
+           << "\"minuteBar\":{\"t\":\"" << timestamp(s) << "\",\"o\":" << p << ",\"h\":" << p + 1 << ",\"l\":" << p - 1
+           << ",\"c\":" << p << ",\"v\":1000,\"n\":12,\"vw\":" << p << "},"
+           << "\"dailyBar\":{\"t\":\"" << timestamp(s) << "\",\"o\":" << p << ",\"h\":" << p + 2 << ",\"l\":" << p - 2
+           << ",\"c\":" << p << ",\"v\":100000,\"n\":1200,\"vw\":" << p << "},"
+           << "\"prevDailyBar\":{\"t\":\"" << timestamp(s) << "\",\"o\":" << p << ",\"h\":" << p + 2 << ",\"l\":" << p - 2
+           << ",\"c\":" << p << ",\"v\":90000,\"n\":1100,\"vw\":" << p << "}}";
+    }
+    ss << "}}";
+    return ss.str();
+}
+
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+// Order-insensitive digests used to check that both backends decode the same model state.
+double digest(const Bar& b) {
+    return b.open_price + b.high_price + b.low_price + b.close_price + b.vwap + static_cast<double>(b.volume) +
+           static_cast<double>(b.trade_count) + static_cast<double>(b.timestamp.size());
+}
+double digest(const CryptoBar& b) {
+    return b.open_price + b.high_price + b.low_price + b.close_price + b.vwap + b.volume +
+           static_cast<double>(b.trade_count) + static_cast<double>(b.timestamp.size());
+}
+double digest(const Trade& t) {
+    return t.price + static_cast<double>(t.size) + static_cast<double>(t.id % 1000) +
+           static_cast<double>(t.conditions.size() + t.timestamp.size() + t.exchange.size() + t.tape.size());
+}
+double digest(const Quote& q) {
+    return q.ask_price + q.bid_price + static_cast<double>(q.ask_size + q.bid_size) +
+           static_cast<double>(q.conditions.size() + q.timestamp.size() + q.ask_exchange.size());
+}
+double digest(const Snapshot& s) {
+    return digest(s.latest_trade) + digest(s.latest_quote) + digest(s.minute_bar) + digest(s.daily_bar) +
+           digest(s.prev_daily_bar);
+}
+template <typename T>
+double digest(const std::map<std::string, std::vector<T>>& m) {
+    double sum = 0.0;
+    for (const auto& [symbol, items] : m) {
+        sum += static_cast<double>(symbol.size());
+        for (const auto& item : items) {
+            sum += digest(item);
+        }
+    }
+    return sum;
+}
+double digest(const std::map<std::string, Snapshot>& m) {
+    double sum = 0.0;
+    for (const auto& [symbol, snapshot] : m) {
+        sum += static_cast<double>(symbol.size()) + digest(snapshot);
+    }
+    return sum;
+}
+#endif
+
+template <typename T>
+Status decodeRapidJSON(const std::string& json, T& out) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, "Received parse error when deserializing benchmark JSON");
+    }
+    return detail::decode(d, out);
+}
+
+template <typename T, typename Member>
+bool runCase(const std::string& name, const std::string& json, Member member, std::size_t iterations) {
+    std::printf("\n%s (%.2f MB)\n", name.c_str(), static_cast<double>(json.size()) / 1e6);
+
+    T rapid;
+    if (Status status = decodeRapidJSON(json, rapid); !status.ok()) {
+        std::fprintf(stderr, "rapidjson decode failed: %s\n", status.getMessage().c_str());
+        return false;
+    }
+    double seconds = bench::timeIterations(iterations, [&] {
+        T out;
+        decodeRapidJSON(json, out);
+    });
+    bench::reportThroughput("rapidjson", json.size(), iterations, seconds);
+
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    T simd;
+    if (Status status = detail::simd::decodeJSON(json, simd, "simdjson parse error"); !status.ok()) {
+        std::fprintf(stderr, "simdjson decode failed: %s\n", status.getMessage().c_str());
+        return false;
+    }
+    // RapidJSON's default number parsing may differ from simdjson's by an ulp, so compare with a tolerance.
+    double expected = digest(rapid.*member);
+    if (std::abs(expected - digest(simd.*member)) > 1e-9 * std::abs(expected)) {
+        std::fprintf(stderr, "%s: simdjson and rapidjson decoded different results\n", name.c_str());
+        return false;
+    }
+    seconds = bench::timeIterations(iterations, [&] {
+        T out;
+        detail::simd::decodeJSON(json, out, "simdjson parse error");
+    });
+    bench::reportThroughput("simdjson", json.size(), iterations, seconds);
+#else
+    (void)member;
+    std::printf("(configure with -DALPACA_MARKETS_JSON_BACKEND=simdjson to compare against simdjson)\n");
+#endif
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t iterations = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 20;
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    bool ok = true;
+    ok &= runCase<Bars>("Bars", makeBarsJSON(), &Bars::bars, iterations);
+    ok &= runCase<MultiTrades>("MultiTrades", makeTradesJSON(), &MultiTrades::trades, iterations);
+    ok &= runCase<MultiQuotes>("MultiQuotes", makeQuotesJSON(), &MultiQuotes::quotes, iterations);
+    ok &= runCase<CryptoBars>("CryptoBars", makeCryptoBarsJSON(), &CryptoBars::bars, iterations);
+    ok &= runCase<Snapshots>("Snapshots", makeSnapshotsJSON(), &Snapshots::snapshots, iterations);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+#include <alpaca/markets/markets.hpp>
+#include <rapidjson/document.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "detail/decode.hpp"
+
+using namespace alpaca::markets;
+
+namespace {
+
+constexpr int kOrders = 500;
+
+const char* kStatuses[] = {"new", "partially_filled", "filled", "canceled", "accepted"};
+const char* kTypes[] = {"market", "limit", "stop", "stop_limit"};
+
+std::string timestamp(int i) {
+    std::ostringstream ss;
+    ss << "2024-01-02T14:" << (10 + (i / 60) % 50) << ":" << (10 + i % 50) << ".123456789Z";
+    return ss.str();
+}
+
+std::string uuid(int i, int salt) {
+    char buf[40];
+    std::snprintf(buf, sizeof(buf), "%08x-%04x-4bfd-b9c3-%012x", 0x61e69015 + i, salt, 0x01e75843 + i);
+    return buf;
+}
+
+// A GET /v2/orders page: every field populated as the API sends it
+std::string makeOrdersJSON() {
+    std::ostringstream ss;
+    ss << "[";
+    for (int i = 0; i < kOrders; ++i) {
+        bool filled = i % 5 == 2;
+        ss << (i == 0 ? "" : ",") << "{\"id\":\"" << uuid(i, 1) << "\",\"client_order_id\":\"" << uuid(i, 2)
+           << "\",\"created_at\":\"" << timestamp(i) << "\",\"updated_at\":\"" << timestamp(i + 1)
+           << "\",\"submitted_at\":\"" << timestamp(i) << "\",\"filled_at\":"
+           << (filled ? "\"" + timestamp(i + 2) + "\"" : std::string("null"))
+           << ",\"expired_at\":null,\"canceled_at\":null,\"failed_at\":null,\"replaced_at\":null,"
+           << "\"replaced_by\":null,\"replaces\":null,\"asset_id\":\"" << uuid(i, 3) << "\",\"symbol\":\"SYM"
+           << i % 100 << "\",\"asset_class\":\"us_equity\",\"notional\":null,\"qty\":\"" << 1 + i % 200
+           << "\",\"filled_qty\":\"" << (filled ? 1 + i % 200 : 0) << "\",\"filled_avg_price\":"
+           << (filled ? "\"187.2345\"" : "null") << ",\"order_class\":\"\",\"order_type\":\"" << kTypes[i % 4]
+           << "\",\"type\":\"" << kTypes[i % 4] << "\",\"side\":\"" << (i % 2 ? "sell" : "buy")
+           << "\",\"time_in_force\":\"day\",\"limit_price\":\"" << 180 + i % 10 << ".25\",\"stop_price\":\""
+           << 175 + i % 10 << ".5\",\"status\":\"" << kStatuses[i % 5]
+           << "\",\"extended_hours\":false,\"legs\":null,\"trail_percent\":null,\"trail_price\":null,"
+           << "\"hwm\":null}";
+    }
+    ss << "]";
+    return ss.str();
+}
+
+// What getOrders() does with a response body
+Status decodeOrders(std::string json, std::vector<Order>& orders) {
+    rapidjson::Document d;
+    if (d.ParseInsitu(json.data()).HasParseError()) {
+        return Status(1, "Received parse error when deserializing orders JSON");
+    }
+    orders.clear();
+    orders.reserve(d.Size());
+    for (auto& o : d.GetArray()) {
+        Order order;
+        if (Status status = detail::decode(o, order); !status.ok()) {
+            return status;
+        }
+        orders.push_back(std::move(order));
+    }
+    return Status();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t iterations = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 200;
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    const std::string json = makeOrdersJSON();
+    std::printf("%d orders (%.1f KB)\n", kOrders, static_cast<double>(json.size()) / 1e3);
+
+    // Both paths parse in place, so each iteration decodes a fresh copy of the body, as a response would be
+    std::vector<Order> orders;
+    if (Status status = decodeOrders(json, orders); !status.ok()) {
+        std::fprintf(stderr, "Order decode failed: %s\n", status.getMessage().c_str());
+        return 1;
+    }
+    CompactOrders compact;
+    if (Status status = compact.fromJSON(std::string(json)); !status.ok()) {
+        std::fprintf(stderr, "CompactOrder decode failed: %s\n", status.getMessage().c_str());
+        return 1;
+    }
+    if (compact.orders.size() != orders.size() || compact.orders.back().id.view() != orders.back().id) {
+        std::fprintf(stderr, "Order and CompactOrder decoded different results\n");
+        return 1;
+    }
+
+    // Fresh containers per iteration for the legacy path, as getOrders() returns a new vector each call
+    double order_seconds = bench::timeIterations(iterations, [&] {
+        std::vector<Order> out;
+        decodeOrders(json, out);
+    });
+    bench::reportThroughput("Order (std::string fields)", json.size(), iterations, order_seconds);
+    bench::reportLatency("  per order", iterations * kOrders, order_seconds);
+
+    double fresh_seconds = bench::timeIterations(iterations, [&] {
+        CompactOrders out;
+        out.fromJSON(std::string(json));
+    });
+    bench::reportThroughput("CompactOrder", json.size(), iterations, fresh_seconds);
+    bench::reportLatency("  per order", iterations * kOrders, fresh_seconds);
+
+    double reused_seconds = bench::timeIterations(iterations, [&] { compact.fromJSON(std::string(json)); });
+    bench::reportThroughput("CompactOrder (reused storage)", json.size(), iterations, reused_seconds);
+    bench::reportLatency("  per order", iterations * kOrders, reused_seconds);
+
+    std::printf("\nspeedup: %.1fx (fresh), %.1fx (reused storage)\n", order_seconds / fresh_seconds,
+                order_seconds / reused_seconds);
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <alpaca/markets/markets.hpp>
+#include <httplib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bench.hpp"
+
+using namespace alpaca::markets;
+
+// Wire-to-wire order submission latency against a local stand-in for the
+// trading API: Client::submitOrder(const OrderRequest&) (body rendered per
+// order, headers and connection per order) versus OrderGateway (pre-rendered
+// template and headers, reused buffer, warm keep-alive connection). The stand-in speaks plain HTTP on loopback, so neither path
+// pays for TLS; against the real API the per-call path also repeats the TLS
+// handshake on every order.
+
+namespace {
+
+const char* kOrderResponse =
+    R"({"id":"61e69015-8549-4bfd-b9c3-01e75843f47d","client_order_id":"eb9e2aaa-f71a-4f51-b5b4-52a6c565dad4",)"
+    R"("created_at":"2024-01-02T14:30:00.123456Z","updated_at":"2024-01-02T14:30:00.123456Z",)"
+    R"("submitted_at":"2024-01-02T14:30:00.123456Z","asset_id":"b0b6dd9d-8b9b-48a9-ba46-b9d54906e415",)"
+    R"("symbol":"AAPL","asset_class":"us_equity","qty":"100","filled_qty":"0","type":"limit","side":"buy",)"
+    R"("time_in_force":"day","limit_price":"187.25","status":"accepted","extended_hours":false})";
+
+// An Environment whose trading API is the stand-in at base_url
+Environment makeStandInEnvironment(const std::string& base_url) {
+    // The ALPACA_MARKETS_* variables take precedence over custom names, so they must not leak in
+    for (const char* name : {"ALPACA_MARKETS_KEY_ID", "ALPACA_MARKETS_SECRET_KEY", "ALPACA_MARKETS_TRADING_URL",
+                             "ALPACA_MARKETS_DATA_URL"}) {
+        ::unsetenv(name);
+    }
+    ::setenv("ALPACA_BENCH_KEY_ID", "key", 1);
+    ::setenv("ALPACA_BENCH_SECRET_KEY", "secret", 1);
+    ::setenv("ALPACA_BENCH_TRADING_URL", base_url.c_str(), 1);
+    ::setenv("ALPACA_BENCH_DATA_URL", base_url.c_str(), 1);
+    Environment env("ALPACA_BENCH_KEY_ID", "ALPACA_BENCH_SECRET_KEY", "ALPACA_BENCH_TRADING_URL",
+                    "ALPACA_BENCH_DATA_URL");
+    if (Status status = env.parse(); !status.ok()) {
+        std::fprintf(stderr, "environment: %s\n", status.getMessage().c_str());
+        std::exit(1);
+    }
+    // Client-side pacing would hold all but the first 180 orders of each minute back
+    BatchConfig batch;
+    batch.max_requests_per_minute = 0;
+    env.setBatchConfig(batch);
+    return env;
+}
+
+template <typename Submit>
+std::vector<double> sample(std::size_t orders, Submit&& submit) {
+    std::vector<double> samples;
+    samples.reserve(orders);
+    for (std::size_t i = 0; i < orders; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        if (!submit(static_cast<int>(1 + i % 100))) {
+            std::fprintf(stderr, "order %zu failed\n", i);
+            std::exit(1);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        samples.push_back(elapsed.count());
+    }
+    return samples;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t orders = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 2000;
+    if (orders == 0) {
+        orders = 1;
+    }
+
+    httplib::Server server;
+    server.Post("/v2/orders", [](const httplib::Request&, httplib::Response& res) {
+        res.set_content(kOrderResponse, "application/json");
+    });
+    server.Get("/v2/clock", [](const httplib::Request&, httplib::Response& res) {
+        res.set_content(R"({"is_open":true})", "application/json");
+    });
+    int port = server.bind_to_any_port("127.0.0.1");
+    std::thread listener([&] { server.listen_after_bind(); });
+    server.wait_until_ready();
+    std::string base_url = "http://127.0.0.1:" + std::to_string(port);
+
+    Environment env = makeStandInEnvironment(base_url);
+
+    std::printf("Order submission round trip over loopback HTTP (%zu orders)\n", orders);
+    const std::string price = "187.25";
+    const Decimal limit_price = *Decimal::parse(price);
+    Client client(env);
+    auto per_call = sample(orders, [&](int quantity) {
+        return client.submitOrder(OrderRequest::limit("AAPL", quantity, OrderSide::Buy, limit_price)).first.ok();
+    });
+    bench::reportPercentiles("Client::submitOrder(OrderRequest)", per_call);
+
+    OrderGateway gateway(env, base_url);
+    if (Status status = gateway.warmUp(); !status.ok()) {
+        std::fprintf(stderr, "warm-up failed: %s\n", status.getMessage().c_str());
+        return 1;
+    }
+    OrderTemplate buy_aapl("AAPL", OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day);
+    auto gateway_samples =
+        sample(orders, [&](int quantity) { return gateway.submit(buy_aapl, quantity, price).first.ok(); });
+    bench::reportPercentiles("OrderGateway", gateway_samples);
+
+    std::string body;
+    double seconds = bench::timeIterations(orders * 100, [&] { buy_aapl.render(body, 100, price); });
+    bench::reportLatency("OrderTemplate::render", orders * 100, seconds);
+
+    server.stop();
+    listener.join();
+    return 0;
+}
@@ -0,0 +1,3 @@
+#pragma once
+// Forwarding header for backward compatibility
+#include <alpaca/markets/models/bulk_job.hpp>
@@ -27,20 +27,39 @@
 #include <alpaca/markets/account.hpp>
 #include <alpaca/markets/announcement.hpp>
 #include <alpaca/markets/asset.hpp>
+#include <alpaca/markets/asset_universe.hpp>
 #include <alpaca/markets/bars.hpp>
+#include <alpaca/markets/bulk_job.hpp>
 #include <alpaca/markets/calendar.hpp>
 #include <alpaca/markets/client.hpp>
+#include <alpaca/markets/client_order_id.hpp>
 #include <alpaca/markets/clock.hpp>
+#include <alpaca/markets/columns.hpp>
+#include <alpaca/markets/compact_order.hpp>
 #include <alpaca/markets/config.hpp>
 #include <alpaca/markets/crypto.hpp>
+#include <alpaca/markets/decimal.hpp>
+#include <alpaca/markets/history.hpp>
 #include <alpaca/markets/news.hpp>
 #include <alpaca/markets/option.hpp>
 #include <alpaca/markets/order.hpp>
+#include <alpaca/markets/order_cache.hpp>
+#include <alpaca/markets/order_gateway.hpp>
+#include <alpaca/markets/order_request.hpp>
 #include <alpaca/markets/portfolio.hpp>
 #include <alpaca/markets/position.hpp>
+#include <alpaca/markets/position_ledger.hpp>
 #include <alpaca/markets/quote.hpp>
+#include <alpaca/markets/response_cache.hpp>
+#include <alpaca/markets/risk_checks.hpp>
+#include <alpaca/markets/single_flight.hpp>
 #include <alpaca/markets/snapshot.hpp>
+#include <alpaca/markets/snapshot_ptr.hpp>
 #include <alpaca/markets/status.hpp>
+#include <alpaca/markets/string_hash.hpp>
 #include <alpaca/markets/streaming.hpp>
+#include <alpaca/markets/symbol.hpp>
+#include <alpaca/markets/symbol_map.hpp>
 #include <alpaca/markets/trade.hpp>
+#include <alpaca/markets/trade_update.hpp>
 #include <alpaca/markets/watchlist.hpp>
@@ -20,6 +20,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     bool account_blocked = false;
     std::string account_number;
@@ -63,6 +75,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string dtbp_check;
     bool no_shorting = false;
@@ -84,6 +108,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string activity_type;
     std::string cum_qty;
@@ -112,6 +148,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string activity_type;
     std::string date;
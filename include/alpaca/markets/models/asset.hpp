@@ -33,6 +33,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string asset_class;
     bool easy_to_borrow = false;
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <alpaca/markets/models/asset.hpp>
+#include <alpaca/markets/models/string_hash.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A boolean attribute of an Asset, indexed as a bitset column by AssetUniverse.
+ */
+enum class AssetFlag : uint8_t {
+    Tradable,
+    Shortable,
+    Marginable,
+    EasyToBorrow,
+    Fractionable,
+};
+
+/**
+ * @brief A set of asset indices stored as a bitset, one bit per asset in an AssetUniverse.
+ *
+ * Combining masks works a 64-bit word at a time, which compilers vectorize.
+ */
+class AssetMask {
+public:
+    AssetMask() = default;
+
+    /**
+     * @brief Create a mask over `size` assets with every bit set to `value`.
+     */
+    explicit AssetMask(std::size_t size, bool value = false);
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+
+    [[nodiscard]] bool test(std::size_t index) const { return (words_[index / 64] >> (index % 64)) & 1U; }
+
+    void set(std::size_t index, bool value = true);
+
+    /**
+     * @brief The number of set bits.
+     */
+    [[nodiscard]] std::size_t count() const;
+
+    AssetMask& operator&=(const AssetMask& other);
+    AssetMask& operator|=(const AssetMask& other);
+
+    /**
+     * @brief Keep only the bits which are not set in other.
+     */
+    AssetMask& subtract(const AssetMask& other);
+
+    /**
+     * @brief Call fn(index) for every set bit, in ascending order.
+     */
+    template <typename F>
+    void forEach(F&& fn) const {
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            for (uint64_t word = words_[w]; word != 0; word &= word - 1) {
+                fn(w * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    friend AssetMask operator&(AssetMask lhs, const AssetMask& rhs) { return lhs &= rhs; }
+    friend AssetMask operator|(AssetMask lhs, const AssetMask& rhs) { return lhs |= rhs; }
+    friend bool operator==(const AssetMask& lhs, const AssetMask& rhs) = default;
+
+private:
+    friend class AssetUniverse;
+
+    void resize(std::size_t size);
+
+    std::size_t size_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+/**
+ * @brief An index over the results of Client::getAssets().
+ *
+ * Symbols are hashed to stable indices, and each AssetFlag is kept as a bitset
+ * column, so screens such as "tradable and shortable and easy to borrow" are a
+ * few word-wise ANDs instead of a scan over ~30k Asset objects.
+ *
+ * Indices never change once assigned: refresh() updates existing assets in
+ * place, appends new ones, and marks assets missing from the new list as
+ * inactive rather than removing them. Arrays indexed by asset index therefore
+ * stay valid across refreshes.
+ *
+ * @code{.cpp}
+ *   auto [status, assets] = client.getAssets();
+ *   AssetUniverse universe(std::move(assets));
+ *   AssetMask shortable = universe.select({AssetFlag::Tradable, AssetFlag::Shortable, AssetFlag::EasyToBorrow});
+ *   for (const std::string& symbol : universe.symbols(shortable)) { ... }
+ * @endcode
+ */
+class AssetUniverse {
+public:
+    /**
+     * @brief Returned by indexOf() for symbols which are not in the universe.
+     */
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /**
+     * @brief Counts of the changes made by refresh().
+     */
+    struct RefreshStats {
+        std::size_t added = 0;
+        std::size_t updated = 0;
+        std::size_t removed = 0;
+    };
+
+    AssetUniverse() = default;
+
+    explicit AssetUniverse(std::vector<Asset> assets);
+
+    /**
+     * @brief Apply a new getAssets() result, keeping the indices of known symbols.
+     */
+    RefreshStats refresh(std::vector<Asset> assets);
+
+    /**
+     * @brief Add or update a single asset (e.g. from Client::getAsset()) and mark it active.
+     *
+     * @return the asset's index
+     */
+    std::size_t upsert(Asset asset);
+
+    /**
+     * @brief The number of assets ever indexed, including inactive ones.
+     */
+    [[nodiscard]] std::size_t size() const { return assets_.size(); }
+
+    [[nodiscard]] const Asset& operator[](std::size_t index) const { return assets_[index]; }
+    [[nodiscard]] const std::vector<Asset>& assets() const { return assets_; }
+
+    /**
+     * @brief The index of symbol, or npos.
+     */
+    [[nodiscard]] std::size_t indexOf(std::string_view symbol) const;
+
+    /**
+     * @brief The asset for symbol, or nullptr if it is not in the universe.
+     */
+    [[nodiscard]] const Asset* find(std::string_view symbol) const;
+
+    /**
+     * @brief The column for flag. Inactive assets have every flag cleared.
+     */
+    [[nodiscard]] const AssetMask& column(AssetFlag flag) const { return columns_[static_cast<std::size_t>(flag)]; }
+
+    /**
+     * @brief Assets present in the most recent getAssets() result.
+     */
+    [[nodiscard]] const AssetMask& active() const { return active_; }
+
+    /**
+     * @brief Active assets which have every one of the given flags.
+     */
+    [[nodiscard]] AssetMask select(std::initializer_list<AssetFlag> flags) const;
+
+    /**
+     * @brief The symbols of the assets in mask, in index order.
+     */
+    [[nodiscard]] std::vector<std::string> symbols(const AssetMask& mask) const;
+
+private:
+    static constexpr std::size_t kFlagCount = 5;
+
+    void setFlags(std::size_t index, const Asset& asset);
+    void resizeColumns();
+
+    std::vector<Asset> assets_;
+    std::unordered_map<std::string, std::size_t, StringHash, std::equal_to<>> index_;
+    std::array<AssetMask, kFlagCount> columns_;
+    AssetMask active_;
+};
+
+}  // namespace alpaca::markets
@@ -25,6 +25,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string timestamp;     // "t" - ISO 8601 timestamp
     double price = 0.0;        // "p" - auction price
@@ -47,6 +59,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::vector<Auction> daily_auctions;   // "d" - daily auctions (opening/closing)
 };
@@ -65,6 +89,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::map<std::string, SymbolAuctions> auctions;  // Symbol -> SymbolAuctions
     std::string next_page_token;                      // Pagination token
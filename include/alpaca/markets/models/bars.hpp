@@ -25,6 +25,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string timestamp;  // v2 uses ISO 8601 timestamp string "t"
     double open_price = 0.0;   // "o"
@@ -50,6 +62,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::map<std::string, std::vector<Bar>> bars;
     std::string next_page_token;  // v2 pagination
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <alpaca/markets/models/pagination.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/rest/config.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief Progress of a bulk download, persisted between runs.
+ */
+struct Checkpoint {
+    std::string query;       // Identifies the download (e.g. endpoint, symbol and range) the checkpoint belongs to
+    std::string page_token;  // Token of the next page to fetch; empty before the first page
+    uint64_t rows = 0;       // Items delivered to the sink so far
+    std::string last_key;    // Key of the last item delivered, used to drop re-fetched items
+    bool complete = false;   // Set once the final page has been delivered
+    uint64_t sink_base = 0;  // Items the sink already held when the job started
+};
+
+/**
+ * @brief Read a checkpoint file. A missing file leaves the checkpoint at its defaults.
+ */
+Status loadCheckpoint(const std::string& path, Checkpoint& checkpoint);
+
+/**
+ * @brief Write a checkpoint file atomically and durably.
+ *
+ * The checkpoint is written to a temporary file, which is fsync()ed, renamed
+ * over path, and then path's directory is fsync()ed, so after a crash or power
+ * loss the file holds either the previous checkpoint or this one.
+ */
+Status saveCheckpoint(const std::string& path, const Checkpoint& checkpoint);
+
+/**
+ * @brief The HTTP status named in a Client error message, e.g. "Call to ... returned an HTTP 404: ...",
+ * or 0 if it names none, as for a request that got no response.
+ */
+int httpStatusOf(const Status& status);
+
+/**
+ * @brief A resumable paginated download which checkpoints after every page.
+ *
+ * Pages are fetched with the endpoint's next_page_token and delivered to a
+ * sink through `sink.append(std::vector<T>&&)`, the same interface as
+ * PageIterator::collectInto(). After each page the token, row count and key
+ * of the last item are saved to the checkpoint file, so a job that crashes
+ * or is restarted continues from the last saved page instead of from scratch.
+ *
+ * A crash after a page reaches the sink but before its checkpoint is saved
+ * leaves the checkpoint one page behind the sink. Overlap is handled two ways:
+ * - If the sink has `truncate(std::size_t rows)`, it is called on resume
+ *   with the checkpoint's row count plus the rows the sink held when the job
+ *   started (recorded if the sink has `size()`). This discards anything the
+ *   sink received after the last checkpoint was written, and the page is
+ *   fetched again. TradeColumns, QuoteColumns and BarColumns have both.
+ *   Sinks without truncate() see the page that was in flight at the time of
+ *   a crash delivered twice.
+ * - Items up to and including the checkpointed key are dropped from the
+ *   first page fetched after a resume, in case the page token rewinds.
+ *
+ * The checkpoint records the job's query, and run() refuses to resume from a
+ * checkpoint written for a different query (another symbol, range or endpoint).
+ *
+ * Fetches that fail without a response, or with a status the RetryConfig
+ * retries (429 and 5xx), are retried with its backoff before the job gives
+ * up. Any other HTTP error, such as a 4xx for an unknown symbol or a bad
+ * range, won't succeed on a retry and fails the job at once.
+ *
+ * @code{.cpp}
+ *   auto job = makeTradesBulkJob(client, "AAPL", "2020-01-01", "2024-01-01", "checkpoints/AAPL.trades");
+ *   TradeColumns columns;
+ *   if (Status status = job.run(columns); !status.ok()) { ... }  // Run again later to resume
+ * @endcode
+ */
+template<typename T>
+class BulkJob {
+public:
+    using FetchFunc = typename PageIterator<T>::FetchFunc;
+    using KeyFunc = std::function<std::string(const T&)>;
+
+    /**
+     * @param checkpoint_path File recording the job's progress
+     * @param fetch_func Function that fetches a page given a page token
+     * @param key_func Identifies an item for de-duplication (nullptr disables it)
+     * @param retry Backoff policy for failed page fetches
+     * @param query Identifies what fetch_func downloads; a checkpoint saved with another query is rejected
+     */
+    BulkJob(std::string checkpoint_path, FetchFunc fetch_func, KeyFunc key_func = nullptr,
+            RetryConfig retry = RetryConfig::defaultConfig(), std::string query = "")
+        : checkpoint_path_(std::move(checkpoint_path)),
+          fetch_func_(std::move(fetch_func)),
+          key_func_(std::move(key_func)),
+          retry_(retry),
+          query_(std::move(query)) {}
+
+    /**
+     * @brief Run or resume the job until every page has been delivered to the sink.
+     *
+     * @return OK once complete (immediately if a previous run completed), an
+     * error if the checkpoint belongs to a different query, or the error that
+     * outlasted the retries. The checkpoint reflects every page delivered
+     * before the error.
+     */
+    template<typename Sink>
+    Status run(Sink& sink) {
+        if (Status status = loadCheckpoint(checkpoint_path_, checkpoint_); !status.ok()) {
+            return status;
+        }
+        bool started = checkpoint_.complete || checkpoint_.rows > 0 || !checkpoint_.page_token.empty();
+        if (started && checkpoint_.query != query_) {
+            return Status(1, "Checkpoint " + checkpoint_path_ + " was written for \"" + checkpoint_.query +
+                                 "\", not \"" + query_ + "\"");
+        }
+        checkpoint_.query = query_;
+        if (checkpoint_.complete) {
+            return Status();
+        }
+        if (!started) {
+            if constexpr (requires { sink.size(); }) {
+                checkpoint_.sink_base = sink.size();
+            }
+        } else if constexpr (requires { sink.truncate(checkpoint_.rows); }) {
+            sink.truncate(checkpoint_.sink_base + checkpoint_.rows);
+        }
+
+        bool check_overlap = !checkpoint_.last_key.empty();
+        while (true) {
+            auto [status, page] = fetchWithRetry(checkpoint_.page_token);
+            if (!status.ok()) {
+                return status;
+            }
+            if (check_overlap) {
+                dropDelivered(page.items);
+                check_overlap = false;
+            }
+
+            if (!page.items.empty()) {
+                checkpoint_.rows += page.items.size();
+                if (key_func_) {
+                    checkpoint_.last_key = key_func_(page.items.back());
+                }
+                sink.append(std::move(page.items));
+            }
+            checkpoint_.page_token = std::move(page.next_page_token);
+            checkpoint_.complete = checkpoint_.page_token.empty();
+            if (Status saved = saveCheckpoint(checkpoint_path_, checkpoint_); !saved.ok()) {
+                return saved;
+            }
+            if (checkpoint_.complete) {
+                return Status();
+            }
+        }
+    }
+
+    /**
+     * @brief The job's progress as of the last page delivered (or loaded by run()).
+     */
+    [[nodiscard]] const Checkpoint& checkpoint() const { return checkpoint_; }
+
+private:
+    std::pair<Status, Page<T>> fetchWithRetry(const std::string& page_token) {
+        for (int attempt = 0;; ++attempt) {
+            auto result = fetch_func_(page_token);
+            if (result.first.ok() || attempt >= retry_.max_retries) {
+                return result;
+            }
+            if (int http_status = httpStatusOf(result.first); http_status != 0 && !retry_.shouldRetry(http_status)) {
+                return result;
+            }
+            std::this_thread::sleep_for(retry_.getDelay(attempt));
+        }
+    }
+
+    // Drops the leading items a previous run already delivered, if the last delivered key is among them
+    void dropDelivered(std::vector<T>& items) const {
+        if (!key_func_) {
+            return;
+        }
+        auto it = std::find_if(items.begin(), items.end(),
+                               [this](const T& item) { return key_func_(item) == checkpoint_.last_key; });
+        if (it != items.end()) {
+            items.erase(items.begin(), std::next(it));
+        }
+    }
+
+    std::string checkpoint_path_;
+    FetchFunc fetch_func_;
+    KeyFunc key_func_;
+    RetryConfig retry_;
+    std::string query_;
+    Checkpoint checkpoint_;
+};
+
+/**
+ * @brief A resumable download of a symbol's trades, de-duplicated by timestamp and trade id.
+ */
+template<typename Client>
+BulkJob<class Trade> makeTradesBulkJob(
+    const Client& client,
+    const std::string& symbol,
+    const std::string& start,
+    const std::string& end,
+    std::string checkpoint_path,
+    unsigned int limit = 10000) {
+    return BulkJob<Trade>(
+        std::move(checkpoint_path),
+        [&client, symbol, start, end, limit](const std::string& page_token) {
+            auto [status, result] = client.getTrades(symbol, start, end, limit, page_token);
+            return std::make_pair(status, takePage(result.first, result.second));
+        },
+        [](const auto& trade) { return trade.timestamp + "/" + std::to_string(trade.id); },
+        RetryConfig::defaultConfig(),
+        "trades " + symbol + " " + start + " " + end);
+}
+
+/**
+ * @brief A resumable download of a symbol's bars, de-duplicated by timestamp.
+ */
+template<typename Client>
+BulkJob<class Bar> makeBarsBulkJob(
+    const Client& client,
+    const std::string& symbol,
+    const std::string& start,
+    const std::string& end,
+    std::string checkpoint_path,
+    const std::string& timeframe = "1Min",
+    unsigned int limit = 10000) {
+    return BulkJob<Bar>(
+        std::move(checkpoint_path),
+        [&client, symbol, start, end, timeframe, limit](const std::string& page_token) {
+            auto [status, result] = client.getBars({symbol}, start, end, timeframe, limit, page_token);
+            Page<Bar> page;
+            if (auto it = result.bars.find(symbol); it != result.bars.end()) {
+                page.items = std::move(it->second);
+            }
+            page.next_page_token = std::move(result.next_page_token);
+            return std::make_pair(status, std::move(page));
+        },
+        [](const auto& bar) { return bar.timestamp; },
+        RetryConfig::defaultConfig(),
+        "bars " + symbol + " " + timeframe + " " + start + " " + end);
+}
+
+}  // namespace alpaca::markets
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A generated client_order_id, held inline so generating one does not allocate.
+ */
+class ClientOrderId {
+public:
+    /// Longest id a ClientOrderIdGenerator produces
+    static constexpr std::size_t kMaxLength = 64;
+
+    [[nodiscard]] std::string_view view() const { return {chars_.data(), size_}; }
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] std::string str() const { return std::string(view()); }
+
+private:
+    friend class ClientOrderIdGenerator;
+
+    std::array<char, kMaxLength> chars_{};
+    std::uint8_t size_ = 0;
+};
+
+/**
+ * @brief A lock-free generator of unique client_order_ids.
+ *
+ * Ids have the fixed-width form `<prefix>-<time>-<sequence>`:
+ * - prefix: given at construction, or 8 random base-36 characters chosen once per generator
+ * - time: milliseconds since the Unix epoch, 9 base-36 digits
+ * - sequence: a per-generator atomic counter, 8 base-36 digits
+ *
+ * The counter makes ids from one generator unique; the random prefix separates
+ * processes, and the timestamp separates runs that reuse a fixed prefix. next()
+ * is a relaxed atomic increment, a clock read and formatting into a fixed
+ * buffer, so it can be called from any number of threads.
+ *
+ * @code{.cpp}
+ *   alpaca::markets::ClientOrderId id = alpaca::markets::ClientOrderIdGenerator::global().next();
+ *   // e.g. "k3v9x0qa-m2f8z1c4p-00000001"
+ * @endcode
+ */
+class ClientOrderIdGenerator {
+public:
+    /// Longest prefix kept; longer prefixes are truncated
+    static constexpr std::size_t kMaxPrefixLength = 32;
+
+    static constexpr std::size_t kTimeDigits = 9;
+    static constexpr std::size_t kSequenceDigits = 8;
+
+    /**
+     * @brief Create a generator with a random per-generator prefix.
+     */
+    ClientOrderIdGenerator();
+
+    /**
+     * @brief Create a generator with a fixed prefix, e.g. a strategy name.
+     *
+     * Characters other than letters, digits, '-' and '_' are replaced with '_',
+     * and the prefix is truncated to kMaxPrefixLength.
+     */
+    explicit ClientOrderIdGenerator(std::string_view prefix);
+
+    ClientOrderIdGenerator(const ClientOrderIdGenerator&) = delete;
+    ClientOrderIdGenerator& operator=(const ClientOrderIdGenerator&) = delete;
+
+    /**
+     * @brief The process-wide generator that Client uses to fill in missing client_order_ids.
+     */
+    static ClientOrderIdGenerator& global();
+
+    /**
+     * @brief Generate the next id.
+     */
+    ClientOrderId next();
+
+    [[nodiscard]] std::string_view prefix() const { return {prefix_.data(), prefix_size_}; }
+
+private:
+    std::array<char, kMaxPrefixLength> prefix_{};
+    std::size_t prefix_size_ = 0;
+    std::atomic<std::uint64_t> sequence_{0};
+};
+
+}  // namespace alpaca::markets
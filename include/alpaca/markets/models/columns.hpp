@@ -0,0 +1,79 @@
+#pragma once
+
+#include <alpaca/markets/models/bars.hpp>
+#include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/trade.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief Trades stored column by column, for analytics over long histories.
+ *
+ * Usable as a PageIterator::collectInto() or BulkJob sink. Conditions are dropped.
+ * truncate(n) keeps the first n rows (and does nothing if there are fewer).
+ */
+class TradeColumns {
+public:
+    void reserve(std::size_t n);
+    void append(std::vector<Trade>&& trades);
+    void truncate(std::size_t n);
+    [[nodiscard]] std::size_t size() const { return prices.size(); }
+
+public:
+    std::vector<std::string> timestamps;
+    std::vector<double> prices;
+    std::vector<uint64_t> sizes;
+    std::vector<uint64_t> ids;
+    std::vector<std::string> exchanges;
+    std::vector<std::string> tapes;
+};
+
+/**
+ * @brief Quotes stored column by column. Usable as a PageIterator::collectInto() or BulkJob sink.
+ *
+ * Conditions are dropped.
+ */
+class QuoteColumns {
+public:
+    void reserve(std::size_t n);
+    void append(std::vector<Quote>&& quotes);
+    void truncate(std::size_t n);
+    [[nodiscard]] std::size_t size() const { return bid_prices.size(); }
+
+public:
+    std::vector<std::string> timestamps;
+    std::vector<double> bid_prices;
+    std::vector<uint64_t> bid_sizes;
+    std::vector<std::string> bid_exchanges;
+    std::vector<double> ask_prices;
+    std::vector<uint64_t> ask_sizes;
+    std::vector<std::string> ask_exchanges;
+};
+
+/**
+ * @brief Bars stored column by column. Usable as a PageIterator::collectInto() or BulkJob sink.
+ */
+class BarColumns {
+public:
+    void reserve(std::size_t n);
+    void append(std::vector<Bar>&& bars);
+    void truncate(std::size_t n);
+    [[nodiscard]] std::size_t size() const { return close_prices.size(); }
+
+public:
+    std::vector<std::string> timestamps;
+    std::vector<double> open_prices;
+    std::vector<double> high_prices;
+    std::vector<double> low_prices;
+    std::vector<double> close_prices;
+    std::vector<uint64_t> volumes;
+    std::vector<uint64_t> trade_counts;
+    std::vector<double> vwaps;
+};
+
+}  // namespace alpaca::markets
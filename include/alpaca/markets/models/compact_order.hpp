@@ -0,0 +1,153 @@
+#pragma once
+
+#include <alpaca/markets/models/decimal.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/status.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A string of at most N characters stored inline, for ids and symbols of bounded length.
+ */
+template <std::size_t N>
+class InlineString {
+public:
+    static_assert(N < 256, "InlineString stores its size in one byte");
+
+    static constexpr std::size_t kCapacity = N;
+
+    /**
+     * @brief Replace the contents with value.
+     *
+     * @return false, leaving the contents unchanged, if value is longer than kCapacity.
+     */
+    bool assign(std::string_view value) {
+        if (value.size() > N) {
+            return false;
+        }
+        value.copy(chars_.data(), value.size());
+        size_ = static_cast<std::uint8_t>(value.size());
+        return true;
+    }
+
+    [[nodiscard]] std::string_view view() const { return {chars_.data(), size_}; }
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+    [[nodiscard]] std::string str() const { return std::string(view()); }
+
+private:
+    std::array<char, N> chars_{};
+    std::uint8_t size_ = 0;
+};
+
+/**
+ * @brief Parse an RFC 3339 timestamp (e.g. "2024-01-02T14:30:00.123456789Z") into nanoseconds since the Unix epoch.
+ *
+ * Accepts a 'Z' or "+HH:MM"/"-HH:MM" offset and up to nine fractional digits (more are truncated).
+ *
+ * @return the timestamp, or nullopt if text is not a valid RFC 3339 timestamp.
+ */
+std::optional<std::int64_t> parseTimestampNanos(std::string_view text);
+
+/**
+ * @brief An order decoded without heap allocations.
+ *
+ * Holds the same fields as Order, but with enums for side, type, time in force,
+ * class and status, Decimals for quantities and prices, nanoseconds since the
+ * Unix epoch for timestamps and inline strings for ids and symbols. Numbers are
+ * exact (a price of "0.1" is exactly 0.1), and the whole order is one flat
+ * value, so a vector of them is a single allocation.
+ *
+ * fromJSON() reads fields straight from the JSON text into the order with
+ * RapidJSON's SAX reader, parsing in situ, without building a document first.
+ * Absent and null fields are left at zero, empty or Unknown. Nested legs are
+ * not decoded.
+ */
+struct CompactOrder {
+    InlineString<40> id;  // UUIDs are 36 characters
+    InlineString<128> client_order_id;
+    InlineString<40> asset_id;
+    InlineString<32> symbol;
+    InlineString<16> asset_class;
+
+    // Unknown when absent or not recognized
+    OrderSide side = OrderSide::Unknown;
+    OrderType type = OrderType::Unknown;
+    OrderTimeInForce time_in_force = OrderTimeInForce::Unknown;
+    OrderClass order_class = OrderClass::Unknown;
+    OrderStatus status = OrderStatus::Unknown;
+    bool extended_hours = false;
+
+    Decimal qty;
+    Decimal notional;
+    Decimal filled_qty;
+    Decimal filled_avg_price;
+    Decimal limit_price;
+    Decimal stop_price;
+    Decimal trail_price;
+    Decimal trail_percent;
+    Decimal hwm;
+
+    // Nanoseconds since the Unix epoch; 0 when not set
+    std::int64_t created_at = 0;
+    std::int64_t updated_at = 0;
+    std::int64_t submitted_at = 0;
+    std::int64_t filled_at = 0;
+    std::int64_t expired_at = 0;
+    std::int64_t canceled_at = 0;
+    std::int64_t failed_at = 0;
+
+    /**
+     * @brief A method for deserializing JSON into the current object state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation. A string too long
+     *         for its inline buffer, or a number or timestamp that doesn't parse, is an error.
+     */
+    Status fromJSON(const std::string& json);
+
+    /**
+     * @brief Same as fromJSON(const std::string&), but parses json in place instead of a copy of it; its
+     *        contents afterwards are unspecified.
+     */
+    Status fromJSON(std::string&& json);
+};
+
+/**
+ * @brief A list of CompactOrders, e.g. a GET /v2/orders response.
+ *
+ * Decoding into the same object again reuses the vector's capacity, so a
+ * poller that keeps one CompactOrders around doesn't allocate per call once
+ * it has seen its largest response.
+ */
+class CompactOrders {
+public:
+    /**
+     * @brief A method for deserializing JSON into the current object state.
+     *
+     * @param json The JSON string, an array of orders
+     *
+     * @return a Status indicating the success or failure of the operation. On failure orders is left empty.
+     */
+    Status fromJSON(const std::string& json);
+
+    /**
+     * @brief Same as fromJSON(const std::string&), but parses json in place instead of a copy of it; its
+     *        contents afterwards are unspecified.
+     */
+    Status fromJSON(std::string&& json);
+
+public:
+    std::vector<CompactOrder> orders;
+};
+
+}  // namespace alpaca::markets
@@ -23,6 +23,7 @@ enum class CryptoFeed {
 class CryptoTrade {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     double price = 0.0;           // "p"
@@ -38,6 +39,7 @@ public:
 class CryptoQuote {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     double ask_price = 0.0;      // "ap"
@@ -53,6 +55,7 @@ public:
 class CryptoBar {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     std::string timestamp;        // "t"
@@ -71,6 +74,7 @@ public:
 class CryptoSnapshot {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     CryptoTrade latest_trade;
@@ -86,6 +90,7 @@ public:
 class CryptoTrades {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     std::map<std::string, std::vector<CryptoTrade>> trades;
@@ -98,6 +103,7 @@ public:
 class CryptoQuotes {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     std::map<std::string, std::vector<CryptoQuote>> quotes;
@@ -110,6 +116,7 @@ public:
 class CryptoBars {
 public:
     Status fromJSON(const std::string& json);
+    Status fromJSON(std::string&& json);
 
 public:
     std::map<std::string, std::vector<CryptoBar>> bars;
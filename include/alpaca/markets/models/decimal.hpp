@@ -0,0 +1,156 @@
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace alpaca::markets {
+
+/**
+ * @brief Integer types that convert to a Decimal: every std::integral type except bool and the character types.
+ */
+template <typename T>
+concept DecimalInteger =
+    std::integral<T> && !std::same_as<std::remove_cv_t<T>, bool> && !std::same_as<std::remove_cv_t<T>, char> &&
+    !std::same_as<std::remove_cv_t<T>, wchar_t> && !std::same_as<std::remove_cv_t<T>, char8_t> &&
+    !std::same_as<std::remove_cv_t<T>, char16_t> && !std::same_as<std::remove_cv_t<T>, char32_t>;
+
+/**
+ * @brief A signed fixed-point decimal with nine fractional digits, for quantities and prices.
+ *
+ * Stored as an integer count of 1e-9 units, so values such as "0.1" or "187.2345" round-trip
+ * exactly, which a double does not guarantee. The range is about ±9.2 billion, enough for share
+ * quantities, prices and notionals.
+ *
+ * Integers within ±kMaxWhole convert implicitly; bools and characters don't convert, nor do
+ * floating-point values, because they cannot be converted without choosing a rounding. An
+ * out-of-range integer fails to compile in a constant expression and is a precondition violation at
+ * runtime, so convert untrusted values with checked(). of<N>() checks a constant with static_assert.
+ * Parse decimal strings with parse().
+ *
+ * @code{.cpp}
+ *   alpaca::markets::Decimal qty = 100;
+ *   constexpr alpaca::markets::Decimal lot = alpaca::markets::Decimal::of<1000>();
+ *   std::optional<alpaca::markets::Decimal> shares = alpaca::markets::Decimal::checked(requested_shares);
+ *   std::optional<alpaca::markets::Decimal> price = alpaca::markets::Decimal::parse("187.25");
+ * @endcode
+ */
+class Decimal {
+public:
+    /// Digits kept after the decimal point
+    static constexpr int kScale = 9;
+
+    /// The number of units in 1
+    static constexpr std::int64_t kUnitsPerOne = 1'000'000'000;
+
+    /// Buffer size that fits any value written by appendTo()
+    static constexpr std::size_t kMaxChars = 32;
+
+    /// The largest whole number a Decimal holds; the smallest is its negation
+    static constexpr std::int64_t kMaxWhole = std::numeric_limits<std::int64_t>::max() / kUnitsPerOne;
+
+    constexpr Decimal() = default;
+
+    /**
+     * @brief whole, which must be within ±kMaxWhole.
+     */
+    template <DecimalInteger T>
+    constexpr Decimal(T whole) : units_(toUnits(whole)) {}
+
+    // Floating-point values, bools and characters don't convert
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !DecimalInteger<T>)
+    Decimal(T) = delete;
+
+    /**
+     * @brief The constant Whole, rejected at compile time if it is out of range.
+     */
+    template <DecimalInteger auto Whole>
+    static constexpr Decimal of() {
+        static_assert(fits(Whole), "Decimal holds whole numbers within ±kMaxWhole");
+        return Decimal(Whole);
+    }
+
+    /**
+     * @brief whole as a Decimal, or nullopt if it is out of range.
+     */
+    template <DecimalInteger T>
+    static constexpr std::optional<Decimal> checked(T whole) {
+        if (!fits(whole)) {
+            return std::nullopt;
+        }
+        return Decimal(whole);
+    }
+
+    /**
+     * @brief A Decimal from a raw count of 1e-9 units.
+     */
+    static constexpr Decimal fromUnits(std::int64_t units) {
+        Decimal value;
+        value.units_ = units;
+        return value;
+    }
+
+    /**
+     * @brief Parse a plain decimal such as "100", "-0.5" or "187.25".
+     *
+     * @return the value, or nullopt for empty input, anything other than an optional '-', digits and at most
+     *         one '.', more than kScale fractional digits, or a value out of range.
+     */
+    static std::optional<Decimal> parse(std::string_view text);
+
+    [[nodiscard]] constexpr std::int64_t units() const { return units_; }
+    [[nodiscard]] constexpr bool isZero() const { return units_ == 0; }
+    [[nodiscard]] constexpr bool isNegative() const { return units_ < 0; }
+
+    /**
+     * @brief The nearest double, for arithmetic where exactness doesn't matter (e.g. risk checks).
+     */
+    [[nodiscard]] double toDouble() const { return static_cast<double>(units_) / static_cast<double>(kUnitsPerOne); }
+
+    /**
+     * @brief Write the shortest exact representation (no trailing fractional zeros) into buf.
+     *
+     * @param buf At least kMaxChars bytes
+     *
+     * @return one past the last character written.
+     */
+    char* write(char* buf) const;
+
+    /**
+     * @brief Append the shortest exact representation to out without allocating beyond out's growth.
+     */
+    void appendTo(std::string& out) const;
+
+    [[nodiscard]] std::string toString() const;
+
+    constexpr auto operator<=>(const Decimal&) const = default;
+
+private:
+    template <DecimalInteger T>
+    static constexpr bool fits(T whole) {
+        return std::cmp_greater_equal(whole, -kMaxWhole) && std::cmp_less_equal(whole, kMaxWhole);
+    }
+
+    template <DecimalInteger T>
+    static constexpr std::int64_t toUnits(T whole) {
+        if (!fits(whole)) {
+            outOfRange();
+        }
+        return static_cast<std::int64_t>(whole) * kUnitsPerOne;
+    }
+
+    // Not constexpr, so a constant expression that reaches it doesn't compile
+    static void outOfRange() { assert(false && "Decimal holds whole numbers within ±kMaxWhole"); }
+
+    std::int64_t units_ = 0;
+};
+
+}  // namespace alpaca::markets
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <alpaca/markets/models/pagination.hpp>
+#include <alpaca/markets/models/status.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A sub-range of a historical query, as RFC3339 start and end times.
+ */
+struct TimeRange {
+    std::string start;
+    std::string end;
+};
+
+/**
+ * @brief Split [start, end] into up to `parts` contiguous sub-ranges of equal duration.
+ *
+ * Interior boundaries fall on whole seconds; each sub-range ends one nanosecond
+ * before the next begins so that no item is returned by two sub-ranges. The
+ * first and last sub-ranges keep the caller's start and end strings.
+ *
+ * @param start Start time (RFC3339 or YYYY-MM-DD)
+ * @param end End time (RFC3339 or YYYY-MM-DD)
+ * @param parts Number of sub-ranges; fewer are returned if the range is shorter than `parts` seconds
+ */
+std::pair<Status, std::vector<TimeRange>> splitTimeRange(const std::string& start, const std::string& end,
+                                                         std::size_t parts);
+
+/**
+ * @brief Split [start, end] into sub-ranges at each UTC midnight.
+ */
+std::pair<Status, std::vector<TimeRange>> splitTimeRangeByDay(const std::string& start, const std::string& end);
+
+/**
+ * @brief Options for a parallel history download.
+ */
+struct ParallelDownloadConfig {
+    /// Number of sub-ranges paged concurrently
+    std::size_t max_concurrency = 4;
+
+    /// Requests per minute shared by all workers (0 = unlimited). Alpaca's basic plan allows 200.
+    unsigned int requests_per_minute = 200;
+
+    /// Items requested per page
+    unsigned int page_limit = 10000;
+};
+
+namespace detail {
+
+/**
+ * @brief Fetches one page of range `range` after page_token, returning its status and the next page token.
+ */
+using RangePageFetch = std::function<std::pair<Status, std::string>(std::size_t range, const std::string& page_token)>;
+
+/**
+ * @brief Page through range_count ranges on up to ParallelDownloadConfig::max_concurrency workers.
+ *
+ * Each worker calls make_fetch() once, so it can hold a connection of its own, then takes the next unclaimed
+ * range and follows its page tokens to the end. All requests share one requests_per_minute limit. Stops at
+ * the first error; an exception thrown by a fetch becomes an error.
+ */
+Status downloadRangePages(std::size_t range_count, const ParallelDownloadConfig& config,
+                          const std::function<RangePageFetch()>& make_fetch);
+
+/**
+ * @brief Concatenate per-range results in range order.
+ */
+template <typename T>
+std::vector<T> concatRanges(std::vector<std::vector<T>>& results) {
+    std::size_t total = 0;
+    for (const auto& items : results) {
+        total += items.size();
+    }
+    std::vector<T> merged;
+    merged.reserve(total);
+    for (auto& items : results) {
+        std::move(items.begin(), items.end(), std::back_inserter(merged));
+    }
+    return merged;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Page through several time ranges of one query concurrently and merge the results.
+ *
+ * Each worker takes the next unclaimed range and follows its next_page_token to
+ * the end; the workers together send at most requests_per_minute requests in any
+ * one-minute window. The ranges must be in ascending time order and must not
+ * overlap, so concatenating the per-range results in range order yields items in
+ * timestamp order.
+ *
+ * @param ranges Sub-ranges, e.g. from splitTimeRange() or sized by expected volume
+ * @param fetch Callable (const TimeRange&, const std::string& page_token) -> std::pair<Status, Page<T>>,
+ *              invoked from worker threads
+ * @return the first error encountered (an exception thrown by fetch becomes an error), or all items in
+ *         timestamp order
+ */
+template <typename T, typename FetchRange>
+std::pair<Status, std::vector<T>> downloadRanges(const std::vector<TimeRange>& ranges, FetchRange fetch,
+                                                 const ParallelDownloadConfig& config = {}) {
+    std::vector<std::vector<T>> results(ranges.size());
+    Status status = detail::downloadRangePages(ranges.size(), config, [&] {
+        return detail::RangePageFetch([&](std::size_t i, const std::string& page_token) {
+            auto [page_status, page] = fetch(ranges[i], page_token);
+            if (results[i].empty()) {
+                results[i] = std::move(page.items);
+            } else {
+                std::move(page.items.begin(), page.items.end(), std::back_inserter(results[i]));
+            }
+            return std::make_pair(page_status, std::move(page.next_page_token));
+        });
+    });
+    if (!status.ok()) {
+        return std::make_pair(status, std::vector<T>());
+    }
+    return std::make_pair(Status(), detail::concatRanges(results));
+}
+
+/**
+ * @brief Download a symbol's trades over several time ranges concurrently.
+ *
+ * Forwards to Client::downloadTrades(), whose workers each keep one connection to the data host.
+ *
+ * @code{.cpp}
+ *   auto [split_status, ranges] = splitTimeRangeByDay("2024-01-01T00:00:00Z", "2024-02-01T00:00:00Z");
+ *   auto [status, trades] = downloadTrades(client, "AAPL", ranges);
+ * @endcode
+ */
+template <typename Client>
+std::pair<Status, std::vector<class Trade>> downloadTrades(const Client& client, const std::string& symbol,
+                                                           const std::vector<TimeRange>& ranges,
+                                                           const ParallelDownloadConfig& config = {}) {
+    return client.downloadTrades(symbol, ranges, config);
+}
+
+/**
+ * @brief Download a symbol's quotes over several time ranges concurrently.
+ */
+template <typename Client>
+std::pair<Status, std::vector<class Quote>> downloadQuotes(const Client& client, const std::string& symbol,
+                                                           const std::vector<TimeRange>& ranges,
+                                                           const ParallelDownloadConfig& config = {}) {
+    return client.downloadQuotes(symbol, ranges, config);
+}
+
+/**
+ * @brief Download a symbol's bars over several time ranges concurrently.
+ */
+template <typename Client>
+std::pair<Status, std::vector<class Bar>> downloadBars(const Client& client, const std::string& symbol,
+                                                       const std::vector<TimeRange>& ranges,
+                                                       const std::string& timeframe = "1Min",
+                                                       const ParallelDownloadConfig& config = {}) {
+    return client.downloadBars(symbol, ranges, timeframe, config);
+}
+
+}  // namespace alpaca::markets
@@ -3,6 +3,8 @@
 #include <alpaca/markets/models/status.hpp>
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace alpaca::markets {
 
@@ -25,6 +27,7 @@ std::string orderDirectionToString(OrderDirection direction);
 enum class OrderSide {
     Buy,
     Sell,
+    Unknown,  // A value this version does not recognize; never sent
 };
 
 /**
@@ -44,6 +47,7 @@ enum class OrderType {
     Stop,
     StopLimit,
     TrailingStop,
+    Unknown,  // A value this version does not recognize; never sent
 };
 
 /**
@@ -64,6 +68,7 @@ enum class OrderTimeInForce {
     CLS,
     ImmediateOrCancel,
     FillOrKill,
+    Unknown,  // A value this version does not recognize; never sent
 };
 
 /**
@@ -83,6 +88,7 @@ enum class OrderClass {
     OneCancelsOther,
     OneTriggersOther,
     MultiLeg,
+    Unknown,  // A value this version does not recognize; never sent
 };
 
 /**
@@ -105,6 +111,46 @@ enum class PositionIntent {
  */
 std::string positionIntentToString(PositionIntent intent);
 
+/**
+ * @brief The lifecycle state of an order.
+ *
+ * For more information on order statuses, see:
+ * https://docs.alpaca.markets/docs/orders-at-alpaca#order-lifecycle
+ */
+enum class OrderStatus {
+    New,
+    PartiallyFilled,
+    Filled,
+    DoneForDay,
+    Canceled,
+    Expired,
+    Replaced,
+    PendingCancel,
+    PendingReplace,
+    PendingNew,
+    Accepted,
+    AcceptedForBidding,
+    Stopped,
+    Rejected,
+    Suspended,
+    Calculated,
+    Held,
+    Unknown,
+};
+
+/**
+ * @brief A helper to convert an OrderStatus to a string
+ */
+std::string orderStatusToString(OrderStatus status);
+
+// Conversions from the API's strings; unrecognized values map to the enum's Unknown, except that an
+// empty order_class is Simple. The *ToString() helpers render Unknown as "unknown".
+OrderSide stringToOrderSide(std::string_view s);
+OrderType stringToOrderType(std::string_view s);
+OrderTimeInForce stringToOrderTimeInForce(std::string_view s);
+OrderClass stringToOrderClass(std::string_view s);
+OrderStatus stringToOrderStatus(std::string_view s);
+
 /**
  * @brief Additional parameters for take-profit leg of advanced orders
  */
@@ -137,6 +183,18 @@ public:
      */
     Status fromJSON(const std::string& json);
 
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
 public:
     std::string asset_class;
     std::string asset_id;
@@ -167,4 +225,55 @@ public:
     std::string updated_at;
 };
 
+/**
+ * @brief The outcome of cancelling one order as part of Client::cancelAllOrders().
+ */
+struct OrderCancelResult {
+    /// The id of the order
+    std::string id;
+
+    /**
+     * The HTTP status the server reported for this order: 200 for an accepted cancellation in the bulk
+     * response, or the status of its own DELETE (204 when accepted) when cancelled by id. 0 if no response
+     * arrived.
+     */
+    int http_status = 0;
+
+    /// OK when the cancellation was accepted, or (after a cancel-by-id fallback) the order was found already
+    /// canceled or pending_cancel; otherwise why it wasn't, or why the entry couldn't be decoded
+    Status status;
+
+    /// The order's state, when returned with an accepted cancellation (only the id after a cancel-by-id fallback,
+    /// unless the order was fetched after a 422)
+    Order order;
+};
+
+/**
+ * @brief The per-order results of DELETE /v2/orders (an HTTP 207 multi-status response).
+ *
+ * Each entry of the response holds an order id, that order's HTTP status and a
+ * body which is either the order or an error. Entries are decoded in one pass
+ * over the parsed response; an entry that reports a failure or can't be decoded
+ * becomes a result with a non-OK status rather than failing the others.
+ */
+class OrderCancelResults {
+public:
+    /**
+     * @brief A method for deserializing JSON into the current object state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status which is only non-OK if the JSON isn't an array.
+     */
+    Status fromJSON(const std::string& json);
+
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     */
+    Status fromJSON(std::string&& json);
+
+public:
+    std::vector<OrderCancelResult> results;
+};
+
 }  // namespace alpaca::markets
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/snapshot_ptr.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/string_hash.hpp>
+#include <alpaca/markets/models/trade_update.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief True for order statuses after which the order never changes again
+ * (filled, canceled, expired, replaced, rejected, done_for_day).
+ */
+bool isTerminalOrderStatus(std::string_view status);
+
+/**
+ * @brief An in-process view of the account's orders, kept current by trade_updates events.
+ *
+ * Seed it with Client::getOrders(ActionStatus::Open), feed it every
+ * trade_updates message, and call reconcile() with a fresh getOrders() result
+ * now and then to catch events lost to a disconnect. Updates carrying an older
+ * updated_at than the cached order are ignored, so stream events and REST
+ * results may arrive in either order.
+ *
+ * Reads take no lock: each update publishes a new immutable Snapshot through
+ * a SnapshotPtr, and a snapshot, and every order in it, stays valid for as
+ * long as the reader holds it. A snapshot spreads its orders over
+ * Snapshot::kShards immutable shards by hash, and an update copies only the
+ * shards it touches (at most two per order, for its id and client_order_id)
+ * and shares the rest with the previous snapshot, so one update costs about
+ * N / kShards entries rather than N. Writers are serialized with a separate
+ * mutex.
+ *
+ * updated_at values are compared as instants, so timestamps with different
+ * numbers of fractional digits or different offsets order correctly.
+ *
+ * Terminal orders remain queryable until more than max_closed orders have
+ * closed since, then the oldest are evicted.
+ *
+ * @code{.cpp}
+ *   OrderCache orders;
+ *   auto [status, open] = client.getOrders(ActionStatus::Open, 500);
+ *   orders.reconcile(std::move(open));
+ *   stream::Handler handler([&](stream::DataType data) { orders.apply(data); }, ...);
+ *
+ *   // Any thread:
+ *   if (auto order = orders.findByClientOrderId("strategy-1-42")) { ... order->status ... }
+ * @endcode
+ */
+class OrderCache {
+public:
+    /**
+     * @brief An immutable view of every cached order at one point in time.
+     */
+    struct Snapshot {
+        /**
+         * @brief The order with the given id, or nullptr.
+         */
+        [[nodiscard]] const Order* find(std::string_view id) const;
+
+        /**
+         * @brief The order with the given client_order_id, or nullptr.
+         */
+        [[nodiscard]] const Order* findByClientOrderId(std::string_view client_order_id) const;
+
+        /**
+         * @brief The orders which are not in a terminal status.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<const Order>> open() const;
+
+        /**
+         * @brief The number of cached orders.
+         */
+        [[nodiscard]] std::size_t size() const { return order_count; }
+
+        static constexpr std::size_t kShards = 64;
+
+        /**
+         * @brief The orders whose id, and the client_order_ids which, hash to one shard.
+         */
+        struct Shard {
+            std::unordered_map<std::string, std::shared_ptr<const Order>, StringHash, std::equal_to<>> orders;
+            std::unordered_map<std::string, std::string, StringHash, std::equal_to<>> ids_by_client_order_id;
+        };
+
+        /**
+         * @brief The shard holding key, an order id or client_order_id.
+         */
+        [[nodiscard]] const Shard& shard(std::string_view key) const;
+
+        /// Never null; shards an update did not touch are shared with the previous snapshot
+        std::array<std::shared_ptr<const Shard>, kShards> shards;
+        std::size_t order_count = 0;
+        /// Incremented by every update which changed the cache
+        uint64_t version = 0;
+    };
+
+    /**
+     * @brief Counts of the changes made by reconcile().
+     */
+    struct ReconcileStats {
+        std::size_t inserted = 0;
+        std::size_t updated = 0;
+        /// Open orders in the cache which the REST result no longer lists. They
+        /// closed without the cache seeing the event; fetch each with
+        /// Client::getOrder() and pass it to upsert().
+        std::vector<std::string> vanished;
+    };
+
+    explicit OrderCache(std::size_t max_closed = 1024);
+
+    OrderCache(const OrderCache&) = delete;
+    OrderCache& operator=(const OrderCache&) = delete;
+
+    /**
+     * @brief Merge a Client::getOrders(ActionStatus::Open) result into the cache.
+     */
+    ReconcileStats reconcile(std::vector<Order> open_orders);
+
+    /**
+     * @brief Apply a decoded trade_updates event.
+     *
+     * @return false if the order has no id or the cache already held a newer state of it
+     */
+    bool apply(const TradeUpdate& update);
+
+    /**
+     * @brief Decode and apply the data of a trade_updates message, as passed to stream::Handler.
+     */
+    Status apply(const std::string& trade_update_json);
+
+    /**
+     * @brief Insert or update one order, e.g. from Client::getOrder().
+     *
+     * @return false if the order has no id or the cache already held a newer state of it
+     */
+    bool upsert(Order order);
+
+    /**
+     * @brief The current snapshot. Never null.
+     */
+    [[nodiscard]] std::shared_ptr<const Snapshot> snapshot() const;
+
+    /**
+     * @brief The order with the given id, or nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<const Order> find(std::string_view id) const;
+
+    /**
+     * @brief The order with the given client_order_id, or nullptr.
+     */
+    [[nodiscard]] std::shared_ptr<const Order> findByClientOrderId(std::string_view client_order_id) const;
+
+private:
+    class Update;
+
+    bool upsertInto(Update& next, Order&& order);
+    void evictClosed(Update& next);
+    void publish(Update& next);
+
+    std::size_t max_closed_;
+    std::mutex write_mutex_;
+    std::deque<std::string> closed_;  // Ids of terminal orders, oldest first
+    SnapshotPtr<Snapshot> current_;
+};
+
+}  // namespace alpaca::markets
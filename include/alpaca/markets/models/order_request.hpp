@@ -0,0 +1,127 @@
+#pragma once
+
+#include <alpaca/markets/models/decimal.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/status.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief One leg of a multi-leg (OrderClass::MultiLeg) options order.
+ */
+struct OrderLeg {
+    std::string symbol;
+    Decimal ratio_qty = 1;
+    OrderSide side = OrderSide::Buy;
+    std::optional<PositionIntent> position_intent;
+};
+
+/**
+ * @brief The parameters of one order to submit, as taken by Client::submitOrder().
+ *
+ * Quantities and prices are Decimals; a zero value means "not set" and is left out of the
+ * request body. Start from one of the factories and adjust with the with*() setters:
+ *
+ * @code{.cpp}
+ *   using namespace alpaca::markets;
+ *   auto request = OrderRequest::limit("AAPL", 100, OrderSide::Buy, *Decimal::parse("187.25"))
+ *                      .withTimeInForce(OrderTimeInForce::GoodUntilCanceled)
+ *                      .bracket(*Decimal::parse("195"), *Decimal::parse("180"));
+ * @endcode
+ *
+ * A request is plain data, so it can be validated, checked, kept in a batch and resubmitted
+ * without being rebuilt; render() writes its JSON body straight into a reusable buffer.
+ */
+struct OrderRequest {
+    /// The take-profit leg of a bracket, OCO or OTO order
+    struct TakeProfit {
+        Decimal limit_price;
+    };
+
+    /// The stop-loss leg of a bracket, OCO or OTO order; a stop-limit if limit_price is set
+    struct StopLoss {
+        Decimal stop_price;
+        Decimal limit_price;
+    };
+
+    std::string symbol;  // Empty for multi-leg orders
+    Decimal qty;         // Shares (fractional allowed), or the number of multi-leg units
+    Decimal notional;    // Dollar amount, instead of qty
+    OrderSide side = OrderSide::Buy;
+    OrderType type = OrderType::Market;
+    OrderTimeInForce tif = OrderTimeInForce::Day;
+    Decimal limit_price;
+    Decimal stop_price;
+    Decimal trail_price;
+    Decimal trail_percent;
+    bool extended_hours = false;
+    std::string client_order_id;
+    OrderClass order_class = OrderClass::Simple;
+    std::optional<PositionIntent> position_intent;
+    std::optional<TakeProfit> take_profit;
+    std::optional<StopLoss> stop_loss;
+    std::vector<OrderLeg> legs;
+
+    /// Longest client_order_id the API accepts
+    static constexpr std::size_t kMaxClientOrderIdLength = 128;
+
+    static OrderRequest market(std::string symbol, Decimal qty, OrderSide side);
+    static OrderRequest notionalMarket(std::string symbol, Decimal notional, OrderSide side);
+    static OrderRequest limit(std::string symbol, Decimal qty, OrderSide side, Decimal limit_price);
+    static OrderRequest stop(std::string symbol, Decimal qty, OrderSide side, Decimal stop_price);
+    static OrderRequest stopLimit(std::string symbol, Decimal qty, OrderSide side, Decimal stop_price,
+                                  Decimal limit_price);
+    static OrderRequest trailingStopPrice(std::string symbol, Decimal qty, OrderSide side, Decimal trail_price);
+    static OrderRequest trailingStopPercent(std::string symbol, Decimal qty, OrderSide side, Decimal trail_percent);
+
+    /**
+     * @brief A multi-leg options order for qty units of legs; a limit order if limit_price is set, else market.
+     */
+    static OrderRequest multiLeg(Decimal qty, std::vector<OrderLeg> legs, Decimal limit_price = {});
+
+    OrderRequest& withTimeInForce(OrderTimeInForce value);
+    OrderRequest& withClientOrderId(std::string value);
+    OrderRequest& withExtendedHours(bool value = true);
+    OrderRequest& withPositionIntent(PositionIntent value);
+    OrderRequest& withOrderClass(OrderClass value);
+    OrderRequest& withTakeProfit(Decimal limit);
+    OrderRequest& withStopLoss(Decimal stop, Decimal limit = {});
+
+    /**
+     * @brief Make this a bracket order with the given take-profit limit and stop-loss stop (and optional limit).
+     */
+    OrderRequest& bracket(Decimal take_profit_limit, Decimal stop_loss_stop, Decimal stop_loss_limit = {});
+
+    /**
+     * @brief Check the request is complete and consistent without sending it.
+     *
+     * Covers what can be known locally: a symbol (or legs), exactly one of qty and
+     * notional, the prices the order type needs, the legs the order class needs,
+     * and symbols and client_order_id that are printable ASCII without quotes or
+     * backslashes.
+     */
+    [[nodiscard]] Status validate() const;
+
+    /**
+     * @brief Validate and render the POST /v2/orders body into out, replacing its contents.
+     *
+     * Reuses out's capacity, so rendering into the same buffer repeatedly does not
+     * allocate once it is large enough.
+     */
+    Status render(std::string& out) const;
+
+    /**
+     * @brief Render as render(out) does, but with client_order_id in place of the request's own.
+     *
+     * Lets a generated id be sent without copying the request to store it.
+     */
+    Status render(std::string& out, std::string_view client_order_id) const;
+};
+
+}  // namespace alpaca::markets
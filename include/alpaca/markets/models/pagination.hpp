@@ -1,9 +1,20 @@
 #pragma once
 
+#include <alpaca/markets/models/crypto.hpp>
 #include <alpaca/markets/models/status.hpp>
 
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ranges>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -25,6 +36,9 @@ struct Page {
     [[nodiscard]] bool hasMore() const { return !next_page_token.empty(); }
 };
 
+template<typename T>
+class ItemRange;
+
 /**
  * @brief Iterator for paginated API endpoints.
  * 
@@ -51,6 +65,34 @@ struct Page {
  *   }
  * @endcode
  * 
+ * Or iterate items directly, one page in memory at a time:
+ * 
+ * @code{.cpp}
+ *   auto trades = makeTradesIterator(client, "AAPL", start, end);
+ *   auto range = trades.items();
+ *   for (const Trade& trade : range) {
+ *       process(trade);
+ *   }
+ *   if (!range.status().ok()) { ... }
+ * @endcode
+ * 
+ * With a non-zero prefetch depth, a background worker requests page N+1 as
+ * soon as page N's next_page_token is known and keeps up to that many pages
+ * buffered, so network latency overlaps with the caller processing the
+ * current page. The fetch function is then called from the worker thread;
+ * an exception it throws is rethrown from the next() call that reaches the
+ * failed page, just as it would be without prefetching.
+ * Destroying the iterator waits for any in-flight request to finish.
+ * 
+ * @code{.cpp}
+ *   auto trades = makeTradesIterator(client, "AAPL", start, end, 10000, 2);
+ *   while (trades.hasMore()) {
+ *       auto [status, page] = trades.next();  // Usually already downloaded
+ *       if (!status.ok()) break;
+ *       process(page.items);
+ *   }
+ * @endcode
+ * 
  * @tparam T The type of items being iterated
  */
 template<typename T>
@@ -62,13 +104,44 @@ public:
      * @brief Construct a PageIterator with a fetch function.
      * 
      * @param fetch_func Function that fetches a page given a page token
+     * @param prefetch_depth Number of pages to fetch ahead on a background thread (0 fetches on demand)
      */
-    explicit PageIterator(FetchFunc fetch_func) 
-        : fetch_func_(std::move(fetch_func)), exhausted_(false) {}
+    explicit PageIterator(FetchFunc fetch_func, std::size_t prefetch_depth = 0)
+        : fetch_func_(std::move(fetch_func)), prefetch_depth_(prefetch_depth), exhausted_(false) {}
+
+    /**
+     * @brief Copy the position in the pagination, without the background worker.
+     *
+     * A prefetching copy starts its own worker from the current page when it is
+     * first advanced, so pages the original had buffered are requested again.
+     */
+    PageIterator(const PageIterator& other)
+        : fetch_func_(other.fetch_func_),
+          prefetch_depth_(other.prefetch_depth_),
+          current_page_token_(other.current_page_token_),
+          exhausted_(other.exhausted_) {}
+
+    PageIterator& operator=(const PageIterator& other) {
+        if (this != &other) {
+            prefetcher_.reset();
+            fetch_func_ = other.fetch_func_;
+            prefetch_depth_ = other.prefetch_depth_;
+            current_page_token_ = other.current_page_token_;
+            exhausted_ = other.exhausted_;
+        }
+        return *this;
+    }
+
+    PageIterator(PageIterator&&) noexcept = default;
+    PageIterator& operator=(PageIterator&&) noexcept = default;
+    ~PageIterator() = default;
 
     /**
      * @brief Get the next page of results.
      * 
+     * After an error, or an exception thrown by the fetch function, the
+     * iterator stays at the failed page, so calling next() again retries it.
+     * 
      * @return Status and Page containing items and next_page_token
      */
     std::pair<Status, Page<T>> next() {
@@ -76,8 +149,10 @@ public:
             return std::make_pair(Status(1, "Iterator exhausted"), Page<T>{});
         }
         
-        auto [status, page] = fetch_func_(current_page_token_);
+        auto [status, page] = fetchPage();
         if (!status.ok()) {
+            // The worker stops at an error; a retry starts a new one from the failed page
+            prefetcher_.reset();
             return std::make_pair(status, Page<T>{});
         }
         
@@ -86,7 +161,7 @@ public:
             exhausted_ = true;
         }
         
-        return std::make_pair(Status(), page);
+        return std::make_pair(Status(), std::move(page));
     }
 
     /**
@@ -96,33 +171,328 @@ public:
         return !exhausted_;
     }
 
+    /**
+     * @brief A lazy range over the remaining items, fetching pages as iteration reaches them.
+     * 
+     * Only one page is held at a time. Check ItemRange::status() after the
+     * loop to tell the end of the data from an error.
+     */
+    ItemRange<T> items() {
+        return ItemRange<T>(*this);
+    }
+
     /**
      * @brief Collect all remaining items into a single vector.
      * 
-     * Warning: This may use significant memory for large result sets.
+     * Items are moved out of each page; the first page's buffer is adopted
+     * without copying. Pass the expected total (e.g. rows per day times days)
+     * to allocate once up front.
+     * 
+     * Warning: This may use significant memory for large result sets; see
+     * collectInto() to stream pages into a columnar sink instead.
      * 
+     * @param expected_items Capacity to reserve before the first page (0 for none)
      * @return Status and vector of all items
      */
-    std::pair<Status, std::vector<T>> collectAll() {
+    std::pair<Status, std::vector<T>> collectAll(std::size_t expected_items = 0) {
         std::vector<T> all_items;
+        all_items.reserve(expected_items);
         
         while (hasMore()) {
             auto [status, page] = next();
             if (!status.ok()) {
-                return std::make_pair(status, all_items);
+                return std::make_pair(status, std::move(all_items));
+            }
+            if (all_items.empty() && page.items.capacity() >= expected_items) {
+                all_items = std::move(page.items);
+            } else {
+                all_items.insert(all_items.end(), std::make_move_iterator(page.items.begin()),
+                                 std::make_move_iterator(page.items.end()));
             }
-            all_items.insert(all_items.end(), page.items.begin(), page.items.end());
         }
         
-        return std::make_pair(Status(), all_items);
+        return std::make_pair(Status(), std::move(all_items));
+    }
+
+    /**
+     * @brief Stream all remaining pages into a caller-provided sink.
+     * 
+     * The sink receives each page's items as an rvalue through
+     * `sink.append(std::vector<T>&&)`, so it can scatter them into columns
+     * without ever holding the whole result as a std::vector<T>. If the sink
+     * has `reserve(std::size_t)`, it is called first with expected_items.
+     * 
+     * @code{.cpp}
+     *   TradeColumns columns;
+     *   Status status = makeTradesIterator(client, "AAPL", start, end, 10000).collectInto(columns, 5'000'000);
+     * @endcode
+     * 
+     * @return the first error, or OK once every page has been appended
+     */
+    template<typename Sink>
+    Status collectInto(Sink& sink, std::size_t expected_items = 0) {
+        if constexpr (requires { sink.reserve(expected_items); }) {
+            if (expected_items > 0) {
+                sink.reserve(expected_items);
+            }
+        }
+        while (hasMore()) {
+            auto [status, page] = next();
+            if (!status.ok()) {
+                return status;
+            }
+            sink.append(std::move(page.items));
+        }
+        return Status();
     }
 
 private:
+    /**
+     * @brief Background worker which follows next_page_token ahead of the caller.
+     */
+    class Prefetcher {
+    public:
+        Prefetcher(FetchFunc fetch_func, std::string page_token, std::size_t depth)
+            : fetch_func_(std::move(fetch_func)), depth_(depth), worker_([this, token = std::move(page_token)] {
+                  run(token);
+              }) {}
+
+        Prefetcher(const Prefetcher&) = delete;
+        Prefetcher& operator=(const Prefetcher&) = delete;
+
+        ~Prefetcher() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopped_ = true;
+            }
+            space_.notify_all();
+            worker_.join();
+        }
+
+        /**
+         * @brief Take the next page, or rethrow the exception that stopped the worker once its pages are taken.
+         */
+        std::pair<Status, Page<T>> pop() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this] { return !pages_.empty() || error_; });
+            if (pages_.empty()) {
+                std::rethrow_exception(error_);
+            }
+            auto result = std::move(pages_.front());
+            pages_.pop_front();
+            lock.unlock();
+            space_.notify_one();
+            return result;
+        }
+
+    private:
+        void run(std::string page_token) {
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    space_.wait(lock, [this] { return stopped_ || pages_.size() < depth_; });
+                    if (stopped_) {
+                        return;
+                    }
+                }
+                std::pair<Status, Page<T>> result;
+                try {
+                    result = fetch_func_(page_token);
+                } catch (...) {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        error_ = std::current_exception();
+                    }
+                    ready_.notify_one();
+                    return;
+                }
+                bool last = !result.first.ok() || result.second.next_page_token.empty();
+                page_token = result.second.next_page_token;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    pages_.push_back(std::move(result));
+                }
+                ready_.notify_one();
+                if (last) {
+                    return;
+                }
+            }
+        }
+
+        FetchFunc fetch_func_;
+        std::size_t depth_;
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::condition_variable space_;
+        std::deque<std::pair<Status, Page<T>>> pages_;
+        std::exception_ptr error_;
+        bool stopped_ = false;
+        std::thread worker_;  // Declared last so it starts after the state above is initialized
+    };
+
+    std::pair<Status, Page<T>> fetchPage() {
+        if (prefetch_depth_ == 0) {
+            return fetch_func_(current_page_token_);
+        }
+        if (!prefetcher_) {
+            prefetcher_ = std::make_unique<Prefetcher>(fetch_func_, current_page_token_, prefetch_depth_);
+        }
+        try {
+            return prefetcher_->pop();
+        } catch (...) {
+            // As after an error Status, a retry starts a new worker from the failed page
+            prefetcher_.reset();
+            throw;
+        }
+    }
+
     FetchFunc fetch_func_;
+    std::size_t prefetch_depth_;
     std::string current_page_token_;
     bool exhausted_;
+    std::unique_ptr<Prefetcher> prefetcher_;
 };
 
+/**
+ * @brief An input range over the items of a PageIterator, usable with range-for and std::ranges.
+ * 
+ * Holds the current page only; references to items stay valid until the
+ * iterator is advanced past the end of their page. The range must not be
+ * moved once iteration has started.
+ * 
+ * @code{.cpp}
+ *   for (const Bar& bar : bars.items() | std::views::take(100)) { ... }
+ * @endcode
+ */
+template<typename T>
+class ItemRange : public std::ranges::view_interface<ItemRange<T>> {
+public:
+    class iterator {
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+
+        iterator() = default;
+        explicit iterator(ItemRange* range) : range_(range) {}
+
+        T& operator*() const { return range_->page_.items[range_->index_]; }
+
+        iterator& operator++() {
+            range_->advance();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) { return it.atEnd(); }
+
+    private:
+        bool atEnd() const { return range_ == nullptr || range_->done_; }
+
+        ItemRange* range_ = nullptr;
+    };
+
+    ItemRange() = default;
+    explicit ItemRange(PageIterator<T>& pages) : pages_(&pages) {}
+
+    iterator begin() {
+        if (!started_) {
+            started_ = true;
+            load();
+        }
+        return iterator(this);
+    }
+
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+    /**
+     * @brief The error that ended iteration early, or OK.
+     */
+    [[nodiscard]] const Status& status() const { return status_; }
+
+private:
+    void advance() {
+        if (++index_ >= page_.items.size()) {
+            load();
+        }
+    }
+
+    // Skips empty pages so that a valid iterator always points at an item
+    void load() {
+        index_ = 0;
+        page_.items.clear();
+        while (page_.items.empty()) {
+            if (pages_ == nullptr || !pages_->hasMore()) {
+                done_ = true;
+                return;
+            }
+            auto [status, page] = pages_->next();
+            if (!status.ok()) {
+                status_ = status;
+                done_ = true;
+                return;
+            }
+            page_ = std::move(page);
+        }
+    }
+
+    PageIterator<T>* pages_ = nullptr;
+    Page<T> page_;
+    std::size_t index_ = 0;
+    bool started_ = false;
+    bool done_ = false;
+    Status status_;
+};
+
+/**
+ * @brief An item from a multi-symbol endpoint, tagged with its symbol.
+ */
+template<typename T>
+struct SymbolItem {
+    std::string symbol;
+    T item;
+};
+
+/**
+ * @brief Move a response's item list and next_page_token into a Page.
+ */
+template<typename T>
+Page<T> takePage(std::vector<T>& items, std::string& next_page_token) {
+    Page<T> page;
+    page.items = std::move(items);
+    page.next_page_token = std::move(next_page_token);
+    return page;
+}
+
+/**
+ * @brief Flatten a "symbol -> items" response into a Page of SymbolItem, moving the items.
+ * 
+ * @param project Maps each symbol's value to the std::vector of items it holds
+ */
+template<typename Value, typename Project>
+auto takeSymbolPage(std::map<std::string, Value>& items, std::string& next_page_token, Project project) {
+    using Item = typename std::remove_reference_t<decltype(project(std::declval<Value&>()))>::value_type;
+    Page<SymbolItem<Item>> page;
+    std::size_t total = 0;
+    for (auto& [symbol, value] : items) {
+        total += project(value).size();
+    }
+    page.items.reserve(total);
+    for (auto& [symbol, value] : items) {
+        for (auto& item : project(value)) {
+            page.items.push_back(SymbolItem<Item>{symbol, std::move(item)});
+        }
+    }
+    page.next_page_token = std::move(next_page_token);
+    return page;
+}
+
+template<typename Item>
+Page<SymbolItem<Item>> takeSymbolPage(std::map<std::string, std::vector<Item>>& items, std::string& next_page_token) {
+    return takeSymbolPage(items, next_page_token, [](std::vector<Item>& v) -> std::vector<Item>& { return v; });
+}
+
 /**
  * @brief Helper to create a PageIterator for trades.
  * 
@@ -131,6 +501,7 @@ private:
  * @param start Start time
  * @param end End time
  * @param limit Items per page
+ * @param prefetch_depth Pages to fetch ahead on a background thread (0 fetches on demand)
  */
 template<typename Client>
 PageIterator<class Trade> makeTradesIterator(
@@ -138,14 +509,15 @@ PageIterator<class Trade> makeTradesIterator(
     const std::string& symbol,
     const std::string& start,
     const std::string& end,
-    unsigned int limit = 1000) {
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
     return PageIterator<Trade>([&client, symbol, start, end, limit](const std::string& page_token) {
         auto [status, result] = client.getTrades(symbol, start, end, limit, page_token);
         Page<Trade> page;
-        page.items = result.first;
-        page.next_page_token = result.second;
-        return std::make_pair(status, page);
-    });
+        page.items = std::move(result.first);
+        page.next_page_token = std::move(result.second);
+        return std::make_pair(status, std::move(page));
+    }, prefetch_depth);
 }
 
 /**
@@ -157,14 +529,210 @@ PageIterator<class Quote> makeQuotesIterator(
     const std::string& symbol,
     const std::string& start,
     const std::string& end,
-    unsigned int limit = 1000) {
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
     return PageIterator<Quote>([&client, symbol, start, end, limit](const std::string& page_token) {
         auto [status, result] = client.getQuotes(symbol, start, end, limit, page_token);
         Page<Quote> page;
-        page.items = result.first;
-        page.next_page_token = result.second;
-        return std::make_pair(status, page);
-    });
+        page.items = std::move(result.first);
+        page.next_page_token = std::move(result.second);
+        return std::make_pair(status, std::move(page));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for bars across one or more symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<class Bar>> makeBarsIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    const std::string& timeframe = "1Day",
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<Bar>>([&client, symbols, start, end, timeframe, limit](const std::string& page_token) {
+        auto [status, result] = client.getBars(symbols, start, end, timeframe, limit, page_token);
+        return std::make_pair(status, takeSymbolPage(result.bars, result.next_page_token));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for trades across multiple symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<class Trade>> makeMultiTradesIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<Trade>>([&client, symbols, start, end, limit](const std::string& page_token) {
+        auto [status, result] = client.getMultiTrades(symbols, start, end, limit, page_token);
+        return std::make_pair(status, takeSymbolPage(result.trades, result.next_page_token));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for quotes across multiple symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<class Quote>> makeMultiQuotesIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<Quote>>([&client, symbols, start, end, limit](const std::string& page_token) {
+        auto [status, result] = client.getMultiQuotes(symbols, start, end, limit, page_token);
+        return std::make_pair(status, takeSymbolPage(result.quotes, result.next_page_token));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for opening and closing auctions across symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<class Auction>> makeAuctionsIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<Auction>>([&client, symbols, start, end, limit](const std::string& page_token) {
+        auto [status, result] = client.getMultiAuctions(symbols, start, end, limit, page_token);
+        auto page = takeSymbolPage(result.auctions, result.next_page_token,
+                                   [](auto& symbol_auctions) -> auto& { return symbol_auctions.daily_auctions; });
+        return std::make_pair(status, std::move(page));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for market data corporate actions.
+ */
+template<typename Client>
+PageIterator<class CorporateAction> makeCorporateActionsIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols = {},
+    const std::vector<std::string>& types = {},
+    const std::string& start = "",
+    const std::string& end = "",
+    unsigned int limit = 1000,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<CorporateAction>([&client, symbols, types, start, end, limit](const std::string& page_token) {
+        auto [status, result] = client.getCorporateActions(symbols, types, start, end, limit, page_token);
+        return std::make_pair(status, takePage(result.corporate_actions, result.next_page_token));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for news articles.
+ */
+template<typename Client>
+PageIterator<class News> makeNewsIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols = {},
+    const std::string& start = "",
+    const std::string& end = "",
+    unsigned int limit = 50,
+    bool include_content = false,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<News>([&client, symbols, start, end, limit, include_content](const std::string& page_token) {
+        auto [status, result] = client.getNews(symbols, start, end, limit, page_token, include_content);
+        return std::make_pair(status, takePage(result.news, result.next_page_token));
+    }, prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for option contracts on the given underlyings.
+ * 
+ * @param underlying_symbols Comma-separated underlying symbols
+ * @param status Contract status filter (active, inactive)
+ * @param expiration_date_gte Minimum expiration date (YYYY-MM-DD)
+ * @param expiration_date_lte Maximum expiration date (YYYY-MM-DD)
+ */
+template<typename Client>
+PageIterator<class OptionContract> makeOptionContractsIterator(
+    const Client& client,
+    const std::string& underlying_symbols,
+    const std::string& status = "",
+    const std::string& expiration_date_gte = "",
+    const std::string& expiration_date_lte = "",
+    unsigned int limit = 100,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<OptionContract>(
+        [&client, underlying_symbols, status, expiration_date_gte, expiration_date_lte, limit](
+            const std::string& page_token) {
+            auto [s, result] = client.getOptionContracts(underlying_symbols, status, "", expiration_date_gte,
+                                                         expiration_date_lte, "", "", "", "", "", limit, page_token);
+            return std::make_pair(s, takePage(result.option_contracts, result.next_page_token));
+        },
+        prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for crypto bars across symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<CryptoBar>> makeCryptoBarsIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    const std::string& timeframe = "1Day",
+    unsigned int limit = 1000,
+    CryptoFeed feed = CryptoFeed::US,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<CryptoBar>>(
+        [&client, symbols, start, end, timeframe, limit, feed](const std::string& page_token) {
+            auto [status, result] = client.getCryptoBars(symbols, start, end, timeframe, limit, page_token, feed);
+            return std::make_pair(status, takeSymbolPage(result.bars, result.next_page_token));
+        },
+        prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for crypto trades across symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<CryptoTrade>> makeCryptoTradesIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    unsigned int limit = 1000,
+    CryptoFeed feed = CryptoFeed::US,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<CryptoTrade>>(
+        [&client, symbols, start, end, limit, feed](const std::string& page_token) {
+            auto [status, result] = client.getCryptoTrades(symbols, start, end, limit, page_token, feed);
+            return std::make_pair(status, takeSymbolPage(result.trades, result.next_page_token));
+        },
+        prefetch_depth);
+}
+
+/**
+ * @brief Helper to create a PageIterator for crypto quotes across symbols.
+ */
+template<typename Client>
+PageIterator<SymbolItem<CryptoQuote>> makeCryptoQuotesIterator(
+    const Client& client,
+    const std::vector<std::string>& symbols,
+    const std::string& start,
+    const std::string& end,
+    unsigned int limit = 1000,
+    CryptoFeed feed = CryptoFeed::US,
+    std::size_t prefetch_depth = 0) {
+    return PageIterator<SymbolItem<CryptoQuote>>(
+        [&client, symbols, start, end, limit, feed](const std::string& page_token) {
+            auto [status, result] = client.getCryptoQuotes(symbols, start, end, limit, page_token, feed);
+            return std::make_pair(status, takeSymbolPage(result.quotes, result.next_page_token));
+        },
+        prefetch_depth);
 }
 
 }  // namespace alpaca::markets
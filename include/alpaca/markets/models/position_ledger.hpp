@@ -0,0 +1,249 @@
+#pragma once
+
+#include <alpaca/markets/models/account.hpp>
+#include <alpaca/markets/models/position.hpp>
+#include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/snapshot_ptr.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/string_hash.hpp>
+#include <alpaca/markets/models/symbol_map.hpp>
+#include <alpaca/markets/models/trade.hpp>
+#include <alpaca/markets/models/trade_update.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A position held by PositionLedger, with numeric fields.
+ *
+ * Quantities are signed: short positions have a negative qty, cost_basis and
+ * market_value, matching the REST Position fields they are parsed from.
+ */
+struct LedgerPosition {
+    std::string symbol;
+    std::string asset_class;
+    double qty = 0.0;
+    double avg_entry_price = 0.0;
+    double cost_basis = 0.0;     // qty * avg_entry_price
+    double current_price = 0.0;  // Latest mark: REST current_price, then trades/quotes
+    double lastday_price = 0.0;
+    double market_value = 0.0;   // qty * current_price
+    double unrealized_pl = 0.0;  // market_value - cost_basis
+    double realized_pl = 0.0;    // From fills applied by this ledger
+    double opened_qty = 0.0;     // Part of qty opened by fills applied since startTradingDay(); same sign as qty
+};
+
+/**
+ * @brief The account balances held by PositionLedger, with numeric fields.
+ */
+struct LedgerAccount {
+    double cash = 0.0;
+    double buying_power = 0.0;
+    double equity = 0.0;  // cash + long_market_value + short_market_value
+    double long_market_value = 0.0;
+    double short_market_value = 0.0;  // Negative
+    double multiplier = 1.0;
+    bool trading_blocked = false;
+    int daytrade_count = 0;
+    bool pattern_day_trader = false;
+};
+
+/**
+ * @brief Positions and buying power kept current from fills and prices, for pre-trade checks without a network call.
+ *
+ * reconcile() loads Client::getAccount() and Client::getPositions() results.
+ * Between reconciliations the ledger applies each fill and partial_fill from
+ * trade_updates (quantity, average entry, realized P&L, cash and buying power)
+ * and marks positions to market from latest trades or quotes.
+ *
+ * Buying power between reconciliations is an estimate: opening fills consume
+ * their notional and closing fills release it. Margin requirements,
+ * day-trading rules and open-order holds are only reflected once reconcile()
+ * loads the account again.
+ *
+ * Fills keep arriving while reconcile()'s REST results are fetched. Take a
+ * token with beginReconcile() before fetching and pass it to reconcile(),
+ * which re-applies on top of the REST results every fill applied since the
+ * token. Fills from trade_updates are de-duplicated by execution_id, so a
+ * redelivered event is booked once.
+ *
+ * Reads go through immutable snapshots, as in OrderCache: every update
+ * builds a new Snapshot and publishes it through a SnapshotPtr, and readers
+ * copy the current pointer, so a pre-trade check sees positions and balances
+ * from the same instant and never waits for an update to be built.
+ *
+ * Numbers arrive as decimal strings. An empty field reads as 0, but a
+ * malformed one fails the whole update, leaving the ledger unchanged, rather
+ * than being booked as 0.
+ *
+ * @code{.cpp}
+ *   PositionLedger ledger;
+ *   auto token = ledger.beginReconcile();
+ *   auto [account_status, account] = client.getAccount();
+ *   auto [positions_status, positions] = client.getPositions();
+ *   ledger.reconcile(account, positions, token);
+ *
+ *   // trade_updates handler
+ *   TradeUpdate update;
+ *   if (update.fromJSON(data).ok()) ledger.applyFill(update);
+ *
+ *   // Any thread
+ *   auto snapshot = ledger.snapshot();
+ *   if (snapshot->account.buying_power < notional) { ... reject ... }
+ * @endcode
+ */
+class PositionLedger {
+public:
+    /**
+     * @brief An immutable view of positions and balances at one point in time.
+     */
+    struct Snapshot {
+        /**
+         * @brief The position in symbol, or nullptr if none was held since the last reconcile().
+         *
+         * Positions closed by fills stay listed with qty 0 (and their realized
+         * P&L) until the next reconcile().
+         */
+        [[nodiscard]] const LedgerPosition* find(std::string_view symbol) const;
+
+        /**
+         * @brief The signed quantity held in symbol (0 if flat).
+         */
+        [[nodiscard]] double qty(std::string_view symbol) const;
+
+        std::unordered_map<std::string, LedgerPosition, StringHash, std::equal_to<>> positions;
+        LedgerAccount account;
+        /// Incremented by every update
+        uint64_t version = 0;
+    };
+
+    /**
+     * @brief Marks when the REST fetch for a reconcile() began.
+     */
+    struct ReconcileToken {
+        uint64_t fills = 0;  // Fills applied before the fetch
+    };
+
+    PositionLedger();
+
+    PositionLedger(const PositionLedger&) = delete;
+    PositionLedger& operator=(const PositionLedger&) = delete;
+
+    /**
+     * @brief Start journaling fills, before fetching the account and positions for reconcile().
+     *
+     * Pass the token to reconcile(). Fills are journaled until every token taken
+     * has been passed to reconcile(), up to the most recent kMaxJournaledFills.
+     */
+    [[nodiscard]] ReconcileToken beginReconcile();
+
+    /**
+     * @brief Replace positions and balances with REST results fetched after beginReconcile() returned token.
+     *
+     * Fills applied since the token are applied again on top of the REST
+     * results, which may not include them yet. A fill the REST results already
+     * reflect moves cash and buying power twice until the next reconcile(); the
+     * position quantity is exact when the fill carried position_qty. Realized
+     * P&L accumulated by the ledger is kept for symbols still held.
+     *
+     * @return an error naming the first malformed number, or reporting that more
+     * than kMaxJournaledFills fills arrived during the fetch; either way nothing is changed
+     */
+    Status reconcile(const Account& account, const std::vector<Position>& positions, ReconcileToken token);
+
+    /**
+     * @brief Replace positions and balances with REST results, assuming no fill was applied while they were fetched.
+     *
+     * @return an error naming the first malformed number, in which case nothing is changed
+     */
+    Status reconcile(const Account& account, const std::vector<Position>& positions);
+
+    /**
+     * @brief Apply a fill or partial_fill event. Other events are ignored.
+     *
+     * When the event carries position_qty, the position's quantity is set to it,
+     * so a missed partial fill does not leave the quantity wrong. An event whose
+     * execution_id is among the last kRememberedExecutions applied is a
+     * redelivery and is ignored.
+     *
+     * @return an error if the event lacks a symbol, qty or price, has an unknown side or a malformed number
+     */
+    Status applyFill(const TradeUpdate& update);
+
+    /**
+     * @brief Apply a fill directly: positive qty buys, negative qty sells.
+     */
+    void applyFill(std::string_view symbol, double qty, double price);
+
+    /**
+     * @brief Mark one position to market. Symbols with no position are ignored.
+     */
+    void updatePrice(std::string_view symbol, double price);
+
+    /**
+     * @brief Mark positions to market from Client::getLatestTrades().
+     */
+    void updatePrices(const SymbolMap<Trade>& trades);
+
+    /**
+     * @brief Mark positions to market at the quote midpoint from Client::getLatestQuotes().
+     */
+    void updatePrices(const SymbolMap<Quote>& quotes);
+
+    /**
+     * @brief Forget which shares were opened today, at the start of a trading day.
+     *
+     * Every position's opened_qty returns to 0, so the shares held are treated
+     * as held overnight. A ledger created each day needn't call it.
+     */
+    void startTradingDay();
+
+    /**
+     * @brief The current snapshot. Never null.
+     */
+    [[nodiscard]] std::shared_ptr<const Snapshot> snapshot() const;
+
+    static constexpr std::size_t kMaxJournaledFills = 65536;
+    static constexpr std::size_t kRememberedExecutions = 16384;
+
+private:
+    struct JournaledFill {
+        uint64_t sequence = 0;
+        std::string symbol;
+        double qty = 0.0;
+        double price = 0.0;
+        std::optional<double> position_qty;
+    };
+
+    template <typename Update>
+    void publish(Update&& apply);
+    template <typename Update>
+    void publishLocked(Update&& apply);
+
+    Status reconcileSince(const Account& account, const std::vector<Position>& positions,
+                          std::optional<ReconcileToken> token);
+    void applyFillLocked(JournaledFill fill);
+
+    std::mutex write_mutex_;
+    SnapshotPtr<Snapshot> current_;
+    // Guarded by write_mutex_
+    uint64_t fills_ = 0;
+    std::size_t pending_reconciles_ = 0;
+    std::deque<JournaledFill> journal_;
+    std::unordered_set<std::string> executions_;
+    std::deque<std::string> execution_order_;  // Oldest first
+};
+
+}  // namespace alpaca::markets
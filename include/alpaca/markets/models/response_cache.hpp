@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A bounded, thread-safe cache of decoded responses with per-entry expiry.
+ *
+ * Entries hold the decoded value, so a hit costs one copy and no parsing.
+ * Expired entries are kept (until evicted) along with the response's ETag so
+ * that they can be revalidated with If-None-Match instead of re-downloaded.
+ * When full, the least recently used entry is evicted.
+ */
+class ResponseCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The result of a lookup.
+     */
+    template <typename T>
+    struct Lookup {
+        std::shared_ptr<const T> value;  // Cached value, possibly expired; null on a miss
+        bool fresh = false;              // True if the value has not expired
+        std::string etag;                // ETag of the cached response, if the server sent one
+    };
+
+    explicit ResponseCache(std::size_t max_entries) : max_entries_(max_entries) {}
+
+    /**
+     * @brief Look up key. Expired entries without an ETag are dropped and reported as misses.
+     */
+    template <typename T>
+    Lookup<T> lookup(const std::string& key) {
+        Lookup<T> result;
+        std::shared_ptr<const void> value;
+        if (lookupErased(key, typeid(T), value, result.fresh, result.etag)) {
+            result.value = std::static_pointer_cast<const T>(value);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Store a value for key, valid for ttl.
+     */
+    template <typename T>
+    void store(const std::string& key, T value, std::chrono::milliseconds ttl, std::string etag = "") {
+        storeErased(key, typeid(T), std::make_shared<const T>(std::move(value)), ttl, std::move(etag));
+    }
+
+    /**
+     * @brief Extend an entry's expiry after the server confirmed it is unchanged.
+     */
+    void renew(const std::string& key, std::chrono::milliseconds ttl);
+
+    /**
+     * @brief Remove every entry whose key starts with prefix (all entries if prefix is empty).
+     */
+    void invalidate(const std::string& prefix = "");
+
+    /**
+     * @brief The number of entries, fresh or expired.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    struct Entry {
+        std::type_index type;
+        std::shared_ptr<const void> value;
+        Clock::time_point expires;
+        std::string etag;
+        std::list<std::string>::iterator recency;
+    };
+
+    bool lookupErased(const std::string& key, std::type_index type, std::shared_ptr<const void>& value, bool& fresh,
+                      std::string& etag);
+    void storeErased(const std::string& key, std::type_index type, std::shared_ptr<const void> value,
+                     std::chrono::milliseconds ttl, std::string etag);
+
+    std::size_t max_entries_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> recency_;  // Most recently used first
+};
+
+}  // namespace alpaca::markets
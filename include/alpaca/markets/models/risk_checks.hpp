@@ -0,0 +1,189 @@
+#pragma once
+
+#include <alpaca/markets/models/asset.hpp>
+#include <alpaca/markets/models/asset_universe.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/position_ledger.hpp>
+#include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/status.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief The order a pre-trade check is asked about, with numeric fields.
+ */
+struct OrderIntent {
+    std::string symbol;
+    OrderSide side = OrderSide::Buy;
+    OrderType type = OrderType::Market;
+    double qty = 0.0;          // Shares; 0 for notional orders
+    double notional = 0.0;     // Dollar amount of notional orders
+    double limit_price = 0.0;  // 0 if none
+    double stop_price = 0.0;   // 0 if none
+
+    /**
+     * @brief Orders earlier in the same Client::submitOrders() batch that passed their checks; null outside a batch.
+     *
+     * Those orders are not in the ledger yet, so checks count them as if they had filled: maxPosition,
+     * shortable and patternDayTrader see the position they would leave, and buyingPower deducts what they use.
+     */
+    const std::vector<OrderIntent>* batch = nullptr;
+
+    /**
+     * @brief qty signed by side: positive for buys, negative for sells.
+     */
+    [[nodiscard]] double signedQty() const { return side == OrderSide::Buy ? qty : -qty; }
+};
+
+/**
+ * @brief Cached state a pre-trade check may read. Any member may be missing.
+ */
+struct RiskContext {
+    std::shared_ptr<const PositionLedger::Snapshot> ledger;
+    const Asset* asset = nullptr;
+    std::optional<Quote> quote;
+
+    /**
+     * @brief The price used to value the order: its limit price, else the quote
+     * midpoint, else the ledger's mark, else its stop price. 0 if none is known.
+     */
+    [[nodiscard]] double referencePrice(const OrderIntent& intent) const;
+
+    /**
+     * @brief The dollar value of the order at referencePrice() (or its notional).
+     */
+    [[nodiscard]] double orderNotional(const OrderIntent& intent) const;
+};
+
+/**
+ * @brief A single pre-trade check: an OK Status lets the order through, anything else rejects it.
+ */
+using RiskCheck = std::function<Status(const OrderIntent&, const RiskContext&)>;
+
+/**
+ * @brief Where RiskChecks reads cached state when building a RiskContext.
+ *
+ * The sources must outlive the RiskChecks. AssetUniverse is not synchronized;
+ * refresh it from the thread that submits orders, or not while orders are
+ * being checked.
+ */
+struct RiskSources {
+    const PositionLedger* ledger = nullptr;
+    const AssetUniverse* assets = nullptr;
+    /// Latest quote for a symbol, e.g. from a quote stream; nullopt if unknown
+    std::function<std::optional<Quote>(std::string_view symbol)> quote = nullptr;
+};
+
+/**
+ * @brief An in-process pre-trade check pipeline, evaluated before an order leaves the process.
+ *
+ * Checks run in the order they were added against state already in memory
+ * (PositionLedger snapshot, AssetUniverse, latest quotes), so evaluating the
+ * pipeline costs microseconds instead of the round trip a server-side 403/422
+ * rejection costs. The first failing check rejects the order.
+ *
+ * Install it on a Client with Client::setPreTradeCheck() to run it inside
+ * submitOrder() and submitNotionalOrder().
+ *
+ * @code{.cpp}
+ *   RiskChecks checks({&ledger, &universe, [&](std::string_view s) { return latestQuote(s); }});
+ *   checks.add("max_notional", risk::maxNotional(50000))
+ *         .add("max_position", risk::maxPosition(1000))
+ *         .add("price_band", risk::priceBand(0.05))
+ *         .add("pattern_day_trader", risk::patternDayTrader())
+ *         .add("shortable", risk::shortable());
+ *   client.setPreTradeCheck([&](const OrderIntent& intent) { return checks.evaluate(intent); });
+ * @endcode
+ */
+class RiskChecks {
+public:
+    explicit RiskChecks(RiskSources sources = {});
+
+    /**
+     * @brief Append a named check to the pipeline.
+     */
+    RiskChecks& add(std::string name, RiskCheck check);
+
+    /**
+     * @brief Run every check against state read from the sources.
+     *
+     * @return OK, or the first rejection as "Pre-trade check <name> rejected order: <reason>"
+     */
+    [[nodiscard]] Status evaluate(const OrderIntent& intent) const;
+
+    /**
+     * @brief Run every check against an explicit context.
+     */
+    [[nodiscard]] Status evaluate(const OrderIntent& intent, const RiskContext& context) const;
+
+    /**
+     * @brief The context evaluate() builds for intent.
+     */
+    [[nodiscard]] RiskContext context(const OrderIntent& intent) const;
+
+    [[nodiscard]] std::size_t size() const { return checks_.size(); }
+
+private:
+    RiskSources sources_;
+    std::vector<std::pair<std::string, RiskCheck>> checks_;
+};
+
+namespace risk {
+
+/**
+ * @brief Reject orders worth more than max_notional dollars, and orders with no price to value them by.
+ */
+RiskCheck maxNotional(double max_notional);
+
+/**
+ * @brief Reject orders that would leave more than max_qty shares held, long or short.
+ */
+RiskCheck maxPosition(double max_qty);
+
+/**
+ * @brief Reject limit and stop prices more than max_deviation (a fraction, e.g. 0.05) away from the quote midpoint.
+ *
+ * Orders are let through when no quote is known.
+ */
+RiskCheck priceBand(double max_deviation);
+
+/**
+ * @brief Reject orders that would complete a day trade once the account has used its day trades.
+ *
+ * Applies to accounts below min_equity with daytrade_count >= max_day_trades
+ * that are not already flagged as pattern day traders. An order that reduces
+ * a position is rejected only if part of the position was opened today: by
+ * fills the ledger applied since PositionLedger::startTradingDay() (see
+ * LedgerPosition::opened_qty), or by earlier orders of the batch. Closing a
+ * position held overnight is let through.
+ */
+RiskCheck patternDayTrader(int max_day_trades = 3, double min_equity = 25000.0);
+
+/**
+ * @brief Reject sells that open or extend a short position unless the asset is shortable and easy to borrow.
+ *
+ * Notional orders can't open a short position, so a notional sell is rejected
+ * unless the long position covers it at RiskContext::referencePrice(), or if
+ * no price is known to size it. Orders are let through when the asset is unknown.
+ */
+RiskCheck shortable();
+
+/**
+ * @brief Reject orders that open exposure worth more than the estimated buying power.
+ *
+ * Within a batch, the buying power used by earlier orders is deducted first. Those orders are valued
+ * like this one, except that only this order's symbol has a quote.
+ */
+RiskCheck buyingPower();
+
+}  // namespace risk
+
+}  // namespace alpaca::markets
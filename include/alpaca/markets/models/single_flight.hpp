@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace alpaca::markets {
+
+/**
+ * @brief Collapses identical concurrent calls into one.
+ *
+ * The first caller for a key runs the function; callers arriving with the same
+ * key while it is in flight wait for and receive a copy of its result instead
+ * of running it again. Once the call completes the key is released, so later
+ * callers start a fresh call — nothing is cached.
+ *
+ * @code{.cpp}
+ *   SingleFlight<std::string> flights;
+ *   // From many threads:
+ *   std::string body = flights.run("GET /v2/clock", [] { return fetchClock(); });
+ * @endcode
+ */
+template <typename V>
+class SingleFlight {
+public:
+    /**
+     * @brief Run fn() for key, or wait for the call already in flight for key.
+     *
+     * @param key Identifies equivalent calls
+     * @param fn Callable returning V; an exception it throws is rethrown to every waiter
+     * @param shared Set to true if this caller received another caller's result
+     */
+    template <typename F>
+    V run(const std::string& key, F&& fn, bool* shared = nullptr) {
+        std::promise<V> promise;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (auto it = calls_.find(key); it != calls_.end()) {
+                std::shared_future<V> pending = it->second;
+                lock.unlock();
+                if (shared != nullptr) {
+                    *shared = true;
+                }
+                return pending.get();
+            }
+            calls_.emplace(key, promise.get_future().share());
+        }
+        if (shared != nullptr) {
+            *shared = false;
+        }
+
+        try {
+            V value = fn();
+            release(key);
+            promise.set_value(value);
+            return value;
+        } catch (...) {
+            release(key);
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+    }
+
+    /**
+     * @brief The number of distinct keys currently in flight.
+     */
+    [[nodiscard]] std::size_t inFlight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return calls_.size();
+    }
+
+private:
+    void release(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        calls_.erase(key);
+    }
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_future<V>> calls_;
+};
+
+}  // namespace alpaca::markets
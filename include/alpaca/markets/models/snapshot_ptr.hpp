@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace alpaca::markets {
+
+/**
+ * @brief The current immutable snapshot of a cache such as OrderCache or PositionLedger.
+ *
+ * Writers build a new snapshot and publish it with store(); readers load() the
+ * current one and keep it alive for as long as they hold it. The pointer is a
+ * std::atomic<std::shared_ptr>, so readers take no mutex and never wait for a
+ * snapshot to be built; a load contends only with the pointer exchange itself,
+ * which is as lock-free as the standard library's implementation. Writers must
+ * serialize among themselves.
+ *
+ * Snapshots may share structure: OrderCache keeps its orders in immutable
+ * shards, and an update copies only the shard it changes.
+ */
+template <typename T>
+class SnapshotPtr {
+public:
+    explicit SnapshotPtr(std::shared_ptr<const T> initial) : current_(std::move(initial)) {}
+
+    SnapshotPtr(const SnapshotPtr&) = delete;
+    SnapshotPtr& operator=(const SnapshotPtr&) = delete;
+
+    [[nodiscard]] std::shared_ptr<const T> load() const {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return current_.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+#endif
+    }
+
+    /**
+     * @brief Publish next. The replaced snapshot is freed once no reader holds it.
+     */
+    void store(std::shared_ptr<const T> next) {
+        // The replaced snapshot may be the last reference; it is released here, after the exchange
+#ifdef __cpp_lib_atomic_shared_ptr
+        std::shared_ptr<const T> previous = current_.exchange(std::move(next), std::memory_order_acq_rel);
+#else
+        std::shared_ptr<const T> previous =
+            std::atomic_exchange_explicit(&current_, std::move(next), std::memory_order_acq_rel);
+#endif
+    }
+
+private:
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<std::shared_ptr<const T>> current_;
+#else
+    // Standard libraries without std::atomic<std::shared_ptr> provide the atomic_* shared_ptr overloads
+    std::shared_ptr<const T> current_;
+#endif
+};
+
+}  // namespace alpaca::markets
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A transparent string hash, so unordered maps keyed by std::string can be searched with a string_view.
+ *
+ * Use it with std::equal_to<>:
+ *
+ * @code{.cpp}
+ *   std::unordered_map<std::string, Order, StringHash, std::equal_to<>> orders;
+ *   orders.find(std::string_view("order-1"));  // No std::string is built
+ * @endcode
+ */
+struct StringHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+};
+
+}  // namespace alpaca::markets
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <alpaca/markets/models/symbol_map.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A dense identifier for an interned ticker symbol.
+ *
+ * Ids are assigned from 0 in interning order, so they can index flat arrays.
+ */
+using SymbolId = uint32_t;
+
+/**
+ * @brief The id returned when looking up a symbol which has not been interned.
+ */
+inline constexpr SymbolId kInvalidSymbolId = std::numeric_limits<SymbolId>::max();
+
+/**
+ * @brief A thread-safe table mapping ticker symbols to dense 32-bit ids.
+ *
+ * Symbols are never removed, so an id and the name it refers to stay valid for
+ * the lifetime of the table.
+ *
+ * @code{.cpp}
+ *   alpaca::markets::SymbolId aapl = alpaca::markets::internSymbol("AAPL");
+ *   std::vector<double> last_price(alpaca::markets::SymbolTable::global().size());
+ *   last_price[aapl] = 187.5;
+ * @endcode
+ */
+class SymbolTable {
+public:
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * @brief The process-wide table used by internSymbol() and symbolName().
+     */
+    static SymbolTable& global();
+
+    /**
+     * @brief Get the id for a symbol, assigning the next id if it hasn't been seen before.
+     */
+    SymbolId intern(std::string_view symbol);
+
+    /**
+     * @brief Get the id for a symbol without interning it.
+     *
+     * @return the symbol's id, or kInvalidSymbolId if it hasn't been interned.
+     */
+    [[nodiscard]] SymbolId find(std::string_view symbol) const;
+
+    /**
+     * @brief Get the symbol for an id.
+     *
+     * @return the symbol, or an empty view if the id wasn't assigned by this table.
+     */
+    [[nodiscard]] std::string_view name(SymbolId id) const;
+
+    /**
+     * @brief The number of interned symbols; every id is less than this.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::deque<std::string> names_;  // Indexed by id; deque keeps the views in ids_ valid as it grows
+    std::unordered_map<std::string_view, SymbolId> ids_;
+};
+
+/**
+ * @brief Intern a symbol in the process-wide table.
+ */
+SymbolId internSymbol(std::string_view symbol);
+
+/**
+ * @brief Get the symbol for an id from the process-wide table.
+ */
+std::string_view symbolName(SymbolId id);
+
+namespace detail {
+
+template <typename T, typename Results>
+std::vector<std::pair<SymbolId, T>> indexEntries(Results& results, SymbolTable& table) {
+    std::vector<std::pair<SymbolId, T>> indexed;
+    indexed.reserve(results.size());
+    for (auto& [symbol, value] : results) {
+        indexed.emplace_back(table.intern(symbol), std::move(value));
+    }
+    results.clear();
+    std::sort(indexed.begin(), indexed.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    return indexed;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Re-key a multi-symbol result by symbol id.
+ *
+ * Moves the values out of a result map such as Bars::bars or Snapshots::snapshots
+ * into a vector sorted by id, interning each symbol on the way.
+ */
+template <typename T>
+std::vector<std::pair<SymbolId, T>> indexBySymbol(std::map<std::string, T>&& results,
+                                                  SymbolTable& table = SymbolTable::global()) {
+    return detail::indexEntries<T>(results, table);
+}
+
+/**
+ * @brief Re-key a SymbolMap, as returned by getLatestTrades() or getSnapshots(), by symbol id.
+ */
+template <typename T>
+std::vector<std::pair<SymbolId, T>> indexBySymbol(SymbolMap<T>&& results, SymbolTable& table = SymbolTable::global()) {
+    return detail::indexEntries<T>(results, table);
+}
+
+}  // namespace alpaca::markets
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace alpaca::markets {
+
+/**
+ * @brief A map from symbol to value stored as a sorted vector.
+ *
+ * Returned by the multi-symbol "latest" and snapshot APIs in place of
+ * std::map: entries live in one contiguous allocation, lookups are a binary
+ * search, and iteration visits symbols in the same sorted order as std::map.
+ * Lookups accept any string-like key without constructing a std::string.
+ * It converts implicitly to std::map for code written against the old return type.
+ *
+ * @code{.cpp}
+ *   auto [status, trades] = client.getLatestTrades({"AAPL", "MSFT"});
+ *   if (auto it = trades.find("AAPL"); it != trades.end()) {
+ *     std::cout << it->second.price << std::endl;
+ *   }
+ *   for (const auto& [symbol, trade] : trades) { ... }
+ * @endcode
+ */
+template <typename T>
+class SymbolMap {
+public:
+    using key_type = std::string;
+    using mapped_type = T;
+    using value_type = std::pair<std::string, T>;
+    using size_type = std::size_t;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    SymbolMap() = default;
+
+    /**
+     * @brief Build from entries in any order, sorting once.
+     *
+     * If a symbol appears more than once, the last entry wins.
+     */
+    explicit SymbolMap(std::vector<value_type> entries) : entries_(std::move(entries)) {
+        std::stable_sort(entries_.begin(), entries_.end(),
+                         [](const value_type& a, const value_type& b) { return a.first < b.first; });
+        // Keep the last of each run of equal symbols
+        auto out = entries_.begin();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+            auto next = std::next(it);
+            if (next != entries_.end() && next->first == it->first) {
+                continue;
+            }
+            if (out != it) {
+                *out = std::move(*it);
+            }
+            ++out;
+        }
+        entries_.erase(out, entries_.end());
+    }
+
+    iterator begin() { return entries_.begin(); }
+    iterator end() { return entries_.end(); }
+    const_iterator begin() const { return entries_.begin(); }
+    const_iterator end() const { return entries_.end(); }
+
+    [[nodiscard]] size_type size() const { return entries_.size(); }
+    [[nodiscard]] bool empty() const { return entries_.empty(); }
+    void reserve(size_type n) { entries_.reserve(n); }
+    void clear() { entries_.clear(); }
+
+    iterator find(std::string_view symbol) {
+        auto it = lowerBound(symbol);
+        return it != entries_.end() && it->first == symbol ? it : entries_.end();
+    }
+
+    const_iterator find(std::string_view symbol) const {
+        return const_cast<SymbolMap*>(this)->find(symbol);
+    }
+
+    [[nodiscard]] bool contains(std::string_view symbol) const { return find(symbol) != end(); }
+    [[nodiscard]] size_type count(std::string_view symbol) const { return contains(symbol) ? 1 : 0; }
+
+    T& at(std::string_view symbol) {
+        auto it = find(symbol);
+        if (it == entries_.end()) {
+            throw std::out_of_range("SymbolMap::at: symbol not found");
+        }
+        return it->second;
+    }
+
+    const T& at(std::string_view symbol) const { return const_cast<SymbolMap*>(this)->at(symbol); }
+
+    /**
+     * @brief Get the value for a symbol, inserting a default value if it is missing.
+     *
+     * Inserting shifts later entries; build large maps through the vector constructor instead.
+     */
+    T& operator[](std::string_view symbol) {
+        auto it = lowerBound(symbol);
+        if (it == entries_.end() || it->first != symbol) {
+            it = entries_.emplace(it, std::string(symbol), T{});
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Convert to the std::map these APIs returned before, for callers that still store one.
+     */
+    operator std::map<std::string, T>() const& { return std::map<std::string, T>(entries_.begin(), entries_.end()); }
+
+    operator std::map<std::string, T>() && {
+        std::map<std::string, T> result;
+        for (auto& entry : entries_) {
+            // Entries are sorted, so every insertion goes at the end
+            result.emplace_hint(result.end(), std::move(entry.first), std::move(entry.second));
+        }
+        entries_.clear();
+        return result;
+    }
+
+private:
+    iterator lowerBound(std::string_view symbol) {
+        return std::lower_bound(entries_.begin(), entries_.end(), symbol,
+                                [](const value_type& entry, std::string_view key) { return entry.first < key; });
+    }
+
+    std::vector<value_type> entries_;
+};
+
+}  // namespace alpaca::markets
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/status.hpp>
+
+#include <string>
+
+namespace alpaca::markets {
+
+/**
+ * @brief An event from the trade_updates stream: an order changed state.
+ *
+ * For more information on the events, see:
+ * https://docs.alpaca.markets/docs/websocket-streaming#order-updates
+ */
+class TradeUpdate {
+public:
+    /**
+     * @brief A method for deserializing JSON into the current object state.
+     *
+     * @param json The JSON string, i.e. the "data" object of a trade_updates message
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(const std::string& json);
+
+    /**
+     * @brief Deserialize a JSON buffer the caller no longer needs, parsing it in place.
+     *
+     * Avoids copying string values into an intermediate document; the buffer is
+     * used as scratch space and is left in an unspecified state.
+     *
+     * @param json The JSON string
+     *
+     * @return a Status indicating the success or failure of the operation.
+     */
+    Status fromJSON(std::string&& json);
+
+public:
+    std::string event;  // new, fill, partial_fill, canceled, expired, replaced, rejected, ...
+    std::string execution_id;
+    Order order;  // The order's state after the event
+    std::string position_qty;  // fill and partial_fill only
+    std::string price;         // fill and partial_fill only
+    std::string qty;           // fill and partial_fill only
+    std::string timestamp;
+};
+
+}  // namespace alpaca::markets
@@ -6,24 +6,38 @@
 #include <alpaca/markets/models/auction.hpp>
 #include <alpaca/markets/models/bars.hpp>
 #include <alpaca/markets/models/calendar.hpp>
+#include <alpaca/markets/models/client_order_id.hpp>
 #include <alpaca/markets/models/clock.hpp>
+#include <alpaca/markets/models/compact_order.hpp>
 #include <alpaca/markets/models/corporate_action.hpp>
 #include <alpaca/markets/models/crypto.hpp>
+#include <alpaca/markets/models/history.hpp>
 #include <alpaca/markets/models/multi_quote.hpp>
 #include <alpaca/markets/models/multi_trade.hpp>
 #include <alpaca/markets/models/news.hpp>
 #include <alpaca/markets/models/option.hpp>
 #include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/order_cache.hpp>
+#include <alpaca/markets/models/order_request.hpp>
 #include <alpaca/markets/models/portfolio.hpp>
 #include <alpaca/markets/models/position.hpp>
 #include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/response_cache.hpp>
+#include <alpaca/markets/models/risk_checks.hpp>
+#include <alpaca/markets/models/single_flight.hpp>
 #include <alpaca/markets/models/snapshot.hpp>
 #include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/symbol_map.hpp>
 #include <alpaca/markets/models/trade.hpp>
 #include <alpaca/markets/models/watchlist.hpp>
 #include <alpaca/markets/rest/config.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <map>
+#include <memory>
+#include <span>
 #include <string>
 #include <utility>
 #include <variant>
@@ -31,6 +45,34 @@
 
 namespace alpaca::markets {
 
+namespace detail {
+class RateLimiter;
+struct SharedResponse;
+}  // namespace detail
+
+/**
+ * @brief Per-order outcomes of Client::submitOrders() or Client::cancelOrdersById().
+ *
+ * results[i] belongs to the i-th input, whether or not the others succeeded.
+ */
+struct OrderBatchResult {
+    std::vector<std::pair<Status, Order>> results;
+
+    /**
+     * The HTTP status of the request behind results[i]: the last POST of a submission, the DELETE of a
+     * cancellation (204 when accepted). 0 if nothing was sent or no response arrived.
+     */
+    std::vector<int> http_statuses;
+
+    std::size_t succeeded = 0;
+    std::size_t failed = 0;
+
+    /// Wall-clock time from the first request sent to the last response received
+    std::chrono::nanoseconds elapsed{0};
+
+    [[nodiscard]] bool ok() const { return failed == 0; }
+};
+
 /**
  * @brief The API client object for interacting with the Alpaca Trading API.
  *
@@ -92,6 +134,17 @@ public:
                                                     OrderDirection direction = OrderDirection::Descending,
                                                     bool nested = false) const;
 
+    /**
+     * @brief Fetch submitted Alpaca orders as CompactOrders.
+     *
+     * Takes the same parameters as getOrders(), but decodes each order without
+     * allocating (enums, Decimals, int64 timestamps and inline strings), so the
+     * result vector is the only allocation. Nested legs are not decoded.
+     */
+    std::pair<Status, std::vector<CompactOrder>> getCompactOrders(
+        ActionStatus status = ActionStatus::Open, int limit = 50, const std::string& after = "",
+        const std::string& until = "", OrderDirection direction = OrderDirection::Descending) const;
+
     /**
      * @brief Fetch a specific Alpaca order.
      */
@@ -104,6 +157,10 @@ public:
 
     /**
      * @brief Submit an Alpaca order.
+     *
+     * Kept for existing callers; prefer submitOrder(const OrderRequest&), which takes
+     * fractional quantities, multi-leg orders and typed prices. The string prices are
+     * parsed as Decimals and an unparseable one fails the call without sending it.
      */
     std::pair<Status, Order> submitOrder(const std::string& symbol, int quantity, OrderSide side, OrderType type,
                                          OrderTimeInForce tif, const std::string& limit_price = "",
@@ -127,6 +184,33 @@ public:
                                                   bool extended_hours = false,
                                                   const std::string& client_order_id = "") const;
 
+    /**
+     * @brief Submit an Alpaca order described by an OrderRequest.
+     *
+     * The pre-trade check runs first, then the request is validated and rendered
+     * (OrderRequest::render()); either failing returns its Status without sending.
+     * A request without a client_order_id is sent with a generated one unless
+     * Environment::setGenerateClientOrderIds(false) was called.
+     * If the submission times out or fails with a 5xx, the order is looked up by
+     * client_order_id and only sent again if the server doesn't have it (see
+     * OrderSubmitConfig). If that does not settle the order's fate, the call
+     * fails and the returned Order holds only the client_order_id sent, for
+     * looking the order up or retrying with the same id.
+     */
+    std::pair<Status, Order> submitOrder(const OrderRequest& request) const;
+
+    /**
+     * @brief Submit many orders concurrently, returning each order's result in input order.
+     *
+     * Orders are sent by up to BatchConfig::max_concurrency workers, each reusing one keep-alive connection.
+     * The pre-trade check and OrderRequest::validate() run for every order on the calling thread before
+     * anything is sent; rejected orders are not sent and carry the rejection. One order failing does not stop
+     * the others. Each check is passed the orders accepted earlier in the batch (OrderIntent::batch), so limits
+     * apply to the batch as a whole rather than to each order against the same ledger snapshot. Requests are
+     * paced to BatchConfig::max_requests_per_minute.
+     */
+    OrderBatchResult submitOrders(std::span<const OrderRequest> requests) const;
+
     /**
      * @brief Replace an Alpaca order.
      */
@@ -136,14 +220,41 @@ public:
 
     /**
      * @brief Cancel all Alpaca orders.
+     *
+     * Returns the orders whose cancellation was accepted. If any order failed to cancel, the status is an
+     * error giving the number of failures and the first of them, and the accepted orders are still
+     * returned; use cancelAllOrders() for the outcome of every order.
      */
     std::pair<Status, std::vector<Order>> cancelOrders() const;
 
+    /**
+     * @brief Cancel all Alpaca orders, returning each order's outcome.
+     *
+     * One order failing to cancel, or an entry of the response that can't be decoded, is reported in its
+     * result without failing the others. If the bulk request gets no response within
+     * BatchConfig::cancel_all_timeout or fails with a 5xx, and BatchConfig::cancel_all_fallback is set, the
+     * open orders (from the OrderCache given to setOrderCache(), else every page of getOrders()) are
+     * cancelled by id concurrently instead, as cancelOrdersById(ids, false) does: their results carry only
+     * the order id. An order whose cancellation is rejected with an HTTP 422, as happens when the bulk request
+     * cancelled it after all, is fetched and counts as cancelled if its status is canceled or
+     * pending_cancel; its result keeps the 422 and carries the fetched order.
+     */
+    std::pair<Status, std::vector<OrderCancelResult>> cancelAllOrders() const;
+
     /**
      * @brief Cancel a specific Alpaca order.
      */
     std::pair<Status, Order> cancelOrder(const std::string& id) const;
 
+    /**
+     * @brief Cancel many orders concurrently, returning each cancellation's result in input order.
+     *
+     * Uses the same workers and connections as submitOrders(). As with cancelOrder(), an order the server
+     * accepted for cancellation is fetched to return its current state, unless fetch_cancelled is false;
+     * then its result holds an Order with only the id set, saving one request per order.
+     */
+    OrderBatchResult cancelOrdersById(std::span<const std::string> ids, bool fetch_cancelled = true) const;
+
     // ==================== Positions ====================
 
     /**
@@ -268,17 +379,17 @@ public:
      * @brief Fetch latest trades for multiple symbols.
      * 
      * Uses Market Data API v2.
-     * @return Map of symbol to LatestTrade
+     * @return Sorted map of symbol to LatestTrade
      */
-    std::pair<Status, std::map<std::string, Trade>> getLatestTrades(const std::vector<std::string>& symbols) const;
+    std::pair<Status, SymbolMap<Trade>> getLatestTrades(const std::vector<std::string>& symbols) const;
 
     /**
      * @brief Fetch latest quotes for multiple symbols.
      * 
      * Uses Market Data API v2.
-     * @return Map of symbol to Quote
+     * @return Sorted map of symbol to Quote
      */
-    std::pair<Status, std::map<std::string, Quote>> getLatestQuotes(const std::vector<std::string>& symbols) const;
+    std::pair<Status, SymbolMap<Quote>> getLatestQuotes(const std::vector<std::string>& symbols) const;
 
     // ==================== Corporate Actions ====================
 
@@ -356,9 +467,9 @@ public:
      * @brief Fetch market snapshots for multiple symbols.
      * 
      * Uses Market Data API v2.
-     * @return Map of symbol to Snapshot
+     * @return Sorted map of symbol to Snapshot
      */
-    std::pair<Status, std::map<std::string, Snapshot>> getSnapshots(const std::vector<std::string>& symbols) const;
+    std::pair<Status, SymbolMap<Snapshot>> getSnapshots(const std::vector<std::string>& symbols) const;
 
     // ==================== Market Data - Latest Bars ====================
 
@@ -373,9 +484,9 @@ public:
      * @brief Fetch latest bars for multiple symbols.
      * 
      * Uses Market Data API v2.
-     * @return Map of symbol to Bar
+     * @return Sorted map of symbol to Bar
      */
-    std::pair<Status, std::map<std::string, Bar>> getLatestBars(const std::vector<std::string>& symbols) const;
+    std::pair<Status, SymbolMap<Bar>> getLatestBars(const std::vector<std::string>& symbols) const;
 
     // ==================== Market Data - Historical Trades/Quotes ====================
 
@@ -415,6 +526,32 @@ public:
         unsigned int limit = 1000,
         const std::string& page_token = "") const;
 
+    /**
+     * @brief Download a symbol's trades over several time ranges concurrently; see downloadRanges().
+     *
+     * Up to ParallelDownloadConfig::max_concurrency workers each keep one connection to the data host and
+     * page through the next unclaimed range, within the config's requests_per_minute.
+     *
+     * @return the first error, or the trades of all ranges in timestamp order
+     */
+    std::pair<Status, std::vector<Trade>> downloadTrades(const std::string& symbol,
+                                                         const std::vector<TimeRange>& ranges,
+                                                         const ParallelDownloadConfig& config = {}) const;
+
+    /**
+     * @brief Download a symbol's quotes over several time ranges concurrently, as downloadTrades() does.
+     */
+    std::pair<Status, std::vector<Quote>> downloadQuotes(const std::string& symbol,
+                                                         const std::vector<TimeRange>& ranges,
+                                                         const ParallelDownloadConfig& config = {}) const;
+
+    /**
+     * @brief Download a symbol's bars over several time ranges concurrently, as downloadTrades() does.
+     */
+    std::pair<Status, std::vector<Bar>> downloadBars(const std::string& symbol, const std::vector<TimeRange>& ranges,
+                                                     const std::string& timeframe = "1Min",
+                                                     const ParallelDownloadConfig& config = {}) const;
+
     // ==================== Market Data - Multi-Symbol Historical ====================
 
     /**
@@ -558,9 +695,9 @@ public:
      * 
      * @param symbols Crypto symbols
      * @param feed Crypto feed
-     * @return Map of symbol to CryptoTrade
+     * @return Sorted map of symbol to CryptoTrade
      */
-    std::pair<Status, std::map<std::string, CryptoTrade>> getLatestCryptoTrades(
+    std::pair<Status, SymbolMap<CryptoTrade>> getLatestCryptoTrades(
         const std::vector<std::string>& symbols,
         CryptoFeed feed = CryptoFeed::US) const;
 
@@ -574,7 +711,7 @@ public:
     /**
      * @brief Fetch latest crypto quotes for multiple symbols.
      */
-    std::pair<Status, std::map<std::string, CryptoQuote>> getLatestCryptoQuotes(
+    std::pair<Status, SymbolMap<CryptoQuote>> getLatestCryptoQuotes(
         const std::vector<std::string>& symbols,
         CryptoFeed feed = CryptoFeed::US) const;
 
@@ -588,7 +725,7 @@ public:
     /**
      * @brief Fetch latest crypto bars for multiple symbols.
      */
-    std::pair<Status, std::map<std::string, CryptoBar>> getLatestCryptoBars(
+    std::pair<Status, SymbolMap<CryptoBar>> getLatestCryptoBars(
         const std::vector<std::string>& symbols,
         CryptoFeed feed = CryptoFeed::US) const;
 
@@ -602,7 +739,7 @@ public:
     /**
      * @brief Fetch crypto snapshots for multiple symbols.
      */
-    std::pair<Status, std::map<std::string, CryptoSnapshot>> getCryptoSnapshots(
+    std::pair<Status, SymbolMap<CryptoSnapshot>> getCryptoSnapshots(
         const std::vector<std::string>& symbols,
         CryptoFeed feed = CryptoFeed::US) const;
 
@@ -652,8 +789,63 @@ public:
     std::pair<Status, LatestTrade> getLastTrade(const std::string& symbol) const { return getLatestTrade(symbol); }
     std::pair<Status, LatestQuote> getLastQuote(const std::string& symbol) const { return getLatestQuote(symbol); }
 
+    // ==================== Pre-Trade Checks ====================
+
+    /**
+     * @brief Run check before submitOrder() and submitNotionalOrder() send anything.
+     *
+     * When check returns a non-OK Status the order is not sent and that Status
+     * is returned. Typically a RiskChecks pipeline:
+     * `client.setPreTradeCheck([&](const OrderIntent& intent) { return checks.evaluate(intent); })`.
+     * Pass an empty function to remove the check. Not synchronized with
+     * concurrent submissions; install it before submitting orders.
+     */
+    void setPreTradeCheck(std::function<Status(const OrderIntent&)> check);
+
+    /**
+     * @brief Consult cache before REST when resolving an order submission whose outcome is unknown.
+     *
+     * See OrderSubmitConfig. The cache must outlive the Client or be removed by
+     * passing nullptr. Like setPreTradeCheck(), install it before submitting orders.
+     */
+    void setOrderCache(const OrderCache* cache);
+
+    // ==================== Response Cache ====================
+
+    /**
+     * @brief Drop cached responses whose request path starts with path_prefix.
+     *
+     * Cached responses are keyed by host, request path and query; path_prefix is matched against the path
+     * and query on both the trading and the data host, e.g. "/v2/assets/AAPL" or "/v2/clock". An empty
+     * prefix clears the whole cache. Does nothing when caching is disabled.
+     */
+    void invalidateCache(const std::string& path_prefix = "") const;
+
 private:
+    /**
+     * @brief GET path and decode the body with decode(std::string&) -> std::pair<Status, T>, using the response
+     * cache when it is enabled and ttl is non-zero.
+     */
+    template <typename T, typename Decode>
+    std::pair<Status, T> cachedGet(std::chrono::milliseconds ttl, const std::string& host, const std::string& path,
+                                   Decode decode) const;
+
     Environment environment_;
+
+    /// GET requests in flight, keyed by host, path and revalidation headers (null unless request coalescing is enabled)
+    std::shared_ptr<SingleFlight<std::shared_ptr<const detail::SharedResponse>>> in_flight_;
+
+    /// Decoded reference-data responses (null unless caching is enabled)
+    std::shared_ptr<ResponseCache> cache_;
+
+    /// Runs before order submission (empty unless setPreTradeCheck() was called)
+    std::function<Status(const OrderIntent&)> pre_trade_check_;
+
+    /// Consulted when resolving ambiguous submissions (null unless setOrderCache() was called)
+    const OrderCache* order_cache_ = nullptr;
+
+    /// Paces order requests to BatchConfig::max_requests_per_minute (null when pacing is disabled)
+    std::shared_ptr<detail::RateLimiter> order_limiter_;
 };
 
 }  // namespace alpaca::markets
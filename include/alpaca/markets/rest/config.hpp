@@ -3,6 +3,7 @@
 #include <alpaca/markets/models/status.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 
 namespace alpaca::markets {
@@ -98,6 +99,156 @@ struct TimeoutConfig {
     }
 };
 
+/**
+ * @brief Configuration for splitting long symbol lists across requests.
+ *
+ * Multi-symbol market data calls with more symbols than max_symbols_per_request
+ * are split into chunks which are requested concurrently and merged into one
+ * result. Repeated symbols are requested once. Paginated calls split `limit`
+ * between the chunks, so a combined page holds at most `limit` items (or one
+ * per chunk, if that is more), and return a combined next_page_token which
+ * carries the position of every chunk; pass it back with the same symbol list.
+ */
+struct SymbolChunkConfig {
+    /// Symbols per request (0 = never split)
+    std::size_t max_symbols_per_request = 500;
+
+    /// Maximum number of chunk requests in flight at once
+    std::size_t max_concurrency = 4;
+
+    /// Create a config which sends every symbol in one request
+    static SymbolChunkConfig noChunking() {
+        SymbolChunkConfig config;
+        config.max_symbols_per_request = 0;
+        return config;
+    }
+};
+
+/**
+ * @brief Configuration for Client::submitOrders(), Client::cancelOrdersById() and Client::cancelAllOrders().
+ *
+ * Each worker holds one keep-alive connection to the trading host and sends
+ * its share of the batch over it, so a batch pays for at most max_concurrency
+ * TLS handshakes. Order requests are paced to max_requests_per_minute on the
+ * client, and any still answered with HTTP 429 are retried with the
+ * Environment's RetryConfig backoff.
+ */
+struct BatchConfig {
+    /// Maximum number of requests in flight at once (and connections opened)
+    std::size_t max_concurrency = 8;
+
+    /**
+     * Most order requests a Client sends in any one minute; 0 disables pacing.
+     *
+     * Counts every request made by submitOrder(), submitOrders(), cancelOrdersById() and the
+     * cancelAllOrders() fallback, including lookups and 429 retries; other calls are not counted, so
+     * leave headroom below the account's limit (200 per minute by default) if they share it.
+     */
+    std::size_t max_requests_per_minute = 180;
+
+    /// How long Client::cancelAllOrders() waits for the bulk DELETE /v2/orders before falling back
+    std::chrono::milliseconds cancel_all_timeout{3000};
+
+    /// Whether Client::cancelAllOrders() cancels open orders by id when the bulk request times out or fails with a 5xx
+    bool cancel_all_fallback = true;
+
+    /// Create a config which sends one request at a time over a single connection
+    static BatchConfig sequential() {
+        BatchConfig config;
+        config.max_concurrency = 1;
+        return config;
+    }
+};
+
+/**
+ * @brief Configuration for order submissions whose outcome is unknown.
+ *
+ * When a submission fails in transport (timeout, dropped connection) or with a
+ * 5xx, the order may or may not have been accepted. Client::submitOrder() then
+ * looks the order up by client_order_id (in the OrderCache given to
+ * Client::setOrderCache(), then via REST) and only sends it again once the
+ * server reports it has no such order. A resubmission reuses the same
+ * client_order_id, so the server rejects it as a duplicate if the earlier
+ * attempt got through after all. Nothing is resent while the order's state
+ * cannot be determined.
+ */
+struct OrderSubmitConfig {
+    /// Total time one order may spend across submissions and lookups
+    std::chrono::milliseconds budget{5000};
+
+    /// Read timeout for each submission and lookup request
+    std::chrono::milliseconds attempt_timeout{2000};
+
+    /// Delay between lookups that fail to reach the server
+    std::chrono::milliseconds lookup_interval{100};
+
+    /// Maximum number of times an order is sent again after a lookup shows it was not received
+    int max_resubmits = 2;
+
+    /// Create a config which never resends an order (ambiguous failures are still looked up)
+    static OrderSubmitConfig noResubmits() {
+        OrderSubmitConfig config;
+        config.max_resubmits = 0;
+        return config;
+    }
+};
+
+/**
+ * @brief Configuration for compressed HTTP responses, per API host.
+ *
+ * When enabled for a host, requests advertise the encodings the library was
+ * built to decode (gzip and deflate, plus br when Brotli was found) and
+ * responses are decompressed as they are received. Otherwise requests,
+ * including order submissions and cancels, ask for "identity" so bodies
+ * arrive uncompressed.
+ */
+struct CompressionConfig {
+    /// Market data host, whose bars/trades/quotes/news bodies are large and compress well
+    bool data_api = true;
+
+    /// Trading host, whose bodies are mostly small enough that compression saves little
+    bool trading_api = false;
+
+    /// Create a config which never requests compressed responses
+    static CompressionConfig disabled() {
+        CompressionConfig config;
+        config.data_api = false;
+        return config;
+    }
+};
+
+/**
+ * @brief Configuration for caching slowly-changing reference endpoints.
+ *
+ * Each TTL applies to one group of endpoints; a TTL of zero disables caching
+ * for that group. Expired entries that carried an ETag are revalidated with
+ * If-None-Match, so an unchanged response is not downloaded or decoded again.
+ */
+struct CacheConfig {
+    /// Whether the Client caches responses at all
+    bool enabled = false;
+
+    /// Maximum number of cached responses; the least recently used is evicted first
+    std::size_t max_entries = 1024;
+
+    /// Revalidate expired entries with If-None-Match when the server sent an ETag
+    bool revalidate = true;
+
+    std::chrono::milliseconds assets_ttl{std::chrono::minutes(5)};            // getAsset, getAssets
+    std::chrono::milliseconds calendar_ttl{std::chrono::hours(1)};            // getCalendar
+    std::chrono::milliseconds clock_ttl{std::chrono::seconds(1)};             // getClock
+    std::chrono::milliseconds option_contracts_ttl{std::chrono::minutes(5)};  // getOptionContract
+    std::chrono::milliseconds watchlists_ttl{std::chrono::seconds(30)};       // getWatchlists
+    std::chrono::milliseconds announcements_ttl{std::chrono::minutes(5)};     // getAnnouncements
+
+    /// Create an enabled config with the default TTLs
+    static CacheConfig defaultEnabled() {
+        CacheConfig config;
+        config.enabled = true;
+        return config;
+    }
+};
+
 /**
  * @brief A class to help with parsing required variables from the environment.
  *
@@ -203,6 +354,19 @@ public:
      */
     [[nodiscard]] std::string getDataHost() const;
 
+    /**
+     * @brief Get the scheme, hostname and port of the Trading Base URL (e.g., "https://paper-api.alpaca.markets")
+     *
+     * The REST client connects to this, so a base URL such as "http://127.0.0.1:8080" points it at a local
+     * stand-in server.
+     */
+    [[nodiscard]] std::string getTradingOrigin() const;
+
+    /**
+     * @brief Get the scheme, hostname and port of the Data Base URL (e.g., "https://data.alpaca.markets")
+     */
+    [[nodiscard]] std::string getDataOrigin() const;
+
     // ==================== Resiliency Configuration ====================
 
     /**
@@ -225,6 +389,80 @@ public:
      */
     void setTimeoutConfig(const TimeoutConfig& config) { timeout_config_ = config; }
 
+    /**
+     * @brief Get the symbol chunking configuration for multi-symbol requests.
+     */
+    [[nodiscard]] const SymbolChunkConfig& getSymbolChunkConfig() const { return symbol_chunk_config_; }
+
+    /**
+     * @brief Set the symbol chunking configuration for multi-symbol requests.
+     */
+    void setSymbolChunkConfig(const SymbolChunkConfig& config) { symbol_chunk_config_ = config; }
+
+    /**
+     * @brief Get the configuration for batch order submission and cancellation.
+     */
+    [[nodiscard]] const BatchConfig& getBatchConfig() const { return batch_config_; }
+
+    /**
+     * @brief Set the configuration for batch order submission and cancellation.
+     */
+    void setBatchConfig(const BatchConfig& config) { batch_config_ = config; }
+
+    /**
+     * @brief Get the configuration for resolving and retrying ambiguous order submissions.
+     */
+    [[nodiscard]] const OrderSubmitConfig& getOrderSubmitConfig() const { return order_submit_config_; }
+
+    /**
+     * @brief Set the configuration for resolving and retrying ambiguous order submissions.
+     */
+    void setOrderSubmitConfig(const OrderSubmitConfig& config) { order_submit_config_ = config; }
+
+    /**
+     * @brief Whether Client fills in a client_order_id for orders submitted without one.
+     */
+    [[nodiscard]] bool getGenerateClientOrderIds() const { return generate_client_order_ids_; }
+
+    /**
+     * @brief Enable or disable generated client_order_ids (on by default).
+     *
+     * When enabled, Client::submitOrder() and Client::submitOrders() send an id from
+     * ClientOrderIdGenerator::global() for any order without one, so every order can
+     * be looked up by client_order_id after an ambiguous failure.
+     */
+    void setGenerateClientOrderIds(bool enabled) { generate_client_order_ids_ = enabled; }
+
+    /**
+     * @brief Whether identical GET requests made concurrently through one Client share a single HTTP call.
+     */
+    [[nodiscard]] bool getRequestCoalescing() const { return request_coalescing_; }
+
+    /**
+     * @brief Enable or disable request coalescing. Takes effect for Clients constructed afterwards.
+     */
+    void setRequestCoalescing(bool enabled) { request_coalescing_ = enabled; }
+
+    /**
+     * @brief Get the response cache configuration.
+     */
+    [[nodiscard]] const CacheConfig& getCacheConfig() const { return cache_config_; }
+
+    /**
+     * @brief Set the response cache configuration. Takes effect for Clients constructed afterwards.
+     */
+    void setCacheConfig(const CacheConfig& config) { cache_config_ = config; }
+
+    /**
+     * @brief Get the response compression configuration.
+     */
+    [[nodiscard]] const CompressionConfig& getCompressionConfig() const { return compression_config_; }
+
+    /**
+     * @brief Set the response compression configuration.
+     */
+    void setCompressionConfig(const CompressionConfig& config) { compression_config_ = config; }
+
 private:
     bool parsed_ = false;
 
@@ -244,6 +482,13 @@ private:
     // Resiliency configuration
     RetryConfig retry_config_;
     TimeoutConfig timeout_config_;
+    SymbolChunkConfig symbol_chunk_config_;
+    BatchConfig batch_config_;
+    OrderSubmitConfig order_submit_config_;
+    bool generate_client_order_ids_ = true;
+    bool request_coalescing_ = false;
+    CacheConfig cache_config_;
+    CompressionConfig compression_config_;
 };
 
 }  // namespace alpaca::markets
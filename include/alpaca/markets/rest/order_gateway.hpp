@@ -0,0 +1,127 @@
+#pragma once
+
+#include <alpaca/markets/models/decimal.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/order_request.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/rest/config.hpp>
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace alpaca::markets {
+
+/**
+ * @brief The fixed part of an order request body, rendered once per symbol/side/type/time-in-force.
+ *
+ * Holds the JSON prefix `{"symbol":"AAPL","side":"buy","type":"limit","time_in_force":"day"` so that
+ * submitting an order only appends the fields that change between orders.
+ */
+class OrderTemplate {
+public:
+    OrderTemplate(const std::string& symbol, OrderSide side, OrderType type, OrderTimeInForce tif,
+                  bool extended_hours = false);
+
+    /**
+     * @brief Render a complete order body into out, replacing its contents.
+     *
+     * Reuses out's capacity, so rendering into the same buffer repeatedly does
+     * not allocate. Prices must be positive decimals that Decimal::parse()
+     * accepts, and are sent in Decimal's canonical form ("1." as "1"). The
+     * client_order_id must be printable ASCII without quotes or backslashes;
+     * anything else is rejected rather than escaped. A template built with an
+     * Unknown side, type or time in force never renders.
+     *
+     * @param quantity Whole-share quantity (> 0)
+     * @param limit_price Limit price as a decimal string, or empty
+     * @param stop_price Stop price as a decimal string, or empty
+     * @param client_order_id Client order id, or empty
+     */
+    Status render(std::string& out, int quantity, std::string_view limit_price = {},
+                  std::string_view stop_price = {}, std::string_view client_order_id = {}) const;
+
+    [[nodiscard]] const std::string& prefix() const { return prefix_; }
+
+private:
+    std::string prefix_;
+    bool has_unknown_ = false;  // Side, type or time in force is Unknown, so render() always fails
+};
+
+/**
+ * @brief A latency-oriented order submission path.
+ *
+ * Unlike Client::submitOrder(), which serializes with a fresh JSON writer,
+ * builds headers and opens a TLS connection per call, the gateway:
+ * - renders the authentication headers once,
+ * - renders each order body from an OrderTemplate into a reused buffer,
+ * - keeps one keep-alive connection with TCP_NODELAY open, which warmUp()
+ *   establishes before the first order.
+ *
+ * Submissions are resolved like Client::submitOrder(): an order sent without a
+ * client_order_id gets one from ClientOrderIdGenerator::global() (unless the
+ * Environment disables generated ids), and a POST that gets no response or a
+ * 5xx is looked up by that id and resent only if it was never received, per
+ * the Environment's OrderSubmitConfig. Each attempt, and so the connection,
+ * is bounded by OrderSubmitConfig::attempt_timeout.
+ *
+ * A gateway serializes its requests over its single connection; use one per
+ * submitting thread.
+ *
+ * @code{.cpp}
+ *   OrderGateway gateway(env);
+ *   gateway.warmUp();
+ *   OrderTemplate buy_aapl("AAPL", OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day);
+ *   auto [status, order] = gateway.submit(buy_aapl, 100, "187.25");
+ * @endcode
+ */
+class OrderGateway {
+public:
+    /**
+     * @brief Create a gateway to the environment's trading base URL (its scheme, host and port).
+     */
+    explicit OrderGateway(const Environment& environment);
+
+    /**
+     * @brief Create a gateway to an explicit base URL, e.g. "http://127.0.0.1:8080" for a local stand-in server.
+     */
+    OrderGateway(const Environment& environment, const std::string& base_url);
+
+    ~OrderGateway();
+    OrderGateway(OrderGateway&&) noexcept;
+    OrderGateway& operator=(OrderGateway&&) noexcept;
+    OrderGateway(const OrderGateway&) = delete;
+    OrderGateway& operator=(const OrderGateway&) = delete;
+
+    /**
+     * @brief Open the connection (TCP and TLS handshakes) ahead of the first order.
+     *
+     * Sends GET /v2/clock. Anything but HTTP 200 (e.g. 401 for bad credentials) is returned as an error.
+     */
+    Status warmUp();
+
+    /**
+     * @brief Submit an order rendered from order_template. See OrderTemplate::render() for the arguments.
+     */
+    std::pair<Status, Order> submit(const OrderTemplate& order_template, int quantity,
+                                    std::string_view limit_price = {}, std::string_view stop_price = {},
+                                    std::string_view client_order_id = {});
+
+    /**
+     * @brief Submit an order described by an OrderRequest, rendered into the gateway's reused buffer.
+     *
+     * For orders a template can't express (fractional quantities, brackets, multi-leg).
+     * The request is validated while rendering; the pre-trade check is not run.
+     */
+    std::pair<Status, Order> submit(const OrderRequest& request);
+
+private:
+    /// Post the body rendered into impl_->body, resolving an ambiguous result by client_order_id
+    std::pair<Status, Order> post(std::string_view client_order_id);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace alpaca::markets
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/symbol_map.hpp>
+#include <alpaca/markets/rest/config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Worker threads and symbol chunking for the REST client.
+//
+// Multi-symbol market data calls with more symbols than
+// SymbolChunkConfig::max_symbols_per_request are split into chunks which are
+// fetched on a few worker threads and merged back into one result.
+namespace alpaca::markets::detail {
+
+/**
+ * @brief Run worker() on up to `concurrency` threads (one of them the caller's) and wait for all of them.
+ *
+ * An exception escaping a worker thread would terminate the process, so it is caught and returned instead.
+ *
+ * @return the first exception thrown by a worker, as an error, or OK.
+ */
+template <typename Worker>
+Status runWorkers(std::size_t concurrency, Worker worker) {
+    std::mutex error_mutex;
+    Status error;
+    auto fail = [&](Status status) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error.ok()) {
+            error = std::move(status);
+        }
+    };
+    auto guarded = [&] {
+        try {
+            worker();
+        } catch (const std::exception& e) {
+            fail(Status(1, std::string("Exception on a request worker thread: ") + e.what()));
+        } catch (...) {
+            fail(Status(1, "Unknown exception on a request worker thread"));
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(concurrency > 0 ? concurrency - 1 : 0);
+    for (std::size_t t = 1; t < concurrency; ++t) {
+        threads.emplace_back(guarded);
+    }
+    guarded();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return error;
+}
+
+inline constexpr std::string_view kChunkedPageTokenPrefix = "chunked:";
+
+inline bool shouldChunk(const std::vector<std::string>& symbols, const SymbolChunkConfig& config) {
+    return config.max_symbols_per_request > 0 && symbols.size() > config.max_symbols_per_request;
+}
+
+/**
+ * @brief Split symbols into chunks of at most chunk_size, dropping repeated symbols.
+ *
+ * Chunked results are merged by symbol, so a symbol requested in two chunks would lose one chunk's data.
+ */
+inline std::vector<std::vector<std::string>> chunkSymbols(const std::vector<std::string>& symbols,
+                                                          std::size_t chunk_size) {
+    std::vector<std::vector<std::string>> chunks;
+    chunks.reserve((symbols.size() + chunk_size - 1) / chunk_size);
+    std::unordered_set<std::string_view> seen;
+    seen.reserve(symbols.size());
+    for (const auto& symbol : symbols) {
+        if (!seen.insert(symbol).second) {
+            continue;
+        }
+        if (chunks.empty() || chunks.back().size() == chunk_size) {
+            chunks.emplace_back().reserve(chunk_size);
+        }
+        chunks.back().push_back(symbol);
+    }
+    return chunks;
+}
+
+/**
+ * @brief The share of a per-page limit requested by chunk i of count, so the chunks' pages add up to the limit.
+ *
+ * Each chunk asks for at least one item, so a limit below the number of chunks can be exceeded.
+ */
+inline unsigned int chunkLimit(unsigned int limit, std::size_t i, std::size_t count) {
+    auto share = static_cast<unsigned int>(limit / count + (i < limit % count ? 1 : 0));
+    return std::max(share, 1u);
+}
+
+/**
+ * @brief Combine per-chunk page tokens into one token; an empty entry marks a finished chunk.
+ */
+inline std::string joinChunkTokens(const std::vector<std::string>& tokens) {
+    std::string joined(kChunkedPageTokenPrefix);
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        if (i > 0) {
+            joined += ",";
+        }
+        joined += tokens[i];
+    }
+    return joined;
+}
+
+inline bool splitChunkTokens(const std::string& page_token, std::vector<std::string>& tokens) {
+    if (page_token.compare(0, kChunkedPageTokenPrefix.size(), kChunkedPageTokenPrefix) != 0) {
+        return false;
+    }
+    std::vector<std::string> parsed;
+    std::size_t pos = kChunkedPageTokenPrefix.size();
+    while (true) {
+        std::size_t comma = page_token.find(',', pos);
+        parsed.push_back(page_token.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos));
+        if (comma == std::string::npos) {
+            break;
+        }
+        pos = comma + 1;
+    }
+    if (parsed.size() != tokens.size()) {
+        return false;
+    }
+    tokens = std::move(parsed);
+    return true;
+}
+
+/**
+ * @brief Run fetch(i) for every chunk on up to `concurrency` threads, returning the first error.
+ */
+template <typename Result, typename Fetch>
+std::pair<Status, std::vector<Result>> fetchChunks(std::size_t count, std::size_t concurrency, Fetch fetch) {
+    std::vector<std::pair<Status, Result>> results(count);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&] {
+        for (std::size_t i = next++; i < count; i = next++) {
+            results[i] = fetch(i);
+        }
+    };
+    if (Status status = runWorkers(std::min(std::max<std::size_t>(concurrency, 1), count), worker); !status.ok()) {
+        return std::make_pair(status, std::vector<Result>{});
+    }
+
+    std::vector<Result> values;
+    values.reserve(count);
+    for (auto& [status, value] : results) {
+        if (!status.ok()) {
+            return std::make_pair(status, std::vector<Result>{});
+        }
+        values.push_back(std::move(value));
+    }
+    return std::make_pair(Status(), std::move(values));
+}
+
+/**
+ * @brief Split a non-paginated multi-symbol call into chunks and merge the resulting maps.
+ */
+template <typename T, typename Fetch>
+std::pair<Status, SymbolMap<T>> fanOutLatest(const std::vector<std::string>& symbols, const SymbolChunkConfig& config,
+                                             Fetch fetch) {
+    auto chunks = chunkSymbols(symbols, config.max_symbols_per_request);
+    auto [status, results] = fetchChunks<SymbolMap<T>>(chunks.size(), config.max_concurrency,
+                                                       [&](std::size_t i) { return fetch(chunks[i]); });
+    if (!status.ok()) {
+        return std::make_pair(status, SymbolMap<T>());
+    }
+    std::vector<typename SymbolMap<T>::value_type> entries;
+    std::size_t total = 0;
+    for (const auto& result : results) {
+        total += result.size();
+    }
+    entries.reserve(total);
+    for (auto& result : results) {
+        std::move(result.begin(), result.end(), std::back_inserter(entries));
+    }
+    return std::make_pair(Status(), SymbolMap<T>(std::move(entries)));
+}
+
+/**
+ * @brief Split a paginated multi-symbol call into chunks, each following its own page token.
+ *
+ * fetch(chunk, token, chunk_limit) requests one chunk's page, where the chunks' limits add up to `limit`, so
+ * a combined page holds no more items than an unchunked one would. merge(into, from) moves one chunk's page
+ * into the combined result.
+ */
+template <typename Result, typename Fetch, typename Merge>
+std::pair<Status, Result> fanOutPages(const std::vector<std::string>& symbols, const std::string& page_token,
+                                      unsigned int limit, const SymbolChunkConfig& config, Fetch fetch, Merge merge) {
+    auto chunks = chunkSymbols(symbols, config.max_symbols_per_request);
+    std::vector<std::string> tokens(chunks.size());
+    bool resuming = !page_token.empty();
+    if (resuming && !splitChunkTokens(page_token, tokens)) {
+        return std::make_pair(Status(1, "Page token was not returned by a chunked request for these symbols"),
+                              Result());
+    }
+
+    auto [status, results] =
+        fetchChunks<Result>(chunks.size(), config.max_concurrency, [&](std::size_t i) {
+            if (resuming && tokens[i].empty()) {
+                // This chunk ran out of pages on an earlier call
+                return std::make_pair(Status(), Result());
+            }
+            return fetch(chunks[i], tokens[i], chunkLimit(limit, i, chunks.size()));
+        });
+    if (!status.ok()) {
+        return std::make_pair(status, Result());
+    }
+
+    Result merged;
+    bool more = false;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        tokens[i] = std::move(results[i].next_page_token);
+        more = more || !tokens[i].empty();
+        merge(merged, results[i]);
+    }
+    merged.next_page_token = more ? joinChunkTokens(tokens) : "";
+    return std::make_pair(Status(), std::move(merged));
+}
+
+}  // namespace alpaca::markets::detail
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <alpaca/markets/models/account.hpp>
+#include <alpaca/markets/models/announcement.hpp>
+#include <alpaca/markets/models/asset.hpp>
+#include <alpaca/markets/models/auction.hpp>
+#include <alpaca/markets/models/bars.hpp>
+#include <alpaca/markets/models/calendar.hpp>
+#include <alpaca/markets/models/clock.hpp>
+#include <alpaca/markets/models/corporate_action.hpp>
+#include <alpaca/markets/models/crypto.hpp>
+#include <alpaca/markets/models/multi_quote.hpp>
+#include <alpaca/markets/models/multi_trade.hpp>
+#include <alpaca/markets/models/news.hpp>
+#include <alpaca/markets/models/option.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/portfolio.hpp>
+#include <alpaca/markets/models/position.hpp>
+#include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/snapshot.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/symbol_map.hpp>
+#include <alpaca/markets/models/trade.hpp>
+#include <alpaca/markets/models/trade_update.hpp>
+#include <alpaca/markets/models/watchlist.hpp>
+#include <rapidjson/document.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "fields.hpp"
+
+// Internal decoders which populate a model directly from an already-parsed
+// JSON value. Nested objects and array elements are decoded in place instead
+// of being re-serialized to a string and parsed a second time. Each decoder is
+// driven by the model's field table (fields.hpp). Only the models sent as
+// request bodies have an encode().
+namespace alpaca::markets::detail {
+
+Status decode(const rapidjson::Value& d, Account& account);
+Status decode(const rapidjson::Value& d, AccountConfigurations& account_configurations);
+Status decode(const rapidjson::Value& d, TradeActivity& activity);
+Status decode(const rapidjson::Value& d, NonTradeActivity& activity);
+Status decode(const rapidjson::Value& d, Announcement& announcement);
+Status decode(const rapidjson::Value& d, Asset& asset);
+Status decode(const rapidjson::Value& d, Auction& auction);
+Status decode(const rapidjson::Value& d, SymbolAuctions& symbol_auctions);
+Status decode(const rapidjson::Value& d, Auctions& auctions);
+Status decode(const rapidjson::Value& d, Bar& bar);
+Status decode(const rapidjson::Value& d, Bars& bars);
+Status decode(const rapidjson::Value& d, Date& date);
+Status decode(const rapidjson::Value& d, Clock& clock);
+Status decode(const rapidjson::Value& d, CorporateAction& action);
+Status decode(const rapidjson::Value& d, CorporateActions& actions);
+Status decode(const rapidjson::Value& d, CryptoTrade& trade);
+Status decode(const rapidjson::Value& d, CryptoQuote& quote);
+Status decode(const rapidjson::Value& d, CryptoBar& bar);
+Status decode(const rapidjson::Value& d, CryptoSnapshot& snapshot);
+Status decode(const rapidjson::Value& d, CryptoTrades& trades);
+Status decode(const rapidjson::Value& d, CryptoQuotes& quotes);
+Status decode(const rapidjson::Value& d, CryptoBars& bars);
+Status decode(const rapidjson::Value& d, MultiQuotes& multi_quotes);
+Status decode(const rapidjson::Value& d, MultiTrades& multi_trades);
+Status decode(const rapidjson::Value& d, News& news);
+Status decode(const rapidjson::Value& d, NewsArticles& news_articles);
+Status decode(const rapidjson::Value& d, OptionContract& contract);
+Status decode(const rapidjson::Value& d, OptionContracts& contracts);
+Status decode(const rapidjson::Value& d, Order& order);
+Status decode(const rapidjson::Value& d, OrderCancelResults& results);
+Status decode(const rapidjson::Value& d, PortfolioHistory& portfolio_history);
+Status decode(const rapidjson::Value& d, Position& position);
+Status decode(const rapidjson::Value& d, Quote& quote);
+Status decode(const rapidjson::Value& d, LatestQuote& latest_quote);
+Status decode(const rapidjson::Value& d, Snapshot& snapshot);
+Status decode(const rapidjson::Value& d, Snapshots& snapshots);
+Status decode(const rapidjson::Value& d, Trade& trade);
+Status decode(const rapidjson::Value& d, LatestTrade& latest_trade);
+Status decode(const rapidjson::Value& d, TradeUpdate& update);
+Status decode(const rapidjson::Value& d, Watchlist& watchlist);
+
+void encode(const AccountConfigurations& account_configurations, JSONWriter& writer);
+
+template <typename>
+struct MemberTraits;
+
+template <typename C, typename M>
+struct MemberTraits<M C::*> {
+    using Class = C;
+    using Type = M;
+};
+
+template <auto Member>
+using MemberClass = typename MemberTraits<decltype(Member)>::Class;
+
+template <auto Member>
+using MemberType = typename MemberTraits<decltype(Member)>::Type;
+
+/**
+ * @brief Serialize a model to a JSON string through its field table.
+ */
+template <typename T>
+std::string encodeJSON(const T& in) {
+    rapidjson::StringBuffer s;
+    JSONWriter writer(s);
+    encode(in, writer);
+    return s.GetString();
+}
+
+// Custom field decoders for nested models. Non-object/non-array values are
+// skipped, matching the Is*() checks of scalar fields.
+
+template <auto Member>
+Status decodeObjectField(const rapidjson::Value& v, MemberClass<Member>& out) {
+    if (!v.IsObject()) {
+        return Status();
+    }
+    return decode(v, out.*Member);
+}
+
+/**
+ * @brief A nested object, e.g. "latestTrade": {...}.
+ */
+template <auto Member>
+constexpr Field<MemberClass<Member>> objectField(std::string_view name) {
+    return custom<MemberClass<Member>>(name, decodeObjectField<Member>);
+}
+
+template <auto Member>
+Status decodeArrayField(const rapidjson::Value& v, MemberClass<Member>& out) {
+    if (!v.IsArray()) {
+        return Status();
+    }
+    MemberType<Member> items;
+    items.reserve(v.Size());
+    for (auto& item : v.GetArray()) {
+        typename MemberType<Member>::value_type decoded;
+        if (Status status = decode(item, decoded); !status.ok()) {
+            return status;
+        }
+        items.push_back(std::move(decoded));
+    }
+    out.*Member = std::move(items);
+    return Status();
+}
+
+/**
+ * @brief An array of nested objects, e.g. "assets": [{...}, ...].
+ */
+template <auto Member>
+constexpr Field<MemberClass<Member>> arrayField(std::string_view name) {
+    return custom<MemberClass<Member>>(name, decodeArrayField<Member>);
+}
+
+template <auto Member>
+Status decodeSymbolObjectsField(const rapidjson::Value& v, MemberClass<Member>& out) {
+    if (!v.IsObject()) {
+        return Status();
+    }
+    for (auto& m : v.GetObject()) {
+        typename MemberType<Member>::mapped_type decoded;
+        if (Status status = decode(m.value, decoded); !status.ok()) {
+            return status;
+        }
+        (out.*Member)[std::string(m.name.GetString(), m.name.GetStringLength())] = std::move(decoded);
+    }
+    return Status();
+}
+
+/**
+ * @brief A "symbol -> {...}" object, e.g. "snapshots".
+ */
+template <auto Member>
+constexpr Field<MemberClass<Member>> symbolObjectsField(std::string_view name) {
+    return custom<MemberClass<Member>>(name, decodeSymbolObjectsField<Member>);
+}
+
+template <auto Member>
+Status decodeSymbolArraysField(const rapidjson::Value& v, MemberClass<Member>& out) {
+    if (!v.IsObject()) {
+        return Status();
+    }
+    for (auto& m : v.GetObject()) {
+        typename MemberType<Member>::mapped_type items;
+        if (m.value.IsArray()) {
+            items.reserve(m.value.Size());
+            for (auto& item : m.value.GetArray()) {
+                typename MemberType<Member>::mapped_type::value_type decoded;
+                if (Status status = decode(item, decoded); !status.ok()) {
+                    return status;
+                }
+                items.push_back(std::move(decoded));
+            }
+        }
+        (out.*Member)[std::string(m.name.GetString(), m.name.GetStringLength())] = std::move(items);
+    }
+    return Status();
+}
+
+/**
+ * @brief A "symbol -> [{...}, ...]" object, e.g. "bars" in a multi-symbol response.
+ */
+template <auto Member>
+constexpr Field<MemberClass<Member>> symbolArraysField(std::string_view name) {
+    return custom<MemberClass<Member>>(name, decodeSymbolArraysField<Member>);
+}
+
+template <auto Member, auto FromString>
+Status decodeEnumField(const rapidjson::Value& v, MemberClass<Member>& out) {
+    if (v.IsString()) {
+        out.*Member = FromString(std::string(v.GetString(), v.GetStringLength()));
+    }
+    return Status();
+}
+
+/**
+ * @brief An enum carried as a string, converted with the model's string helpers.
+ */
+template <auto Member, auto FromString>
+constexpr Field<MemberClass<Member>> enumField(std::string_view name) {
+    return custom<MemberClass<Member>>(name, decodeEnumField<Member, FromString>);
+}
+
+/**
+ * @brief Decode a "symbol -> {...}" object into a SymbolMap with a single reservation and sort.
+ */
+template <typename T>
+Status decodeSymbolMap(const rapidjson::Value& v, SymbolMap<T>& out) {
+    if (!v.IsObject()) {
+        return Status();
+    }
+    std::vector<typename SymbolMap<T>::value_type> entries;
+    entries.reserve(v.MemberCount());
+    for (auto& m : v.GetObject()) {
+        T decoded;
+        if (Status status = decode(m.value, decoded); !status.ok()) {
+            return status;
+        }
+        entries.emplace_back(std::string(m.name.GetString(), m.name.GetStringLength()), std::move(decoded));
+    }
+    out = SymbolMap<T>(std::move(entries));
+    return Status();
+}
+
+/**
+ * @brief Parse a mutable buffer in place and decode it into a model.
+ *
+ * RapidJSON's in-situ mode decodes string values directly inside the buffer
+ * rather than copying them into the document allocator, so the buffer is
+ * left modified and must outlive the decode call.
+ */
+template <typename T>
+Status decodeInsitu(std::string& json, T& out, const char* parse_error) {
+    rapidjson::Document d;
+    if (d.ParseInsitu(json.data()).HasParseError()) {
+        return Status(1, parse_error);
+    }
+    return decode(d, out);
+}
+
+}  // namespace alpaca::markets::detail
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <alpaca/markets/models/status.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+// Compile-time field descriptor tables.
+//
+// Each model describes its JSON fields once as a constexpr table of
+// (key, member pointer) entries. Decoding makes a single pass over the members
+// of a JSON object and finds each key's descriptor through a perfect hash
+// computed when the table is built, instead of a HasMember scan plus a second
+// lookup per field. The models that are also sent as request bodies encode
+// through the same table, in declaration order.
+namespace alpaca::markets::detail {
+
+using JSONWriter = rapidjson::Writer<rapidjson::StringBuffer>;
+
+/**
+ * @brief A field which needs hand-written decoding (nested objects, enums, collections).
+ */
+template <typename T>
+struct CustomField {
+    Status (*decode)(const rapidjson::Value& value, T& out);
+};
+
+/**
+ * @brief How a field maps onto its model; the member type selects the JSON type checks.
+ */
+template <typename T>
+using FieldAccessor = std::variant<std::string T::*, bool T::*, int T::*, unsigned int T::*, uint64_t T::*,
+                                   float T::*, double T::*, std::vector<std::string> T::*, std::vector<double> T::*,
+                                   std::vector<uint64_t> T::*, CustomField<T>>;
+
+template <typename T>
+struct Field {
+    std::string_view name;
+    FieldAccessor<T> accessor;
+};
+
+/**
+ * @brief Describe a JSON field stored directly in a model member.
+ */
+template <typename T, typename M>
+constexpr Field<T> field(std::string_view name, M T::*member) {
+    return Field<T>{name, FieldAccessor<T>(member)};
+}
+
+/**
+ * @brief Describe a JSON field decoded by a hand-written function.
+ */
+template <typename T>
+constexpr Field<T> custom(std::string_view name, Status (*decode)(const rapidjson::Value&, T&)) {
+    return Field<T>{name, FieldAccessor<T>(CustomField<T>{decode})};
+}
+
+/**
+ * @brief Seeded FNV-1a with a final avalanche, cheap enough to run per JSON key.
+ */
+constexpr uint32_t hashFieldName(std::string_view name, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : name) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    return h;
+}
+
+/**
+ * @brief A model's field descriptors plus a perfect hash from key to descriptor.
+ *
+ * The hash seed is searched for at compile time so that every key lands in
+ * its own slot; a table with duplicate keys fails to compile. Descriptors are
+ * Field<T> unless a model's decoder defines its own type with a name member.
+ */
+template <typename T, std::size_t N, typename F = Field<T>>
+class FieldTable {
+public:
+    static_assert(N > 0 && N < 256, "field tables index slots with uint8_t");
+    static constexpr std::size_t kSlots = std::bit_ceil(N * 4);
+
+    constexpr explicit FieldTable(const std::array<F, N>& fields) : fields_(fields) {
+        for (uint32_t seed = 0; seed < kMaxSeeds; ++seed) {
+            if (tryBuild(seed)) {
+                return;
+            }
+        }
+        throw std::logic_error("no perfect hash seed found; duplicate field names?");
+    }
+
+    /**
+     * @brief Find the descriptor for a key, or nullptr if the model has no such field.
+     */
+    constexpr const F* find(std::string_view name) const {
+        uint8_t slot = slots_[hashFieldName(name, seed_) & (kSlots - 1)];
+        if (slot == 0) {
+            return nullptr;
+        }
+        const F& candidate = fields_[slot - 1];
+        return candidate.name == name ? &candidate : nullptr;
+    }
+
+    constexpr const std::array<F, N>& fields() const {
+        return fields_;
+    }
+
+private:
+    static constexpr uint32_t kMaxSeeds = 1u << 16;
+
+    constexpr bool tryBuild(uint32_t seed) {
+        slots_ = {};
+        for (std::size_t i = 0; i < N; ++i) {
+            auto& slot = slots_[hashFieldName(fields_[i].name, seed) & (kSlots - 1)];
+            if (slot != 0) {
+                return false;
+            }
+            slot = static_cast<uint8_t>(i + 1);
+        }
+        seed_ = seed;
+        return true;
+    }
+
+    std::array<F, N> fields_;
+    std::array<uint8_t, kSlots> slots_{};
+    uint32_t seed_ = 0;
+};
+
+/**
+ * @brief Build a model's field table: constexpr auto kFields = makeFieldTable<Model>(field(...), ...);
+ */
+template <typename T, typename... Fields>
+constexpr auto makeFieldTable(Fields... fields) {
+    using Descriptor = std::common_type_t<Fields...>;
+    return FieldTable<T, sizeof...(Fields), Descriptor>(std::array<Descriptor, sizeof...(Fields)>{fields...});
+}
+
+// Scalar readers. A value of the wrong JSON type leaves the member untouched.
+inline void readField(const rapidjson::Value& v, std::string& out) {
+    if (v.IsString()) {
+        out.assign(v.GetString(), v.GetStringLength());
+    }
+}
+
+inline void readField(const rapidjson::Value& v, bool& out) {
+    if (v.IsBool()) {
+        out = v.GetBool();
+    }
+}
+
+inline void readField(const rapidjson::Value& v, int& out) {
+    if (v.IsInt()) {
+        out = v.GetInt();
+    }
+}
+
+inline void readField(const rapidjson::Value& v, unsigned int& out) {
+    if (v.IsUint()) {
+        out = v.GetUint();
+    }
+}
+
+inline void readField(const rapidjson::Value& v, uint64_t& out) {
+    if (v.IsUint64()) {
+        out = v.GetUint64();
+    }
+}
+
+inline void readField(const rapidjson::Value& v, float& out) {
+    if (v.IsNumber()) {
+        out = v.GetFloat();
+    }
+}
+
+inline void readField(const rapidjson::Value& v, double& out) {
+    if (v.IsNumber()) {
+        out = v.GetDouble();
+    }
+}
+
+// Array readers replace the member with the elements of the expected type.
+template <typename E>
+void readField(const rapidjson::Value& v, std::vector<E>& out) {
+    if (!v.IsArray()) {
+        return;
+    }
+    std::vector<E> items;
+    items.reserve(v.Size());
+    for (auto& item : v.GetArray()) {
+        if constexpr (std::is_same_v<E, std::string>) {
+            if (item.IsString()) {
+                items.emplace_back(item.GetString(), item.GetStringLength());
+            }
+        } else if constexpr (std::is_same_v<E, double>) {
+            if (item.IsNumber()) {
+                items.push_back(item.GetDouble());
+            }
+        } else {
+            if (item.IsUint64()) {
+                items.push_back(item.GetUint64());
+            }
+        }
+    }
+    out = std::move(items);
+}
+
+inline void writeField(JSONWriter& writer, const std::string& value) {
+    writer.String(value.data(), static_cast<rapidjson::SizeType>(value.size()));
+}
+
+inline void writeField(JSONWriter& writer, bool value) {
+    writer.Bool(value);
+}
+
+inline void writeField(JSONWriter& writer, int value) {
+    writer.Int(value);
+}
+
+inline void writeField(JSONWriter& writer, unsigned int value) {
+    writer.Uint(value);
+}
+
+inline void writeField(JSONWriter& writer, uint64_t value) {
+    writer.Uint64(value);
+}
+
+inline void writeField(JSONWriter& writer, double value) {
+    writer.Double(value);
+}
+
+template <typename E>
+void writeField(JSONWriter& writer, const std::vector<E>& values) {
+    writer.StartArray();
+    for (const E& value : values) {
+        writeField(writer, value);
+    }
+    writer.EndArray();
+}
+
+/**
+ * @brief Decode the members of a JSON object into a model in one pass.
+ *
+ * The caller checks d.IsObject(). Unknown keys are ignored.
+ */
+template <typename T, std::size_t N>
+Status decodeFields(const rapidjson::Value& d, T& out, const FieldTable<T, N>& table) {
+    for (auto& m : d.GetObject()) {
+        const Field<T>* f = table.find(std::string_view(m.name.GetString(), m.name.GetStringLength()));
+        if (f == nullptr) {
+            continue;
+        }
+        if (const auto* c = std::get_if<CustomField<T>>(&f->accessor)) {
+            if (Status status = c->decode(m.value, out); !status.ok()) {
+                return status;
+            }
+            continue;
+        }
+        std::visit(
+            [&](auto member) {
+                if constexpr (!std::is_same_v<decltype(member), CustomField<T>>) {
+                    readField(m.value, out.*member);
+                }
+            },
+            f->accessor);
+    }
+    return Status();
+}
+
+/**
+ * @brief Write a model as a JSON object, fields in table order. Custom fields are decode-only and omitted.
+ */
+template <typename T, std::size_t N>
+void encodeFields(const T& in, JSONWriter& writer, const FieldTable<T, N>& table) {
+    writer.StartObject();
+    for (const Field<T>& f : table.fields()) {
+        if (std::holds_alternative<CustomField<T>>(f.accessor)) {
+            continue;
+        }
+        writer.Key(f.name.data(), static_cast<rapidjson::SizeType>(f.name.size()));
+        std::visit(
+            [&](auto member) {
+                if constexpr (!std::is_same_v<decltype(member), CustomField<T>>) {
+                    writeField(writer, in.*member);
+                }
+            },
+            f.accessor);
+    }
+    writer.EndObject();
+}
+
+}  // namespace alpaca::markets::detail
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <alpaca/markets/models/client_order_id.hpp>
+#include <alpaca/markets/models/order.hpp>
+#include <alpaca/markets/models/order_cache.hpp>
+#include <alpaca/markets/models/order_request.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/rest/config.hpp>
+
+#include <httplib.h>
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "rate_limiter.hpp"
+
+// Order submission shared by Client and OrderGateway.
+//
+// A POST /v2/orders that gets no response, or a 5xx, may still have been
+// accepted. Both submission paths resolve that ambiguity the same way: look
+// the order up by its client_order_id and resend it only once the lookup shows
+// it was never received (see OrderSubmitConfig).
+namespace alpaca::markets::detail {
+
+/**
+ * @brief Render request into body, with a generated client_order_id if it has none and the Environment asks for one.
+ *
+ * Sets client_order_id to the id sent (empty if none); it may point into generated.
+ */
+inline Status renderOrderRequest(const Environment& environment, const OrderRequest& request, std::string& body,
+                                 ClientOrderId& generated, std::string_view& client_order_id) {
+    client_order_id = request.client_order_id;
+    if (client_order_id.empty() && environment.getGenerateClientOrderIds()) {
+        generated = ClientOrderIdGenerator::global().next();
+        client_order_id = generated.view();
+    }
+    return request.render(body, client_order_id);
+}
+
+/**
+ * @brief Decode the response to an order request sent to url.
+ */
+inline std::pair<Status, Order> decodeOrderResponse(const std::string& url, httplib::Result& resp) {
+    Order order;
+    if (!resp) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an empty response";
+        return std::make_pair(Status(1, ss.str()), order);
+    }
+
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
+        return std::make_pair(Status(1, ss.str()), order);
+    }
+
+    return std::make_pair(order.fromJSON(std::move(resp->body)), order);
+}
+
+/**
+ * @brief Wait for limiter (if any) to allow one more request.
+ */
+inline void pace(RateLimiter* limiter) {
+    if (limiter != nullptr) {
+        limiter->acquire();
+    }
+}
+
+/**
+ * @brief Send a request, repeating it with the RetryConfig backoff while the server answers HTTP 429.
+ *
+ * A rate-limited request was not acted on, so repeating it is safe even for order submission. Every attempt
+ * waits for limiter (if any) first.
+ */
+template <typename Send>
+httplib::Result sendRateLimited(const RetryConfig& retry, RateLimiter* limiter, Send send) {
+    pace(limiter);
+    httplib::Result resp = send();
+    for (int attempt = 0; resp && resp->status == 429 && attempt < retry.max_retries; ++attempt) {
+        std::this_thread::sleep_for(retry.getDelay(attempt));
+        pace(limiter);
+        resp = send();
+    }
+    return resp;
+}
+
+/**
+ * @brief Apply the connection timeout and the per-request order timeout to a connection to the trading host.
+ */
+inline void configureOrderClient(httplib::Client& client, const Environment& environment) {
+    client.set_keep_alive(true);
+    client.set_connection_timeout(environment.getTimeoutConfig().connection_timeout);
+    client.set_read_timeout(environment.getOrderSubmitConfig().attempt_timeout);
+    client.set_write_timeout(environment.getOrderSubmitConfig().attempt_timeout);
+}
+
+/**
+ * @brief Whether a submission's outcome is unknown: no response, or a server error that may have followed acceptance.
+ */
+inline bool isAmbiguous(const httplib::Result& resp) {
+    return !resp || resp->status >= 500;
+}
+
+/**
+ * @brief Whether the server rejected a submission because its client_order_id is already in use.
+ */
+inline bool isDuplicateClientOrderId(const httplib::Result& resp) {
+    return resp && resp->status == 422 && resp->body.find("client_order_id") != std::string::npos;
+}
+
+enum class OrderLookup {
+    Found,
+    NotFound,
+    Unknown,
+};
+
+/**
+ * @brief Find the order with client_order_id in cache (if any) or via REST, retrying failed lookups until deadline.
+ */
+inline OrderLookup lookupOrder(httplib::Client& client, const httplib::Headers& headers,
+                               std::string_view client_order_id, const OrderCache* cache, RateLimiter* limiter,
+                               const OrderSubmitConfig& config, std::chrono::steady_clock::time_point deadline,
+                               Order& order) {
+    const httplib::Params params = {{"client_order_id", std::string(client_order_id)}};
+    while (true) {
+        if (cache != nullptr) {
+            if (std::shared_ptr<const Order> cached = cache->findByClientOrderId(client_order_id)) {
+                order = *cached;
+                return OrderLookup::Found;
+            }
+        }
+
+        pace(limiter);
+        httplib::Result resp = client.Get("/v2/orders:by_client_order_id", params, headers);
+        if (resp && resp->status == 200 && order.fromJSON(std::move(resp->body)).ok()) {
+            return OrderLookup::Found;
+        }
+        if (resp && resp->status == 404) {
+            return OrderLookup::NotFound;
+        }
+
+        if (std::chrono::steady_clock::now() + config.lookup_interval >= deadline) {
+            return OrderLookup::Unknown;
+        }
+        std::this_thread::sleep_for(config.lookup_interval);
+    }
+}
+
+/**
+ * @brief POST an order body, resolving ambiguous failures by client_order_id before resending it.
+ *
+ * See OrderSubmitConfig. Without a client_order_id an ambiguous failure cannot be resolved, so the body is
+ * sent once. When the outcome is still unresolved at the end, the returned Order carries only the
+ * client_order_id sent, so the caller can look the order up or retry with the same id. Sets http_status to
+ * the status of the last POST (0 if it got no response).
+ */
+inline std::pair<Status, Order> submitOrderBody(httplib::Client& client, const httplib::Headers& headers,
+                                                const std::string& body, std::string_view client_order_id,
+                                                const Environment& environment, const OrderCache* cache,
+                                                RateLimiter* limiter, int& http_status) {
+    const OrderSubmitConfig& config = environment.getOrderSubmitConfig();
+    auto deadline = std::chrono::steady_clock::now() + config.budget;
+    auto send = [&] {
+        httplib::Result resp = sendRateLimited(environment.getRetryConfig(), limiter, [&] {
+            return client.Post("/v2/orders", headers, body, "application/json");
+        });
+        http_status = resp ? resp->status : 0;
+        return resp;
+    };
+
+    httplib::Result resp = send();
+    if (client_order_id.empty()) {
+        return decodeOrderResponse("/v2/orders", resp);
+    }
+
+    for (int resubmits = 0;; ++resubmits) {
+        // A duplicate rejection of a resubmission means an earlier attempt was accepted after all
+        bool duplicate = resubmits > 0 && isDuplicateClientOrderId(resp);
+        if (!isAmbiguous(resp) && !duplicate) {
+            return decodeOrderResponse("/v2/orders", resp);
+        }
+
+        Order order;
+        switch (lookupOrder(client, headers, client_order_id, cache, limiter, config, deadline, order)) {
+            case OrderLookup::Found:
+                return std::make_pair(Status(), order);
+            case OrderLookup::Unknown: {
+                std::ostringstream ss;
+                ss << "Order with client_order_id " << client_order_id
+                   << " may have been accepted; its state could not be determined within the submit budget."
+                   << " Look it up, or retry with the same client_order_id so a duplicate is rejected";
+                Order unresolved;
+                unresolved.client_order_id = std::string(client_order_id);
+                return std::make_pair(Status(1, ss.str()), unresolved);
+            }
+            case OrderLookup::NotFound:
+                break;
+        }
+
+        if (resubmits >= config.max_resubmits || std::chrono::steady_clock::now() >= deadline) {
+            // The last lookup found nothing, but a submission still in flight may yet be accepted
+            std::pair<Status, Order> failure = decodeOrderResponse("/v2/orders", resp);
+            std::ostringstream ss;
+            ss << failure.first.getMessage() << " (no order with client_order_id " << client_order_id
+               << " was found after " << resubmits + 1
+               << " submissions; retry with the same client_order_id so a late arrival is rejected as a duplicate)";
+            failure.first = Status(1, ss.str());
+            failure.second = Order();
+            failure.second.client_order_id = std::string(client_order_id);
+            return failure;
+        }
+        resp = send();
+    }
+}
+
+}  // namespace alpaca::markets::detail
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Client-side request pacing for the REST client.
+//
+// The trading API allows a fixed number of requests per account per minute and
+// answers anything beyond it with HTTP 429. Batch order operations pace
+// themselves with a RateLimiter instead of bursting into that limit and
+// backing off.
+namespace alpaca::markets::detail {
+
+/**
+ * @brief Allow at most max_requests acquire() calls in any sliding window, blocking callers until one is allowed.
+ *
+ * Keeps the time of each of the last max_requests grants in a ring; a caller waits until the oldest of them
+ * has left the window. Callers wait in turn, holding the lock, so grants stay in arrival order.
+ */
+class RateLimiter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RateLimiter(std::size_t max_requests, Clock::duration window)
+        : window_(window), grants_(max_requests, Clock::time_point::min()) {}
+
+    void acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Clock::time_point& oldest = grants_[next_];
+        if (oldest != Clock::time_point::min()) {
+            std::this_thread::sleep_until(oldest + window_);
+        }
+        oldest = Clock::now();
+        next_ = (next_ + 1) % grants_.size();
+    }
+
+private:
+    std::mutex mutex_;
+    Clock::duration window_;
+    std::vector<Clock::time_point> grants_;
+    std::size_t next_ = 0;
+};
+
+}  // namespace alpaca::markets::detail
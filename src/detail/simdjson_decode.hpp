@@ -0,0 +1,67 @@
+#pragma once
+
+#include <alpaca/markets/models/bars.hpp>
+#include <alpaca/markets/models/crypto.hpp>
+#include <alpaca/markets/models/multi_quote.hpp>
+#include <alpaca/markets/models/multi_trade.hpp>
+#include <alpaca/markets/models/quote.hpp>
+#include <alpaca/markets/models/snapshot.hpp>
+#include <alpaca/markets/models/status.hpp>
+#include <alpaca/markets/models/symbol_map.hpp>
+#include <alpaca/markets/models/trade.hpp>
+
+#include <string>
+#include <string_view>
+
+// simdjson On-Demand decoders for the high-volume market data models. These are
+// only compiled when the library is configured with
+// ALPACA_MARKETS_JSON_BACKEND=simdjson and produce the same model state as the
+// RapidJSON decoders in decode.hpp.
+//
+// The multi-symbol "latest" and snapshot endpoints decode through
+// decodeSymbolMapJSON(), which the REST client calls when it is built with the
+// same backend.
+//
+// The const overloads copy the input into a padded buffer; the mutable
+// overloads grow the string's capacity in place to satisfy simdjson's padding
+// requirement and avoid the copy.
+namespace alpaca::markets::detail::simd {
+
+Status decodeJSON(const std::string& json, Bars& bars, const char* parse_error);
+Status decodeJSON(std::string& json, Bars& bars, const char* parse_error);
+Status decodeJSON(const std::string& json, MultiTrades& multi_trades, const char* parse_error);
+Status decodeJSON(std::string& json, MultiTrades& multi_trades, const char* parse_error);
+Status decodeJSON(const std::string& json, MultiQuotes& multi_quotes, const char* parse_error);
+Status decodeJSON(std::string& json, MultiQuotes& multi_quotes, const char* parse_error);
+Status decodeJSON(const std::string& json, Snapshots& snapshots, const char* parse_error);
+Status decodeJSON(std::string& json, Snapshots& snapshots, const char* parse_error);
+Status decodeJSON(const std::string& json, CryptoTrades& trades, const char* parse_error);
+Status decodeJSON(std::string& json, CryptoTrades& trades, const char* parse_error);
+Status decodeJSON(const std::string& json, CryptoQuotes& quotes, const char* parse_error);
+Status decodeJSON(std::string& json, CryptoQuotes& quotes, const char* parse_error);
+Status decodeJSON(const std::string& json, CryptoBars& bars, const char* parse_error);
+Status decodeJSON(std::string& json, CryptoBars& bars, const char* parse_error);
+
+/**
+ * @brief Decode a "symbol -> {...}" response into a SymbolMap, parsing the buffer in place.
+ *
+ * member names the object holding the symbol map, or is empty when the symbols are keys of the root object.
+ */
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Trade>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Quote>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Bar>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Snapshot>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoTrade>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoQuote>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoBar>& out,
+                           const char* parse_error);
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoSnapshot>& out,
+                           const char* parse_error);
+
+}  // namespace alpaca::markets::detail::simd
@@ -1,111 +1,158 @@
 #include <alpaca/markets/account.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Account::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing account JSON");
+namespace {
+const char* kAccountParseError = "Received parse error when deserializing account JSON";
+const char* kAccountConfigurationsParseError = "Received parse error when deserializing account configurations JSON";
+const char* kTradeActivityParseError = "Received parse error when deserializing trade activity JSON";
+const char* kNonTradeActivityParseError = "Received parse error when deserializing non-trade activity JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kAccountFields = makeFieldTable<Account>(
+    field("account_blocked", &Account::account_blocked),
+    field("account_number", &Account::account_number),
+    field("buying_power", &Account::buying_power),
+    field("cash", &Account::cash),
+    field("created_at", &Account::created_at),
+    field("currency", &Account::currency),
+    field("daytrade_count", &Account::daytrade_count),
+    field("daytrading_buying_power", &Account::daytrading_buying_power),
+    field("equity", &Account::equity),
+    field("id", &Account::id),
+    field("initial_margin", &Account::initial_margin),
+    field("last_equity", &Account::last_equity),
+    field("last_maintenance_margin", &Account::last_maintenance_margin),
+    field("long_market_value", &Account::long_market_value),
+    field("maintenance_margin", &Account::maintenance_margin),
+    field("multiplier", &Account::multiplier),
+    field("pattern_day_trader", &Account::pattern_day_trader),
+    field("portfolio_value", &Account::portfolio_value),
+    field("regt_buying_power", &Account::regt_buying_power),
+    field("short_market_value", &Account::short_market_value),
+    field("shorting_enabled", &Account::shorting_enabled),
+    field("sma", &Account::sma),
+    field("status", &Account::status),
+    field("trade_suspended_by_user", &Account::trade_suspended_by_user),
+    field("trading_blocked", &Account::trading_blocked),
+    field("transfers_blocked", &Account::transfers_blocked));
+
+constexpr auto kAccountConfigurationsFields = makeFieldTable<AccountConfigurations>(
+    field("dtbp_check", &AccountConfigurations::dtbp_check),
+    field("no_shorting", &AccountConfigurations::no_shorting),
+    field("suspend_trade", &AccountConfigurations::suspend_trade),
+    field("trade_confirm_email", &AccountConfigurations::trade_confirm_email));
+
+constexpr auto kTradeActivityFields = makeFieldTable<TradeActivity>(
+    field("activity_type", &TradeActivity::activity_type),
+    field("cum_qty", &TradeActivity::cum_qty),
+    field("id", &TradeActivity::id),
+    field("leaves_qty", &TradeActivity::leaves_qty),
+    field("order_id", &TradeActivity::order_id),
+    field("price", &TradeActivity::price),
+    field("qty", &TradeActivity::qty),
+    field("side", &TradeActivity::side),
+    field("symbol", &TradeActivity::symbol),
+    field("transaction_time", &TradeActivity::transaction_time),
+    field("type", &TradeActivity::type));
+
+constexpr auto kNonTradeActivityFields = makeFieldTable<NonTradeActivity>(
+    field("activity_type", &NonTradeActivity::activity_type),
+    field("date", &NonTradeActivity::date),
+    field("id", &NonTradeActivity::id),
+    field("net_amount", &NonTradeActivity::net_amount),
+    field("per_share_amount", &NonTradeActivity::per_share_amount),
+    field("qty", &NonTradeActivity::qty),
+    field("symbol", &NonTradeActivity::symbol));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Account& account) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't an account object");
     }
+    return decodeFields(d, account, kAccountFields);
+}
 
+Status decode(const rapidjson::Value& d, AccountConfigurations& account_configurations) {
     if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't an account object");
+        return Status(1, "Deserialized valid JSON but it wasn't an account configurations object");
     }
+    return decodeFields(d, account_configurations, kAccountConfigurationsFields);
+}
 
-    PARSE_BOOL(account_blocked, "account_blocked")
-    PARSE_STRING(account_number, "account_number")
-    PARSE_STRING(buying_power, "buying_power")
-    PARSE_STRING(cash, "cash")
-    PARSE_STRING(created_at, "created_at")
-    PARSE_STRING(currency, "currency")
-    PARSE_INT(daytrade_count, "daytrade_count")
-    PARSE_STRING(daytrading_buying_power, "daytrading_buying_power")
-    PARSE_STRING(equity, "equity")
-    PARSE_STRING(id, "id")
-    PARSE_STRING(initial_margin, "initial_margin")
-    PARSE_STRING(last_equity, "last_equity")
-    PARSE_STRING(last_maintenance_margin, "last_maintenance_margin")
-    PARSE_STRING(long_market_value, "long_market_value")
-    PARSE_STRING(maintenance_margin, "maintenance_margin")
-    PARSE_STRING(multiplier, "multiplier")
-    PARSE_BOOL(pattern_day_trader, "pattern_day_trader")
-    PARSE_STRING(portfolio_value, "portfolio_value")
-    PARSE_STRING(regt_buying_power, "regt_buying_power")
-    PARSE_STRING(short_market_value, "short_market_value")
-    PARSE_BOOL(shorting_enabled, "shorting_enabled")
-    PARSE_STRING(sma, "sma")
-    PARSE_STRING(status, "status")
-    PARSE_BOOL(trade_suspended_by_user, "trade_suspended_by_user")
-    PARSE_BOOL(trading_blocked, "trading_blocked")
-    PARSE_BOOL(transfers_blocked, "transfers_blocked")
-
-    return Status();
+void encode(const AccountConfigurations& account_configurations, JSONWriter& writer) {
+    encodeFields(account_configurations, writer, kAccountConfigurationsFields);
 }
 
-Status AccountConfigurations::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing account configurations JSON");
+Status decode(const rapidjson::Value& d, TradeActivity& activity) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a trade activity object");
     }
+    return decodeFields(d, activity, kTradeActivityFields);
+}
 
+Status decode(const rapidjson::Value& d, NonTradeActivity& activity) {
     if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't an account configurations object");
+        return Status(1, "Deserialized valid JSON but it wasn't a non-trade activity object");
     }
+    return decodeFields(d, activity, kNonTradeActivityFields);
+}
 
-    PARSE_STRING(dtbp_check, "dtbp_check")
-    PARSE_BOOL(no_shorting, "no_shorting")
-    PARSE_BOOL(suspend_trade, "suspend_trade")
-    PARSE_STRING(trade_confirm_email, "trade_confirm_email")
+}  // namespace detail
 
-    return Status();
+Status Account::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kAccountParseError);
+    }
+    return detail::decode(d, *this);
 }
 
-Status TradeActivity::fromJSON(const std::string& json) {
+Status Account::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAccountParseError);
+}
+
+Status AccountConfigurations::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing trade activity JSON");
+        return Status(1, kAccountConfigurationsParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a trade activity object");
+Status AccountConfigurations::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAccountConfigurationsParseError);
+}
+
+Status TradeActivity::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kTradeActivityParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(activity_type, "activity_type")
-    PARSE_STRING(cum_qty, "cum_qty")
-    PARSE_STRING(id, "id")
-    PARSE_STRING(leaves_qty, "leaves_qty")
-    PARSE_STRING(order_id, "order_id")
-    PARSE_STRING(price, "price")
-    PARSE_STRING(qty, "qty")
-    PARSE_STRING(side, "side")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_STRING(transaction_time, "transaction_time")
-    PARSE_STRING(type, "type")
-
-    return Status();
+Status TradeActivity::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kTradeActivityParseError);
 }
 
 Status NonTradeActivity::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing non-trade activity JSON");
-    }
-
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a non-trade activity object");
+        return Status(1, kNonTradeActivityParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(activity_type, "activity_type")
-    PARSE_STRING(date, "date")
-    PARSE_STRING(id, "id")
-    PARSE_STRING(net_amount, "net_amount")
-    PARSE_STRING(per_share_amount, "per_share_amount")
-    PARSE_STRING(qty, "qty")
-    PARSE_STRING(symbol, "symbol")
-
-    return Status();
+Status NonTradeActivity::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kNonTradeActivityParseError);
 }
 
 }  // namespace alpaca::markets
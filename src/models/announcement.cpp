@@ -1,9 +1,13 @@
 #include <alpaca/markets/announcement.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
+namespace {
+const char* kAnnouncementParseError = "Received parse error when deserializing announcement JSON";
+}  // namespace
+
 std::string announcementTypeToString(AnnouncementType type) {
     switch (type) {
         case AnnouncementType::Dividend:
@@ -34,33 +38,48 @@ std::string announcementDateTypeToString(AnnouncementDateType type) {
     }
 }
 
-Status Announcement::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing announcement JSON");
-    }
+namespace detail {
+
+namespace {
+
+constexpr auto kAnnouncementFields = makeFieldTable<Announcement>(
+    field("id", &Announcement::id),
+    field("corporate_actions_id", &Announcement::corporate_actions_id),
+    field("ca_type", &Announcement::ca_type),
+    field("ca_sub_type", &Announcement::ca_sub_type),
+    field("initiating_symbol", &Announcement::initiating_symbol),
+    field("initiating_original_cusip", &Announcement::initiating_original_cusip),
+    field("target_symbol", &Announcement::target_symbol),
+    field("target_original_cusip", &Announcement::target_original_cusip),
+    field("declaration_date", &Announcement::declaration_date),
+    field("expiration_date", &Announcement::expiration_date),
+    field("record_date", &Announcement::record_date),
+    field("payable_date", &Announcement::payable_date),
+    field("cash", &Announcement::cash),
+    field("old_rate", &Announcement::old_rate),
+    field("new_rate", &Announcement::new_rate));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, Announcement& announcement) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't an announcement object");
     }
+    return decodeFields(d, announcement, kAnnouncementFields);
+}
+
+}  // namespace detail
 
-    PARSE_STRING(id, "id")
-    PARSE_STRING(corporate_actions_id, "corporate_actions_id")
-    PARSE_STRING(ca_type, "ca_type")
-    PARSE_STRING(ca_sub_type, "ca_sub_type")
-    PARSE_STRING(initiating_symbol, "initiating_symbol")
-    PARSE_STRING(initiating_original_cusip, "initiating_original_cusip")
-    PARSE_STRING(target_symbol, "target_symbol")
-    PARSE_STRING(target_original_cusip, "target_original_cusip")
-    PARSE_STRING(declaration_date, "declaration_date")
-    PARSE_STRING(expiration_date, "expiration_date")
-    PARSE_STRING(record_date, "record_date")
-    PARSE_STRING(payable_date, "payable_date")
-    PARSE_STRING(cash, "cash")
-    PARSE_STRING(old_rate, "old_rate")
-    PARSE_STRING(new_rate, "new_rate")
+Status Announcement::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kAnnouncementParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status Announcement::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAnnouncementParseError);
 }
 
 }  // namespace alpaca::markets
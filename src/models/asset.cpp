@@ -1,9 +1,13 @@
 #include <alpaca/markets/asset.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
+namespace {
+const char* kAssetParseError = "Received parse error when deserializing asset JSON";
+}  // namespace
+
 std::string assetClassToString(AssetClass asset_class) {
     switch (asset_class) {
         case AssetClass::USEquity:
@@ -15,30 +19,45 @@ std::string assetClassToString(AssetClass asset_class) {
     }
 }
 
-Status Asset::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing asset JSON");
-    }
+namespace detail {
+
+namespace {
+
+constexpr auto kAssetFields = makeFieldTable<Asset>(
+    field("class", &Asset::asset_class),
+    field("easy_to_borrow", &Asset::easy_to_borrow),
+    field("exchange", &Asset::exchange),
+    field("id", &Asset::id),
+    field("marginable", &Asset::marginable),
+    field("shortable", &Asset::shortable),
+    field("status", &Asset::status),
+    field("symbol", &Asset::symbol),
+    field("tradable", &Asset::tradable),
+    field("fractionable", &Asset::fractionable),
+    field("name", &Asset::name),
+    field("maintenance_margin_requirement", &Asset::maintenance_margin_requirement));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, Asset& asset) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't an asset object");
     }
+    return decodeFields(d, asset, kAssetFields);
+}
+
+}  // namespace detail
+
+Status Asset::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kAssetParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(asset_class, "class")
-    PARSE_BOOL(easy_to_borrow, "easy_to_borrow")
-    PARSE_STRING(exchange, "exchange")
-    PARSE_STRING(id, "id")
-    PARSE_BOOL(marginable, "marginable")
-    PARSE_BOOL(shortable, "shortable")
-    PARSE_STRING(status, "status")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_BOOL(tradable, "tradable")
-    PARSE_BOOL(fractionable, "fractionable")
-    PARSE_STRING(name, "name")
-    PARSE_UINT(maintenance_margin_requirement, "maintenance_margin_requirement")
-
-    return Status();
+Status Asset::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAssetParseError);
 }
 
 }  // namespace alpaca::markets
@@ -0,0 +1,162 @@
+#include <alpaca/markets/asset_universe.hpp>
+
+#include <utility>
+
+namespace alpaca::markets {
+
+AssetMask::AssetMask(std::size_t size, bool value) : size_(size), words_((size + 63) / 64, value ? ~uint64_t{0} : 0) {
+    if (value && size % 64 != 0) {
+        words_.back() &= (uint64_t{1} << (size % 64)) - 1;
+    }
+}
+
+void AssetMask::set(std::size_t index, bool value) {
+    uint64_t bit = uint64_t{1} << (index % 64);
+    if (value) {
+        words_[index / 64] |= bit;
+    } else {
+        words_[index / 64] &= ~bit;
+    }
+}
+
+std::size_t AssetMask::count() const {
+    std::size_t total = 0;
+    for (uint64_t word : words_) {
+        total += static_cast<std::size_t>(std::popcount(word));
+    }
+    return total;
+}
+
+AssetMask& AssetMask::operator&=(const AssetMask& other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] &= w < other.words_.size() ? other.words_[w] : 0;
+    }
+    return *this;
+}
+
+AssetMask& AssetMask::operator|=(const AssetMask& other) {
+    if (other.size_ > size_) {
+        resize(other.size_);
+    }
+    for (std::size_t w = 0; w < other.words_.size(); ++w) {
+        words_[w] |= other.words_[w];
+    }
+    return *this;
+}
+
+AssetMask& AssetMask::subtract(const AssetMask& other) {
+    for (std::size_t w = 0; w < words_.size() && w < other.words_.size(); ++w) {
+        words_[w] &= ~other.words_[w];
+    }
+    return *this;
+}
+
+void AssetMask::resize(std::size_t size) {
+    size_ = size;
+    words_.resize((size + 63) / 64, 0);
+}
+
+AssetUniverse::AssetUniverse(std::vector<Asset> assets) {
+    refresh(std::move(assets));
+}
+
+AssetUniverse::RefreshStats AssetUniverse::refresh(std::vector<Asset> assets) {
+    RefreshStats stats;
+    AssetMask seen(assets_.size());
+    index_.reserve(assets_.size() + assets.size());
+    for (Asset& asset : assets) {
+        auto [it, inserted] = index_.try_emplace(asset.symbol, assets_.size());
+        if (inserted) {
+            assets_.push_back(std::move(asset));
+            ++stats.added;
+            continue;
+        }
+        assets_[it->second] = std::move(asset);
+        // A symbol repeated within this result may already have been added above
+        if (it->second < seen.size()) {
+            seen.set(it->second);
+            ++stats.updated;
+        }
+    }
+
+    resizeColumns();
+    // Previously active assets which were not in this result
+    AssetMask removed = active_;
+    removed.subtract(seen);
+    stats.removed = removed.count();
+
+    active_ = seen;
+    active_.resize(assets_.size());
+    for (std::size_t index = seen.size(); index < assets_.size(); ++index) {
+        active_.set(index);
+    }
+    for (std::size_t index = 0; index < assets_.size(); ++index) {
+        if (active_.test(index)) {
+            setFlags(index, assets_[index]);
+        } else {
+            for (AssetMask& column : columns_) {
+                column.set(index, false);
+            }
+        }
+    }
+    return stats;
+}
+
+std::size_t AssetUniverse::upsert(Asset asset) {
+    auto [it, inserted] = index_.try_emplace(asset.symbol, assets_.size());
+    if (inserted) {
+        assets_.push_back(std::move(asset));
+        resizeColumns();
+        active_.resize(assets_.size());
+    } else {
+        assets_[it->second] = std::move(asset);
+    }
+    active_.set(it->second);
+    setFlags(it->second, assets_[it->second]);
+    return it->second;
+}
+
+std::size_t AssetUniverse::indexOf(std::string_view symbol) const {
+    auto it = index_.find(symbol);
+    return it == index_.end() ? npos : it->second;
+}
+
+const Asset* AssetUniverse::find(std::string_view symbol) const {
+    std::size_t index = indexOf(symbol);
+    return index == npos ? nullptr : &assets_[index];
+}
+
+AssetMask AssetUniverse::select(std::initializer_list<AssetFlag> flags) const {
+    AssetMask mask = active_;
+    for (AssetFlag flag : flags) {
+        mask &= column(flag);
+    }
+    return mask;
+}
+
+std::vector<std::string> AssetUniverse::symbols(const AssetMask& mask) const {
+    std::vector<std::string> result;
+    result.reserve(mask.count());
+    mask.forEach([&](std::size_t index) {
+        if (index < assets_.size()) {
+            result.push_back(assets_[index].symbol);
+        }
+    });
+    return result;
+}
+
+void AssetUniverse::setFlags(std::size_t index, const Asset& asset) {
+    columns_[static_cast<std::size_t>(AssetFlag::Tradable)].set(index, asset.tradable);
+    columns_[static_cast<std::size_t>(AssetFlag::Shortable)].set(index, asset.shortable);
+    columns_[static_cast<std::size_t>(AssetFlag::Marginable)].set(index, asset.marginable);
+    columns_[static_cast<std::size_t>(AssetFlag::EasyToBorrow)].set(index, asset.easy_to_borrow);
+    columns_[static_cast<std::size_t>(AssetFlag::Fractionable)].set(index, asset.fractionable);
+}
+
+void AssetUniverse::resizeColumns() {
+    for (AssetMask& column : columns_) {
+        column.resize(assets_.size());
+    }
+}
+
+}  // namespace alpaca::markets
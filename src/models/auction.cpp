@@ -1,91 +1,93 @@
 #include <alpaca/markets/auction.hpp>
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Auction::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing auction JSON");
-    }
+namespace {
+const char* kAuctionParseError = "Received parse error when deserializing auction JSON";
+const char* kSymbolAuctionsParseError = "Received parse error when deserializing symbol auctions JSON";
+const char* kAuctionsParseError = "Received parse error when deserializing auctions JSON";
+}  // namespace
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't an auction object");
-    }
+namespace detail {
 
-    PARSE_STRING(timestamp, "t")
-    PARSE_DOUBLE(price, "p")
-    PARSE_UINT64(size, "s")
-    PARSE_STRING(exchange, "x")
-    PARSE_STRING(condition, "c")
+namespace {
 
-    return Status();
-}
+constexpr auto kAuctionFields = makeFieldTable<Auction>(
+    field("t", &Auction::timestamp),
+    field("p", &Auction::price),
+    field("s", &Auction::size),
+    field("x", &Auction::exchange),
+    field("c", &Auction::condition));
 
-Status SymbolAuctions::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing symbol auctions JSON");
+// Daily auctions are under "d"
+constexpr auto kSymbolAuctionsFields = makeFieldTable<SymbolAuctions>(
+    arrayField<&SymbolAuctions::daily_auctions>("d"));
+
+constexpr auto kAuctionsFields = makeFieldTable<Auctions>(
+    symbolObjectsField<&Auctions::auctions>("auctions"),
+    field("next_page_token", &Auctions::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Auction& auction) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't an auction object");
     }
+    return decodeFields(d, auction, kAuctionFields);
+}
 
+Status decode(const rapidjson::Value& d, SymbolAuctions& symbol_auctions) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a symbol auctions object");
     }
+    return decodeFields(d, symbol_auctions, kSymbolAuctionsFields);
+}
 
-    // Parse daily auctions array "d"
-    if (d.HasMember("d") && d["d"].IsArray()) {
-        for (auto& o : d["d"].GetArray()) {
-            Auction auction;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            o.Accept(writer);
-            if (Status status = auction.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            daily_auctions.push_back(auction);
-        }
+Status decode(const rapidjson::Value& d, Auctions& auctions) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't an auctions object");
     }
-
-    return Status();
+    return decodeFields(d, auctions, kAuctionsFields);
 }
 
-Status Auctions::fromJSON(const std::string& json) {
+}  // namespace detail
+
+Status Auction::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing auctions JSON");
+        return Status(1, kAuctionParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't an auctions object");
-    }
+Status Auction::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAuctionParseError);
+}
 
-    // Parse auctions map
-    if (d.HasMember("auctions") && d["auctions"].IsObject()) {
-        for (auto& m : d["auctions"].GetObject()) {
-            SymbolAuctions symbol_auctions;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = symbol_auctions.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            auctions[m.name.GetString()] = symbol_auctions;
-        }
+Status SymbolAuctions::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kSymbolAuctionsParseError);
     }
+    return detail::decode(d, *this);
+}
+
+Status SymbolAuctions::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kSymbolAuctionsParseError);
+}
 
-    // Parse next_page_token
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
+Status Auctions::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kAuctionsParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status Auctions::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kAuctionsParseError);
 }
 
 }  // namespace alpaca::markets
@@ -1,72 +1,83 @@
 #include <alpaca/markets/bars.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/simdjson_decode.hpp"
 
 namespace alpaca::markets {
 
-Status Bar::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing bar JSON");
-    }
+namespace {
+const char* kBarParseError = "Received parse error when deserializing bar JSON";
+const char* kBarsParseError = "Received parse error when deserializing bars JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
 
+// Market Data API v2 field names
+constexpr auto kBarFields = makeFieldTable<Bar>(
+    field("t", &Bar::timestamp),    // timestamp
+    field("o", &Bar::open_price),   // open
+    field("h", &Bar::high_price),   // high
+    field("l", &Bar::low_price),    // low
+    field("c", &Bar::close_price),  // close
+    field("v", &Bar::volume),       // volume
+    field("n", &Bar::trade_count),  // number of trades
+    field("vw", &Bar::vwap));       // volume weighted average price
+
+// v2 API: bars are under "bars" key, keyed by symbol
+constexpr auto kBarsFields = makeFieldTable<Bars>(
+    symbolArraysField<&Bars::bars>("bars"),
+    field("next_page_token", &Bars::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Bar& bar) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a bar object");
     }
+    return decodeFields(d, bar, kBarFields);
+}
 
-    // Market Data API v2 field names
-    PARSE_STRING(timestamp, "t")      // timestamp
-    PARSE_DOUBLE(open_price, "o")     // open
-    PARSE_DOUBLE(high_price, "h")     // high
-    PARSE_DOUBLE(low_price, "l")      // low
-    PARSE_DOUBLE(close_price, "c")    // close
-    PARSE_UINT64(volume, "v")         // volume
-    PARSE_UINT64(trade_count, "n")    // number of trades
-    PARSE_DOUBLE(vwap, "vw")          // volume weighted average price
-
-    return Status();
+Status decode(const rapidjson::Value& d, Bars& bars) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a bars object");
+    }
+    return decodeFields(d, bars, kBarsFields);
 }
 
-Status Bars::fromJSON(const std::string& json) {
+}  // namespace detail
+
+Status Bar::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing bars JSON");
+        return Status(1, kBarParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a bars object");
-    }
+Status Bar::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kBarParseError);
+}
 
-    // v2 API: bars are under "bars" key, keyed by symbol
-    if (d.HasMember("bars") && d["bars"].IsObject()) {
-        for (auto& m : d["bars"].GetObject()) {
-            std::string symbol = m.name.GetString();
-            std::vector<Bar> symbol_bars;
-
-            if (m.value.IsArray()) {
-                for (auto& b : m.value.GetArray()) {
-                    Bar bar;
-                    rapidjson::StringBuffer s;
-                    s.Clear();
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    b.Accept(writer);
-                    if (Status status = bar.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_bars.push_back(bar);
-                }
-            }
-            bars[symbol] = symbol_bars;
-        }
+Status Bars::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kBarsParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kBarsParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    // Pagination token
-    PARSE_STRING(next_page_token, "next_page_token")
-
-    return Status();
+Status Bars::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kBarsParseError);
+#else
+    return detail::decodeInsitu(json, *this, kBarsParseError);
+#endif
 }
 
 }  // namespace alpaca::markets
@@ -0,0 +1,139 @@
+#include <alpaca/markets/bulk_job.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace alpaca::markets {
+
+namespace {
+const char* kCheckpointQuery = "query";
+const char* kCheckpointPageToken = "page_token";
+const char* kCheckpointRows = "rows";
+const char* kCheckpointLastKey = "last_key";
+const char* kCheckpointComplete = "complete";
+const char* kCheckpointSinkBase = "sink_base";
+
+// Write all of data to fd and flush it to the disk
+bool writeAndSync(int fd, const std::string& data) {
+    std::size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<std::size_t>(n);
+    }
+    return ::fsync(fd) == 0;
+}
+
+// Flush a directory's entries, so a rename into it survives a crash
+bool syncDirectory(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+}
+}  // namespace
+
+int httpStatusOf(const Status& status) {
+    // Client errors read "... returned an HTTP 404: ..." or "... (HTTP 404, Code ...)"
+    std::string message = status.getMessage();
+    auto digit = [&message](std::size_t i) { return i < message.size() && message[i] >= '0' && message[i] <= '9'; };
+    for (std::size_t pos = message.find("HTTP "); pos != std::string::npos; pos = message.find("HTTP ", pos + 1)) {
+        std::size_t code = pos + 5;
+        if (digit(code) && digit(code + 1) && digit(code + 2) && !digit(code + 3)) {
+            return std::stoi(message.substr(code, 3));
+        }
+    }
+    return 0;
+}
+
+Status loadCheckpoint(const std::string& path, Checkpoint& checkpoint) {
+    checkpoint = Checkpoint{};
+    std::ifstream in(path);
+    if (!in) {
+        // No checkpoint yet: the job starts from the first page
+        return Status();
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        auto separator = line.find('=');
+        if (separator == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, separator);
+        std::string value = line.substr(separator + 1);
+        if (key == kCheckpointQuery) {
+            checkpoint.query = value;
+        } else if (key == kCheckpointPageToken) {
+            checkpoint.page_token = value;
+        } else if (key == kCheckpointRows) {
+            try {
+                checkpoint.rows = std::stoull(value);
+            } catch (const std::exception&) {
+                return Status(1, "Invalid row count in checkpoint " + path);
+            }
+        } else if (key == kCheckpointSinkBase) {
+            try {
+                checkpoint.sink_base = std::stoull(value);
+            } catch (const std::exception&) {
+                return Status(1, "Invalid sink size in checkpoint " + path);
+            }
+        } else if (key == kCheckpointLastKey) {
+            checkpoint.last_key = value;
+        } else if (key == kCheckpointComplete) {
+            checkpoint.complete = value == "1";
+        }
+    }
+    return Status();
+}
+
+Status saveCheckpoint(const std::string& path, const Checkpoint& checkpoint) {
+    if (checkpoint.query.find('\n') != std::string::npos || checkpoint.page_token.find('\n') != std::string::npos ||
+        checkpoint.last_key.find('\n') != std::string::npos) {
+        return Status(1, "Checkpoint values must not contain newlines");
+    }
+
+    std::ostringstream out;
+    out << kCheckpointQuery << "=" << checkpoint.query << "\n"
+        << kCheckpointPageToken << "=" << checkpoint.page_token << "\n"
+        << kCheckpointRows << "=" << checkpoint.rows << "\n"
+        << kCheckpointLastKey << "=" << checkpoint.last_key << "\n"
+        << kCheckpointComplete << "=" << (checkpoint.complete ? 1 : 0) << "\n"
+        << kCheckpointSinkBase << "=" << checkpoint.sink_base << "\n";
+
+    // The temporary file is synced before the rename, and the directory after it, so a crash leaves either the
+    // previous checkpoint or the complete new one, never an empty or partial file
+    std::string temp_path = path + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return Status(1, "Unable to write checkpoint " + temp_path);
+    }
+    bool written = writeAndSync(fd, out.str());
+    if (::close(fd) != 0 || !written) {
+        return Status(1, "Unable to write checkpoint " + temp_path);
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        return Status(1, "Unable to replace checkpoint " + path);
+    }
+    std::string directory = std::filesystem::path(path).parent_path().string();
+    if (!syncDirectory(directory.empty() ? "." : directory)) {
+        return Status(1, "Unable to sync the directory of checkpoint " + path);
+    }
+    return Status();
+}
+
+}  // namespace alpaca::markets
@@ -1,24 +1,43 @@
 #include <alpaca/markets/calendar.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Date::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing calendar date JSON");
-    }
+namespace {
+const char* kDateParseError = "Received parse error when deserializing calendar date JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kDateFields = makeFieldTable<Date>(
+    field("close", &Date::close),
+    field("date", &Date::date),
+    field("open", &Date::open));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, Date& date) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a calendar date object");
     }
+    return decodeFields(d, date, kDateFields);
+}
+
+}  // namespace detail
 
-    PARSE_STRING(close, "close")
-    PARSE_STRING(date, "date")
-    PARSE_STRING(open, "open")
+Status Date::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kDateParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status Date::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kDateParseError);
 }
 
 }  // namespace alpaca::markets
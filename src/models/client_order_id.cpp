@@ -0,0 +1,72 @@
+#include <alpaca/markets/client_order_id.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+namespace alpaca::markets {
+
+namespace {
+
+constexpr char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+// Write value as exactly width base-36 digits (keeping the low digits if it doesn't fit)
+char* writeBase36(char* out, std::uint64_t value, std::size_t width) {
+    for (std::size_t i = width; i > 0; --i) {
+        out[i - 1] = kDigits[value % 36];
+        value /= 36;
+    }
+    return out + width;
+}
+
+bool isIdChar(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-' || c == '_';
+}
+
+}  // namespace
+
+static_assert(ClientOrderIdGenerator::kMaxPrefixLength + ClientOrderIdGenerator::kTimeDigits +
+                      ClientOrderIdGenerator::kSequenceDigits + 2 <=
+                  ClientOrderId::kMaxLength,
+              "ClientOrderId too small for the longest generated id");
+
+ClientOrderIdGenerator::ClientOrderIdGenerator() {
+    std::random_device device;
+    std::uint64_t seed = (static_cast<std::uint64_t>(device()) << 32) ^ device();
+    prefix_size_ = 8;
+    writeBase36(prefix_.data(), seed, prefix_size_);
+}
+
+ClientOrderIdGenerator::ClientOrderIdGenerator(std::string_view prefix) {
+    prefix_size_ = std::min(prefix.size(), kMaxPrefixLength);
+    for (std::size_t i = 0; i < prefix_size_; ++i) {
+        prefix_[i] = isIdChar(prefix[i]) ? prefix[i] : '_';
+    }
+}
+
+ClientOrderIdGenerator& ClientOrderIdGenerator::global() {
+    static ClientOrderIdGenerator generator;
+    return generator;
+}
+
+ClientOrderId ClientOrderIdGenerator::next() {
+    std::uint64_t sequence = sequence_.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+
+    ClientOrderId id;
+    char* out = id.chars_.data();
+    for (std::size_t i = 0; i < prefix_size_; ++i) {
+        *out++ = prefix_[i];
+    }
+    if (prefix_size_ > 0) {
+        *out++ = '-';
+    }
+    out = writeBase36(out, static_cast<std::uint64_t>(now.count()), kTimeDigits);
+    *out++ = '-';
+    out = writeBase36(out, sequence, kSequenceDigits);
+    id.size_ = static_cast<std::uint8_t>(out - id.chars_.data());
+    return id;
+}
+
+}  // namespace alpaca::markets
@@ -1,25 +1,44 @@
 #include <alpaca/markets/clock.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Clock::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing clock JSON");
-    }
+namespace {
+const char* kClockParseError = "Received parse error when deserializing clock JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kClockFields = makeFieldTable<Clock>(
+    field("is_open", &Clock::is_open),
+    field("next_close", &Clock::next_close),
+    field("next_open", &Clock::next_open),
+    field("timestamp", &Clock::timestamp));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, Clock& clock) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a clock object");
     }
+    return decodeFields(d, clock, kClockFields);
+}
+
+}  // namespace detail
 
-    PARSE_BOOL(is_open, "is_open")
-    PARSE_STRING(next_close, "next_close")
-    PARSE_STRING(next_open, "next_open")
-    PARSE_STRING(timestamp, "timestamp")
+Status Clock::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kClockParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status Clock::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kClockParseError);
 }
 
 }  // namespace alpaca::markets
@@ -0,0 +1,112 @@
+#include <alpaca/markets/columns.hpp>
+
+#include <utility>
+
+namespace alpaca::markets {
+
+void TradeColumns::reserve(std::size_t n) {
+    timestamps.reserve(n);
+    prices.reserve(n);
+    sizes.reserve(n);
+    ids.reserve(n);
+    exchanges.reserve(n);
+    tapes.reserve(n);
+}
+
+void TradeColumns::append(std::vector<Trade>&& trades) {
+    for (Trade& trade : trades) {
+        timestamps.push_back(std::move(trade.timestamp));
+        prices.push_back(trade.price);
+        sizes.push_back(trade.size);
+        ids.push_back(trade.id);
+        exchanges.push_back(std::move(trade.exchange));
+        tapes.push_back(std::move(trade.tape));
+    }
+}
+
+void TradeColumns::truncate(std::size_t n) {
+    if (n >= size()) {
+        return;
+    }
+    timestamps.resize(n);
+    prices.resize(n);
+    sizes.resize(n);
+    ids.resize(n);
+    exchanges.resize(n);
+    tapes.resize(n);
+}
+
+void QuoteColumns::reserve(std::size_t n) {
+    timestamps.reserve(n);
+    bid_prices.reserve(n);
+    bid_sizes.reserve(n);
+    bid_exchanges.reserve(n);
+    ask_prices.reserve(n);
+    ask_sizes.reserve(n);
+    ask_exchanges.reserve(n);
+}
+
+void QuoteColumns::append(std::vector<Quote>&& quotes) {
+    for (Quote& quote : quotes) {
+        timestamps.push_back(std::move(quote.timestamp));
+        bid_prices.push_back(quote.bid_price);
+        bid_sizes.push_back(quote.bid_size);
+        bid_exchanges.push_back(std::move(quote.bid_exchange));
+        ask_prices.push_back(quote.ask_price);
+        ask_sizes.push_back(quote.ask_size);
+        ask_exchanges.push_back(std::move(quote.ask_exchange));
+    }
+}
+
+void QuoteColumns::truncate(std::size_t n) {
+    if (n >= size()) {
+        return;
+    }
+    timestamps.resize(n);
+    bid_prices.resize(n);
+    bid_sizes.resize(n);
+    bid_exchanges.resize(n);
+    ask_prices.resize(n);
+    ask_sizes.resize(n);
+    ask_exchanges.resize(n);
+}
+
+void BarColumns::reserve(std::size_t n) {
+    timestamps.reserve(n);
+    open_prices.reserve(n);
+    high_prices.reserve(n);
+    low_prices.reserve(n);
+    close_prices.reserve(n);
+    volumes.reserve(n);
+    trade_counts.reserve(n);
+    vwaps.reserve(n);
+}
+
+void BarColumns::append(std::vector<Bar>&& bars) {
+    for (Bar& bar : bars) {
+        timestamps.push_back(std::move(bar.timestamp));
+        open_prices.push_back(bar.open_price);
+        high_prices.push_back(bar.high_price);
+        low_prices.push_back(bar.low_price);
+        close_prices.push_back(bar.close_price);
+        volumes.push_back(bar.volume);
+        trade_counts.push_back(bar.trade_count);
+        vwaps.push_back(bar.vwap);
+    }
+}
+
+void BarColumns::truncate(std::size_t n) {
+    if (n >= size()) {
+        return;
+    }
+    timestamps.resize(n);
+    open_prices.resize(n);
+    high_prices.resize(n);
+    low_prices.resize(n);
+    close_prices.resize(n);
+    volumes.resize(n);
+    trade_counts.resize(n);
+    vwaps.resize(n);
+}
+
+}  // namespace alpaca::markets
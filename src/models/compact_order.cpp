@@ -0,0 +1,403 @@
+#include <alpaca/markets/compact_order.hpp>
+
+#include <array>
+#include <chrono>
+
+#include <rapidjson/reader.h>
+
+#include "../detail/fields.hpp"
+
+namespace alpaca::markets {
+
+namespace {
+
+const char* kCompactOrderParseError = "Received parse error when deserializing order JSON";
+const char* kCompactOrdersParseError = "Received parse error when deserializing orders JSON";
+const char* kNotAnOrderObject = "Deserialized valid JSON but it wasn't an order object";
+const char* kNotAnOrdersArray = "Deserialized valid JSON but it wasn't an array of orders";
+
+// Read count digits starting at pos; false if any is not a digit
+bool readDigits(std::string_view text, std::size_t pos, std::size_t count, int& out) {
+    out = 0;
+    for (std::size_t i = pos; i < pos + count; ++i) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+        out = out * 10 + (text[i] - '0');
+    }
+    return true;
+}
+
+}  // namespace
+
+std::optional<std::int64_t> parseTimestampNanos(std::string_view text) {
+    // "YYYY-MM-DDTHH:MM:SS" then an optional fraction and a required offset
+    if (text.size() < 20 || text[4] != '-' || text[7] != '-' || (text[10] != 'T' && text[10] != 't') ||
+        text[13] != ':' || text[16] != ':') {
+        return std::nullopt;
+    }
+    int year, month, day, hour, minute, second;
+    if (!readDigits(text, 0, 4, year) || !readDigits(text, 5, 2, month) || !readDigits(text, 8, 2, day) ||
+        !readDigits(text, 11, 2, hour) || !readDigits(text, 14, 2, minute) || !readDigits(text, 17, 2, second)) {
+        return std::nullopt;
+    }
+    std::chrono::year_month_day date{std::chrono::year(year), std::chrono::month(static_cast<unsigned>(month)),
+                                     std::chrono::day(static_cast<unsigned>(day))};
+    if (!date.ok() || hour > 23 || minute > 59 || second > 59) {
+        return std::nullopt;
+    }
+
+    std::size_t pos = 19;
+    std::int64_t nanos = 0;
+    if (text[pos] == '.') {
+        int digits = 0;
+        for (++pos; pos < text.size() && text[pos] >= '0' && text[pos] <= '9'; ++pos, ++digits) {
+            if (digits < 9) {
+                nanos = nanos * 10 + (text[pos] - '0');
+            }
+        }
+        if (digits == 0) {
+            return std::nullopt;
+        }
+        for (; digits < 9; ++digits) {
+            nanos *= 10;
+        }
+    }
+
+    std::int64_t offset_seconds = 0;
+    if (pos < text.size() && (text[pos] == 'Z' || text[pos] == 'z')) {
+        ++pos;
+    } else if (pos + 6 <= text.size() && (text[pos] == '+' || text[pos] == '-') && text[pos + 3] == ':') {
+        int offset_hours, offset_minutes;
+        if (!readDigits(text, pos + 1, 2, offset_hours) || !readDigits(text, pos + 4, 2, offset_minutes) ||
+            offset_hours > 23 || offset_minutes > 59) {
+            return std::nullopt;
+        }
+        offset_seconds = (offset_hours * 3600 + offset_minutes * 60) * (text[pos] == '-' ? -1 : 1);
+        pos += 6;
+    } else {
+        return std::nullopt;
+    }
+    if (pos != text.size()) {
+        return std::nullopt;
+    }
+
+    std::int64_t days = std::chrono::sys_days(date).time_since_epoch().count();
+    std::int64_t seconds = days * 86400 + hour * 3600 + minute * 60 + second - offset_seconds;
+    return seconds * 1'000'000'000 + nanos;
+}
+
+namespace detail {
+
+namespace {
+
+/**
+ * @brief How one CompactOrder member is read from its JSON value.
+ *
+ * Every member but extended_hours is sent as a string, which parse() converts
+ * in place; it returns false, and error prefixes the message, when the text
+ * doesn't fit or doesn't parse. extended_hours sets flag instead.
+ */
+struct CompactOrderField {
+    std::string_view name;
+    bool (*parse)(std::string_view text, CompactOrder& out) = nullptr;
+    const char* error = nullptr;
+    bool CompactOrder::*flag = nullptr;
+};
+
+template <auto Member>
+bool parseInlineString(std::string_view text, CompactOrder& out) {
+    return (out.*Member).assign(text);
+}
+
+template <auto Member>
+bool parseDecimal(std::string_view text, CompactOrder& out) {
+    std::optional<Decimal> value = Decimal::parse(text);
+    if (!value) {
+        return false;
+    }
+    out.*Member = *value;
+    return true;
+}
+
+template <auto Member>
+bool parseTimestamp(std::string_view text, CompactOrder& out) {
+    std::optional<std::int64_t> value = parseTimestampNanos(text);
+    if (!value) {
+        return false;
+    }
+    out.*Member = *value;
+    return true;
+}
+
+template <auto Member, auto FromString>
+bool parseEnum(std::string_view text, CompactOrder& out) {
+    out.*Member = FromString(text);
+    return true;
+}
+
+template <auto Member>
+constexpr CompactOrderField inlineStringField(std::string_view name) {
+    return {name, parseInlineString<Member>, "Order string is longer than its inline buffer: "};
+}
+
+template <auto Member>
+constexpr CompactOrderField decimalField(std::string_view name) {
+    return {name, parseDecimal<Member>, "Order number is not a decimal in range: "};
+}
+
+template <auto Member>
+constexpr CompactOrderField timestampField(std::string_view name) {
+    return {name, parseTimestamp<Member>, "Order timestamp is not RFC 3339: "};
+}
+
+template <auto Member, auto FromString>
+constexpr CompactOrderField enumViewField(std::string_view name) {
+    return {name, parseEnum<Member, FromString>};
+}
+
+constexpr CompactOrderField flagField(std::string_view name, bool CompactOrder::*member) {
+    return {name, nullptr, nullptr, member};
+}
+
+constexpr auto kCompactOrderFields = makeFieldTable<CompactOrder>(
+    inlineStringField<&CompactOrder::id>("id"),
+    inlineStringField<&CompactOrder::client_order_id>("client_order_id"),
+    inlineStringField<&CompactOrder::asset_id>("asset_id"),
+    inlineStringField<&CompactOrder::symbol>("symbol"),
+    inlineStringField<&CompactOrder::asset_class>("asset_class"),
+    enumViewField<&CompactOrder::side, stringToOrderSide>("side"),
+    enumViewField<&CompactOrder::type, stringToOrderType>("type"),
+    enumViewField<&CompactOrder::time_in_force, stringToOrderTimeInForce>("time_in_force"),
+    enumViewField<&CompactOrder::order_class, stringToOrderClass>("order_class"),
+    enumViewField<&CompactOrder::status, stringToOrderStatus>("status"),
+    flagField("extended_hours", &CompactOrder::extended_hours),
+    decimalField<&CompactOrder::qty>("qty"),
+    decimalField<&CompactOrder::notional>("notional"),
+    decimalField<&CompactOrder::filled_qty>("filled_qty"),
+    decimalField<&CompactOrder::filled_avg_price>("filled_avg_price"),
+    decimalField<&CompactOrder::limit_price>("limit_price"),
+    decimalField<&CompactOrder::stop_price>("stop_price"),
+    decimalField<&CompactOrder::trail_price>("trail_price"),
+    decimalField<&CompactOrder::trail_percent>("trail_percent"),
+    decimalField<&CompactOrder::hwm>("hwm"),
+    timestampField<&CompactOrder::created_at>("created_at"),
+    timestampField<&CompactOrder::updated_at>("updated_at"),
+    timestampField<&CompactOrder::submitted_at>("submitted_at"),
+    timestampField<&CompactOrder::filled_at>("filled_at"),
+    timestampField<&CompactOrder::expired_at>("expired_at"),
+    timestampField<&CompactOrder::canceled_at>("canceled_at"),
+    timestampField<&CompactOrder::failed_at>("failed_at"));
+
+/**
+ * @brief A RapidJSON SAX handler that writes each order member straight into its CompactOrder.
+ *
+ * The reader parses in situ, so keys and strings arrive as views of the input,
+ * unescaped in place: there is no document and no per-string copy. A key is
+ * looked up in kCompactOrderFields as soon as it is read and its value is
+ * parsed where it lies. Unknown keys and nested values (e.g. legs) are
+ * validated by the reader and ignored.
+ *
+ * The root must be an order object, or with Array an array of them; a valid
+ * document of another shape records the message finish() reports.
+ */
+class OrderHandler {
+public:
+    // Reads a single order into order
+    explicit OrderHandler(CompactOrder& order) : single_(&order), member_depth_(1) {}
+
+    // Reads an array of orders, appending to orders
+    explicit OrderHandler(std::vector<CompactOrder>& orders) : orders_(&orders), member_depth_(2) {}
+
+    // Parse the NUL-terminated json in place; the value error if one was recorded, else parse_error if the
+    // text isn't JSON, else the shape error if it isn't orders
+    Status parse(char* json, const char* parse_error) {
+        rapidjson::InsituStringStream stream(json);
+        rapidjson::Reader reader;
+        if (reader.Parse<rapidjson::kParseInsituFlag>(stream, *this).IsError()) {
+            if (!error_.ok()) {
+                return std::move(error_);
+            }
+            return Status(1, parse_error);
+        }
+        if (shape_error_ != nullptr) {
+            return Status(1, shape_error_);
+        }
+        return Status();
+    }
+
+    bool StartObject() {
+        if (depth_ == 0) {
+            if (single_ != nullptr) {
+                order_ = single_;
+            } else {
+                shape_error_ = kNotAnOrdersArray;
+            }
+        } else if (depth_ == 1 && orders_ != nullptr && shape_error_ != kNotAnOrdersArray) {
+            order_ = &orders_->emplace_back();
+        }
+        if (depth_ == member_depth_ - 1) {
+            member_ = 0;
+        }
+        return enter();
+    }
+
+    bool EndObject(rapidjson::SizeType) {
+        if (--depth_ == member_depth_ - 1) {
+            order_ = nullptr;
+        }
+        return true;
+    }
+
+    bool StartArray() {
+        if (depth_ == 0 ? single_ != nullptr : depth_ == 1 && orders_ != nullptr) {
+            element();
+        }
+        return enter();
+    }
+
+    bool EndArray(rapidjson::SizeType) {
+        --depth_;
+        return true;
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        if (depth_ == member_depth_ && order_ != nullptr) {
+            field_ = lookup(std::string_view(str, length), member_++);
+        }
+        return true;
+    }
+
+    // A member's value; values of a type the field doesn't take, e.g. null, are ignored like unknown keys
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        const CompactOrderField* field = member();
+        if (field == nullptr || field->parse == nullptr) {
+            return true;
+        }
+        std::string_view text(str, length);
+        if (!field->parse(text, *order_)) {
+            error_ = Status(1, field->error + std::string(text));
+            return false;
+        }
+        return true;
+    }
+
+    bool Bool(bool value) {
+        const CompactOrderField* field = member();
+        if (field != nullptr && field->flag != nullptr) {
+            order_->*(field->flag) = value;
+        }
+        return true;
+    }
+
+    bool Null() { return scalar(); }
+    bool Int(int) { return scalar(); }
+    bool Uint(unsigned) { return scalar(); }
+    bool Int64(std::int64_t) { return scalar(); }
+    bool Uint64(std::uint64_t) { return scalar(); }
+    bool Double(double) { return scalar(); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return scalar(); }
+
+private:
+    // Nesting is capped so hostile input can't exhaust the reader's recursion
+    bool enter() { return ++depth_ <= kMaxDepth; }
+
+    // A value that isn't an order where one is expected: the root, or an element of the orders array
+    void element() {
+        if (shape_error_ == nullptr) {
+            shape_error_ = depth_ == 0 && single_ == nullptr ? kNotAnOrdersArray : kNotAnOrderObject;
+        }
+    }
+
+    bool scalar() {
+        if (depth_ == 0 || (depth_ == 1 && orders_ != nullptr)) {
+            element();
+        }
+        return true;
+    }
+
+    // The field a string or bool at the current position is for, if it is a member of an order
+    const CompactOrderField* member() {
+        if (depth_ != member_depth_ || order_ == nullptr) {
+            scalar();
+            return nullptr;
+        }
+        return field_;
+    }
+
+    // The API lists every order's keys in the same order, so the key the previous order had at this
+    // position usually matches, and comparing against it is cheaper than hashing. Keys stay valid in the
+    // input for the whole parse.
+    const CompactOrderField* lookup(std::string_view key, std::size_t member) {
+        if (member >= seen_.size()) {
+            return kCompactOrderFields.find(key);
+        }
+        SeenKey& seen = seen_[member];
+        if (seen.key != key) {
+            seen = {key, kCompactOrderFields.find(key)};
+        }
+        return seen.field;
+    }
+
+    static constexpr int kMaxDepth = 256;
+
+    CompactOrder* single_ = nullptr;
+    std::vector<CompactOrder>* orders_ = nullptr;
+    // Containers open at an order's members: 1 for a single order, 2 for an array of them
+    int member_depth_;
+    int depth_ = 0;
+    // The order whose members are being read, if any
+    CompactOrder* order_ = nullptr;
+    const CompactOrderField* field_ = nullptr;
+    std::size_t member_ = 0;
+    Status error_;
+    const char* shape_error_ = nullptr;
+    struct SeenKey {
+        std::string_view key;
+        const CompactOrderField* field = nullptr;
+    };
+    std::array<SeenKey, 48> seen_;
+};
+
+}  // namespace
+
+}  // namespace detail
+
+namespace {
+
+// The input copied for an in-situ parse; kept per thread so a decoder reused on one thread doesn't allocate
+char* insituCopy(const std::string& json) {
+    thread_local std::string buffer;
+    buffer.assign(json);
+    return buffer.data();
+}
+
+Status decodeOrders(char* json, std::vector<CompactOrder>& orders) {
+    // clear() keeps the capacity, and CompactOrder is trivially destructible, so reuse is free
+    orders.clear();
+    Status status = detail::OrderHandler(orders).parse(json, kCompactOrdersParseError);
+    if (!status.ok()) {
+        orders.clear();
+    }
+    return status;
+}
+
+}  // namespace
+
+Status CompactOrder::fromJSON(const std::string& json) {
+    return detail::OrderHandler(*this).parse(insituCopy(json), kCompactOrderParseError);
+}
+
+Status CompactOrder::fromJSON(std::string&& json) {
+    return detail::OrderHandler(*this).parse(json.data(), kCompactOrderParseError);
+}
+
+Status CompactOrders::fromJSON(const std::string& json) {
+    return decodeOrders(insituCopy(json), orders);
+}
+
+Status CompactOrders::fromJSON(std::string&& json) {
+    return decodeOrders(json.data(), orders);
+}
+
+}  // namespace alpaca::markets
@@ -1,73 +1,79 @@
 #include <alpaca/markets/corporate_action.hpp>
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status CorporateAction::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing corporate action JSON");
-    }
+namespace {
+const char* kCorporateActionParseError = "Received parse error when deserializing corporate action JSON";
+const char* kCorporateActionsParseError = "Received parse error when deserializing corporate actions JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
 
+constexpr auto kCorporateActionFields = makeFieldTable<CorporateAction>(
+    field("id", &CorporateAction::id),
+    field("ca_type", &CorporateAction::corporate_action_type),
+    field("symbol", &CorporateAction::symbol),
+    field("new_symbol", &CorporateAction::new_symbol),
+    field("description", &CorporateAction::description),
+    field("process_date", &CorporateAction::process_date),
+    field("ex_date", &CorporateAction::ex_date),
+    field("record_date", &CorporateAction::record_date),
+    field("payable_date", &CorporateAction::payable_date),
+    field("old_rate", &CorporateAction::old_rate),
+    field("new_rate", &CorporateAction::new_rate),
+    field("rate", &CorporateAction::rate),
+    field("cash", &CorporateAction::cash),
+    field("created_at", &CorporateAction::created_at),
+    field("updated_at", &CorporateAction::updated_at));
+
+constexpr auto kCorporateActionsFields = makeFieldTable<CorporateActions>(
+    arrayField<&CorporateActions::corporate_actions>("corporate_actions"),
+    field("next_page_token", &CorporateActions::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, CorporateAction& action) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a corporate action object");
     }
-
-    PARSE_STRING(id, "id")
-    PARSE_STRING(corporate_action_type, "ca_type")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_STRING(new_symbol, "new_symbol")
-    PARSE_STRING(description, "description")
-    PARSE_STRING(process_date, "process_date")
-    PARSE_STRING(ex_date, "ex_date")
-    PARSE_STRING(record_date, "record_date")
-    PARSE_STRING(payable_date, "payable_date")
-    PARSE_DOUBLE(old_rate, "old_rate")
-    PARSE_DOUBLE(new_rate, "new_rate")
-    PARSE_DOUBLE(rate, "rate")
-    PARSE_DOUBLE(cash, "cash")
-    PARSE_STRING(created_at, "created_at")
-    PARSE_STRING(updated_at, "updated_at")
-
-    return Status();
+    return decodeFields(d, action, kCorporateActionFields);
 }
 
-Status CorporateActions::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing corporate actions JSON");
-    }
-
+Status decode(const rapidjson::Value& d, CorporateActions& actions) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a corporate actions object");
     }
+    return decodeFields(d, actions, kCorporateActionsFields);
+}
+
+}  // namespace detail
 
-    // Parse corporate_actions array
-    if (d.HasMember("corporate_actions") && d["corporate_actions"].IsArray()) {
-        for (auto& o : d["corporate_actions"].GetArray()) {
-            CorporateAction action;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            o.Accept(writer);
-            if (Status status = action.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            corporate_actions.push_back(action);
-        }
+Status CorporateAction::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCorporateActionParseError);
     }
+    return detail::decode(d, *this);
+}
+
+Status CorporateAction::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCorporateActionParseError);
+}
 
-    // Parse next_page_token
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
+Status CorporateActions::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCorporateActionsParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status CorporateActions::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCorporateActionsParseError);
 }
 
 }  // namespace alpaca::markets
@@ -1,12 +1,20 @@
 #include <alpaca/markets/crypto.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/simdjson_decode.hpp"
 
 namespace alpaca::markets {
 
+namespace {
+const char* kCryptoTradeParseError = "Received parse error when deserializing crypto trade JSON";
+const char* kCryptoQuoteParseError = "Received parse error when deserializing crypto quote JSON";
+const char* kCryptoBarParseError = "Received parse error when deserializing crypto bar JSON";
+const char* kCryptoSnapshotParseError = "Received parse error when deserializing crypto snapshot JSON";
+const char* kCryptoTradesParseError = "Received parse error when deserializing crypto trades JSON";
+const char* kCryptoQuotesParseError = "Received parse error when deserializing crypto quotes JSON";
+const char* kCryptoBarsParseError = "Received parse error when deserializing crypto bars JSON";
+}  // namespace
+
 std::string cryptoFeedToString(CryptoFeed feed) {
     switch (feed) {
         case CryptoFeed::US:
@@ -25,235 +33,212 @@ CryptoFeed stringToCryptoFeed(const std::string& s) {
     return CryptoFeed::US;
 }
 
-Status CryptoTrade::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto trade JSON");
-    }
-
+namespace detail {
+
+namespace {
+
+constexpr auto kCryptoTradeFields = makeFieldTable<CryptoTrade>(
+    field("p", &CryptoTrade::price),
+    field("s", &CryptoTrade::size),
+    field("t", &CryptoTrade::timestamp),
+    field("i", &CryptoTrade::id),
+    field("tks", &CryptoTrade::taker_side));
+
+constexpr auto kCryptoQuoteFields = makeFieldTable<CryptoQuote>(
+    field("ap", &CryptoQuote::ask_price),
+    field("as", &CryptoQuote::ask_size),
+    field("bp", &CryptoQuote::bid_price),
+    field("bs", &CryptoQuote::bid_size),
+    field("t", &CryptoQuote::timestamp));
+
+constexpr auto kCryptoBarFields = makeFieldTable<CryptoBar>(
+    field("t", &CryptoBar::timestamp),
+    field("o", &CryptoBar::open_price),
+    field("h", &CryptoBar::high_price),
+    field("l", &CryptoBar::low_price),
+    field("c", &CryptoBar::close_price),
+    field("v", &CryptoBar::volume),
+    field("n", &CryptoBar::trade_count),
+    field("vw", &CryptoBar::vwap));
+
+constexpr auto kCryptoSnapshotFields = makeFieldTable<CryptoSnapshot>(
+    objectField<&CryptoSnapshot::latest_trade>("latestTrade"),
+    objectField<&CryptoSnapshot::latest_quote>("latestQuote"),
+    objectField<&CryptoSnapshot::minute_bar>("minuteBar"),
+    objectField<&CryptoSnapshot::daily_bar>("dailyBar"),
+    objectField<&CryptoSnapshot::prev_daily_bar>("prevDailyBar"));
+
+constexpr auto kCryptoTradesFields = makeFieldTable<CryptoTrades>(
+    symbolArraysField<&CryptoTrades::trades>("trades"),
+    field("next_page_token", &CryptoTrades::next_page_token));
+
+constexpr auto kCryptoQuotesFields = makeFieldTable<CryptoQuotes>(
+    symbolArraysField<&CryptoQuotes::quotes>("quotes"),
+    field("next_page_token", &CryptoQuotes::next_page_token));
+
+constexpr auto kCryptoBarsFields = makeFieldTable<CryptoBars>(
+    symbolArraysField<&CryptoBars::bars>("bars"),
+    field("next_page_token", &CryptoBars::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, CryptoTrade& trade) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a crypto trade object");
     }
-
-    PARSE_DOUBLE(price, "p")
-    PARSE_UINT64(size, "s")
-    PARSE_STRING(timestamp, "t")
-    PARSE_UINT64(id, "i")
-    PARSE_STRING(taker_side, "tks")
-
-    return Status();
+    return decodeFields(d, trade, kCryptoTradeFields);
 }
 
-Status CryptoQuote::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto quote JSON");
-    }
-
+Status decode(const rapidjson::Value& d, CryptoQuote& quote) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a crypto quote object");
     }
-
-    PARSE_DOUBLE(ask_price, "ap")
-    PARSE_DOUBLE(ask_size, "as")
-    PARSE_DOUBLE(bid_price, "bp")
-    PARSE_DOUBLE(bid_size, "bs")
-    PARSE_STRING(timestamp, "t")
-
-    return Status();
+    return decodeFields(d, quote, kCryptoQuoteFields);
 }
 
-Status CryptoBar::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto bar JSON");
-    }
-
+Status decode(const rapidjson::Value& d, CryptoBar& bar) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a crypto bar object");
     }
-
-    PARSE_STRING(timestamp, "t")
-    PARSE_DOUBLE(open_price, "o")
-    PARSE_DOUBLE(high_price, "h")
-    PARSE_DOUBLE(low_price, "l")
-    PARSE_DOUBLE(close_price, "c")
-    PARSE_DOUBLE(volume, "v")
-    PARSE_UINT64(trade_count, "n")
-    PARSE_DOUBLE(vwap, "vw")
-
-    return Status();
+    return decodeFields(d, bar, kCryptoBarFields);
 }
 
-Status CryptoSnapshot::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto snapshot JSON");
-    }
-
+Status decode(const rapidjson::Value& d, CryptoSnapshot& snapshot) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a crypto snapshot object");
     }
+    return decodeFields(d, snapshot, kCryptoSnapshotFields);
+}
 
-    // Parse latest trade
-    if (d.HasMember("latestTrade") && d["latestTrade"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["latestTrade"].Accept(writer);
-        if (Status status = latest_trade.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status decode(const rapidjson::Value& d, CryptoTrades& trades) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a crypto trades object");
     }
+    return decodeFields(d, trades, kCryptoTradesFields);
+}
 
-    // Parse latest quote
-    if (d.HasMember("latestQuote") && d["latestQuote"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["latestQuote"].Accept(writer);
-        if (Status status = latest_quote.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status decode(const rapidjson::Value& d, CryptoQuotes& quotes) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a crypto quotes object");
     }
+    return decodeFields(d, quotes, kCryptoQuotesFields);
+}
 
-    // Parse minute bar
-    if (d.HasMember("minuteBar") && d["minuteBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["minuteBar"].Accept(writer);
-        if (Status status = minute_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status decode(const rapidjson::Value& d, CryptoBars& bars) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a crypto bars object");
     }
+    return decodeFields(d, bars, kCryptoBarsFields);
+}
 
-    // Parse daily bar
-    if (d.HasMember("dailyBar") && d["dailyBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["dailyBar"].Accept(writer);
-        if (Status status = daily_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
-    }
+}  // namespace detail
 
-    // Parse previous daily bar
-    if (d.HasMember("prevDailyBar") && d["prevDailyBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["prevDailyBar"].Accept(writer);
-        if (Status status = prev_daily_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status CryptoTrade::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCryptoTradeParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status CryptoTrade::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCryptoTradeParseError);
 }
 
-Status CryptoTrades::fromJSON(const std::string& json) {
+Status CryptoQuote::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto trades JSON");
+        return Status(1, kCryptoQuoteParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a crypto trades object");
-    }
+Status CryptoQuote::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCryptoQuoteParseError);
+}
 
-    if (d.HasMember("trades") && d["trades"].IsObject()) {
-        for (auto& m : d["trades"].GetObject()) {
-            std::string symbol = m.name.GetString();
-            std::vector<CryptoTrade> symbol_trades;
-
-            if (m.value.IsArray()) {
-                for (auto& item : m.value.GetArray()) {
-                    CryptoTrade trade;
-                    rapidjson::StringBuffer s;
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    item.Accept(writer);
-                    if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_trades.push_back(trade);
-                }
-            }
-            trades[symbol] = symbol_trades;
-        }
+Status CryptoBar::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCryptoBarParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(next_page_token, "next_page_token")
-
-    return Status();
+Status CryptoBar::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCryptoBarParseError);
 }
 
-Status CryptoQuotes::fromJSON(const std::string& json) {
+Status CryptoSnapshot::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto quotes JSON");
+        return Status(1, kCryptoSnapshotParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a crypto quotes object");
-    }
+Status CryptoSnapshot::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kCryptoSnapshotParseError);
+}
 
-    if (d.HasMember("quotes") && d["quotes"].IsObject()) {
-        for (auto& m : d["quotes"].GetObject()) {
-            std::string symbol = m.name.GetString();
-            std::vector<CryptoQuote> symbol_quotes;
-
-            if (m.value.IsArray()) {
-                for (auto& item : m.value.GetArray()) {
-                    CryptoQuote quote;
-                    rapidjson::StringBuffer s;
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    item.Accept(writer);
-                    if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_quotes.push_back(quote);
-                }
-            }
-            quotes[symbol] = symbol_quotes;
-        }
+Status CryptoTrades::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoTradesParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCryptoTradesParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    PARSE_STRING(next_page_token, "next_page_token")
-
-    return Status();
+Status CryptoTrades::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoTradesParseError);
+#else
+    return detail::decodeInsitu(json, *this, kCryptoTradesParseError);
+#endif
 }
 
-Status CryptoBars::fromJSON(const std::string& json) {
+Status CryptoQuotes::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoQuotesParseError);
+#else
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing crypto bars JSON");
+        return Status(1, kCryptoQuotesParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a crypto bars object");
-    }
+Status CryptoQuotes::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoQuotesParseError);
+#else
+    return detail::decodeInsitu(json, *this, kCryptoQuotesParseError);
+#endif
+}
 
-    if (d.HasMember("bars") && d["bars"].IsObject()) {
-        for (auto& m : d["bars"].GetObject()) {
-            std::string symbol = m.name.GetString();
-            std::vector<CryptoBar> symbol_bars;
-
-            if (m.value.IsArray()) {
-                for (auto& item : m.value.GetArray()) {
-                    CryptoBar bar;
-                    rapidjson::StringBuffer s;
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    item.Accept(writer);
-                    if (Status status = bar.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_bars.push_back(bar);
-                }
-            }
-            bars[symbol] = symbol_bars;
-        }
+Status CryptoBars::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoBarsParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kCryptoBarsParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    PARSE_STRING(next_page_token, "next_page_token")
-
-    return Status();
+Status CryptoBars::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kCryptoBarsParseError);
+#else
+    return detail::decodeInsitu(json, *this, kCryptoBarsParseError);
+#endif
 }
 
 }  // namespace alpaca::markets
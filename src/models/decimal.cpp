@@ -0,0 +1,94 @@
+#include <alpaca/markets/decimal.hpp>
+
+#include <charconv>
+#include <limits>
+
+namespace alpaca::markets {
+
+std::optional<Decimal> Decimal::parse(std::string_view text) {
+    bool negative = !text.empty() && text.front() == '-';
+    if (negative) {
+        text.remove_prefix(1);
+    }
+
+    // Accumulate as a positive count of units; the bound leaves room for the sign
+    constexpr std::uint64_t kMax = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    std::uint64_t units = 0;
+    bool seen_digit = false;
+    bool seen_point = false;
+    int fraction_digits = 0;
+    for (char c : text) {
+        if (c == '.' && !seen_point) {
+            seen_point = true;
+            continue;
+        }
+        if (c < '0' || c > '9') {
+            return std::nullopt;
+        }
+        if (seen_point && ++fraction_digits > kScale) {
+            return std::nullopt;
+        }
+        seen_digit = true;
+        auto digit = static_cast<std::uint64_t>(c - '0');
+        if (units > (kMax - digit) / 10) {
+            return std::nullopt;
+        }
+        units = units * 10 + digit;
+    }
+    if (!seen_digit) {
+        return std::nullopt;
+    }
+
+    for (int i = fraction_digits; i < kScale; ++i) {
+        if (units > kMax / 10) {
+            return std::nullopt;
+        }
+        units *= 10;
+    }
+    auto value = static_cast<std::int64_t>(units);
+    return fromUnits(negative ? -value : value);
+}
+
+char* Decimal::write(char* buf) const {
+    char* out = buf;
+    // Work with the magnitude as unsigned so the minimum int64 doesn't overflow on negation
+    std::uint64_t magnitude = static_cast<std::uint64_t>(units_);
+    if (units_ < 0) {
+        *out++ = '-';
+        magnitude = ~magnitude + 1;
+    }
+
+    out = std::to_chars(out, buf + kMaxChars, magnitude / kUnitsPerOne).ptr;
+    std::uint64_t fraction = magnitude % kUnitsPerOne;
+    if (fraction == 0) {
+        return out;
+    }
+
+    *out++ = '.';
+    char digits[kScale];
+    for (int i = kScale - 1; i >= 0; --i) {
+        digits[i] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    int length = kScale;
+    while (digits[length - 1] == '0') {
+        --length;
+    }
+    for (int i = 0; i < length; ++i) {
+        *out++ = digits[i];
+    }
+    return out;
+}
+
+void Decimal::appendTo(std::string& out) const {
+    char buf[kMaxChars];
+    out.append(buf, write(buf));
+}
+
+std::string Decimal::toString() const {
+    std::string out;
+    appendTo(out);
+    return out;
+}
+
+}  // namespace alpaca::markets
@@ -0,0 +1,213 @@
+#include <alpaca/markets/history.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <optional>
+
+#include "../detail/chunks.hpp"
+#include "../detail/rate_limiter.hpp"
+
+namespace alpaca::markets {
+
+namespace {
+
+bool parseNumber(const std::string& s, std::size_t pos, std::size_t len, int& out) {
+    if (pos + len > s.size()) {
+        return false;
+    }
+    auto [ptr, ec] = std::from_chars(s.data() + pos, s.data() + pos + len, out);
+    return ec == std::errc() && ptr == s.data() + pos + len;
+}
+
+/**
+ * @brief Parse "YYYY-MM-DD" or RFC3339 into whole seconds since the epoch (UTC), dropping fractions.
+ */
+bool parseTimestamp(const std::string& s, int64_t& seconds) {
+    int year = 0, month = 0, day = 0;
+    if (!parseNumber(s, 0, 4, year) || s.size() < 10 || s[4] != '-' || !parseNumber(s, 5, 2, month) || s[7] != '-' ||
+        !parseNumber(s, 8, 2, day)) {
+        return false;
+    }
+    std::chrono::year_month_day date{std::chrono::year(year), std::chrono::month(static_cast<unsigned>(month)),
+                                     std::chrono::day(static_cast<unsigned>(day))};
+    if (!date.ok()) {
+        return false;
+    }
+    seconds = std::chrono::sys_seconds(std::chrono::sys_days(date)).time_since_epoch().count();
+    if (s.size() == 10) {
+        return true;
+    }
+
+    int hour = 0, minute = 0, second = 0;
+    if ((s[10] != 'T' && s[10] != 't' && s[10] != ' ') || !parseNumber(s, 11, 2, hour) || s[13] != ':' ||
+        !parseNumber(s, 14, 2, minute) || s[16] != ':' || !parseNumber(s, 17, 2, second)) {
+        return false;
+    }
+    seconds += hour * 3600 + minute * 60 + second;
+
+    std::size_t pos = 19;
+    if (pos < s.size() && s[pos] == '.') {
+        ++pos;
+        while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9') {
+            ++pos;
+        }
+    }
+    if (pos < s.size() && (s[pos] == 'Z' || s[pos] == 'z') && pos + 1 == s.size()) {
+        return true;
+    }
+    int offset_hours = 0, offset_minutes = 0;
+    if (pos + 6 == s.size() && (s[pos] == '+' || s[pos] == '-') && parseNumber(s, pos + 1, 2, offset_hours) &&
+        s[pos + 3] == ':' && parseNumber(s, pos + 4, 2, offset_minutes)) {
+        int64_t offset = offset_hours * 3600 + offset_minutes * 60;
+        seconds += s[pos] == '+' ? -offset : offset;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Format seconds since the epoch as RFC3339 UTC, optionally at the last nanosecond of that second.
+ */
+std::string formatTimestamp(int64_t seconds, bool last_nanosecond) {
+    auto tp = std::chrono::sys_seconds(std::chrono::seconds(seconds));
+    auto day = std::chrono::floor<std::chrono::days>(tp);
+    std::chrono::year_month_day date(day);
+    std::chrono::hh_mm_ss<std::chrono::seconds> time(tp - day);
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02uT%02d:%02d:%02d%sZ", static_cast<int>(date.year()),
+                  static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+                  static_cast<int>(time.hours().count()), static_cast<int>(time.minutes().count()),
+                  static_cast<int>(time.seconds().count()), last_nanosecond ? ".999999999" : "");
+    return buffer;
+}
+
+/**
+ * @brief Build sub-ranges from the interior boundaries (whole seconds, ascending) of [start, end].
+ */
+std::vector<TimeRange> makeRanges(const std::string& start, const std::string& end,
+                                  const std::vector<int64_t>& boundaries) {
+    std::vector<TimeRange> ranges;
+    ranges.reserve(boundaries.size() + 1);
+    std::string range_start = start;
+    for (int64_t boundary : boundaries) {
+        ranges.push_back(TimeRange{std::move(range_start), formatTimestamp(boundary - 1, true)});
+        range_start = formatTimestamp(boundary, false);
+    }
+    ranges.push_back(TimeRange{std::move(range_start), end});
+    return ranges;
+}
+
+Status parseRange(const std::string& start, const std::string& end, int64_t& start_seconds, int64_t& end_seconds) {
+    if (!parseTimestamp(start, start_seconds)) {
+        return Status(1, "Invalid start time: " + start);
+    }
+    if (!parseTimestamp(end, end_seconds)) {
+        return Status(1, "Invalid end time: " + end);
+    }
+    if (end_seconds < start_seconds) {
+        return Status(1, "End time " + end + " is before start time " + start);
+    }
+    return Status();
+}
+
+}  // namespace
+
+std::pair<Status, std::vector<TimeRange>> splitTimeRange(const std::string& start, const std::string& end,
+                                                         std::size_t parts) {
+    int64_t start_seconds = 0, end_seconds = 0;
+    if (Status status = parseRange(start, end, start_seconds, end_seconds); !status.ok()) {
+        return std::make_pair(status, std::vector<TimeRange>{});
+    }
+
+    int64_t span = end_seconds - start_seconds;
+    auto count = static_cast<int64_t>(std::max<std::size_t>(parts, 1));
+    count = std::max<int64_t>(std::min(count, span), 1);
+
+    std::vector<int64_t> boundaries;
+    boundaries.reserve(static_cast<std::size_t>(count - 1));
+    for (int64_t k = 1; k < count; ++k) {
+        boundaries.push_back(start_seconds + span * k / count);
+    }
+    return std::make_pair(Status(), makeRanges(start, end, boundaries));
+}
+
+std::pair<Status, std::vector<TimeRange>> splitTimeRangeByDay(const std::string& start, const std::string& end) {
+    int64_t start_seconds = 0, end_seconds = 0;
+    if (Status status = parseRange(start, end, start_seconds, end_seconds); !status.ok()) {
+        return std::make_pair(status, std::vector<TimeRange>{});
+    }
+
+    constexpr int64_t kSecondsPerDay = 86400;
+    std::vector<int64_t> boundaries;
+    // First midnight strictly after the start
+    int64_t midnight = (start_seconds / kSecondsPerDay + 1) * kSecondsPerDay;
+    if (start_seconds < 0 && start_seconds % kSecondsPerDay != 0) {
+        midnight -= kSecondsPerDay;
+    }
+    for (; midnight < end_seconds; midnight += kSecondsPerDay) {
+        boundaries.push_back(midnight);
+    }
+    return std::make_pair(Status(), makeRanges(start, end, boundaries));
+}
+
+namespace detail {
+
+Status downloadRangePages(std::size_t range_count, const ParallelDownloadConfig& config,
+                          const std::function<RangePageFetch()>& make_fetch) {
+    if (range_count == 0) {
+        return Status();
+    }
+    std::optional<RateLimiter> limiter;
+    if (config.requests_per_minute > 0) {
+        limiter.emplace(config.requests_per_minute, std::chrono::minutes(1));
+    }
+    std::atomic<std::size_t> next_range{0};
+    std::atomic<bool> stopped{false};
+    std::mutex error_mutex;
+    Status error;
+    auto fail = [&](Status status) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error.ok()) {
+            error = std::move(status);
+        }
+        stopped = true;
+    };
+
+    std::size_t concurrency = std::min(std::max<std::size_t>(config.max_concurrency, 1), range_count);
+    Status thrown = runWorkers(concurrency, [&] {
+        try {
+            RangePageFetch fetch = make_fetch();
+            for (std::size_t i = next_range++; i < range_count && !stopped; i = next_range++) {
+                std::string page_token;
+                do {
+                    if (limiter) {
+                        limiter->acquire();
+                    }
+                    auto [status, next_page_token] = fetch(i, page_token);
+                    if (!status.ok()) {
+                        fail(status);
+                        return;
+                    }
+                    page_token = std::move(next_page_token);
+                } while (!page_token.empty() && !stopped);
+            }
+        } catch (...) {
+            // runWorkers reports the exception; the other workers just stop taking ranges
+            stopped = true;
+            throw;
+        }
+    });
+    if (!thrown.ok()) {
+        fail(thrown);
+    }
+    return error;
+}
+
+}  // namespace detail
+
+}  // namespace alpaca::markets
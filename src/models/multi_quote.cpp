@@ -1,50 +1,51 @@
 #include <alpaca/markets/multi_quote.hpp>
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/simdjson_decode.hpp"
 
 namespace alpaca::markets {
 
-Status MultiQuotes::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing multi quotes JSON");
-    }
+namespace {
+const char* kMultiQuotesParseError = "Received parse error when deserializing multi quotes JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kMultiQuotesFields = makeFieldTable<MultiQuotes>(
+    symbolArraysField<&MultiQuotes::quotes>("quotes"),
+    field("next_page_token", &MultiQuotes::next_page_token));
 
+}  // namespace
+
+Status decode(const rapidjson::Value& d, MultiQuotes& multi_quotes) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a multi quotes object");
     }
+    return decodeFields(d, multi_quotes, kMultiQuotesFields);
+}
 
-    // Parse quotes map
-    if (d.HasMember("quotes") && d["quotes"].IsObject()) {
-        for (auto& m : d["quotes"].GetObject()) {
-            std::vector<Quote> symbol_quotes;
-            if (m.value.IsArray()) {
-                for (auto& o : m.value.GetArray()) {
-                    Quote quote;
-                    rapidjson::StringBuffer s;
-                    s.Clear();
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    o.Accept(writer);
-                    if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_quotes.push_back(quote);
-                }
-            }
-            quotes[m.name.GetString()] = symbol_quotes;
-        }
-    }
+}  // namespace detail
 
-    // Parse next_page_token
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
+Status MultiQuotes::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kMultiQuotesParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kMultiQuotesParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    return Status();
+Status MultiQuotes::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kMultiQuotesParseError);
+#else
+    return detail::decodeInsitu(json, *this, kMultiQuotesParseError);
+#endif
 }
 
 }  // namespace alpaca::markets
@@ -1,50 +1,51 @@
 #include <alpaca/markets/multi_trade.hpp>
 
-#include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/simdjson_decode.hpp"
 
 namespace alpaca::markets {
 
-Status MultiTrades::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing multi trades JSON");
-    }
+namespace {
+const char* kMultiTradesParseError = "Received parse error when deserializing multi trades JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kMultiTradesFields = makeFieldTable<MultiTrades>(
+    symbolArraysField<&MultiTrades::trades>("trades"),
+    field("next_page_token", &MultiTrades::next_page_token));
 
+}  // namespace
+
+Status decode(const rapidjson::Value& d, MultiTrades& multi_trades) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a multi trades object");
     }
+    return decodeFields(d, multi_trades, kMultiTradesFields);
+}
 
-    // Parse trades map
-    if (d.HasMember("trades") && d["trades"].IsObject()) {
-        for (auto& m : d["trades"].GetObject()) {
-            std::vector<Trade> symbol_trades;
-            if (m.value.IsArray()) {
-                for (auto& o : m.value.GetArray()) {
-                    Trade trade;
-                    rapidjson::StringBuffer s;
-                    s.Clear();
-                    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-                    o.Accept(writer);
-                    if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-                        return status;
-                    }
-                    symbol_trades.push_back(trade);
-                }
-            }
-            trades[m.name.GetString()] = symbol_trades;
-        }
-    }
+}  // namespace detail
 
-    // Parse next_page_token
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
+Status MultiTrades::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kMultiTradesParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kMultiTradesParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    return Status();
+Status MultiTrades::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kMultiTradesParseError);
+#else
+    return detail::decodeInsitu(json, *this, kMultiTradesParseError);
+#endif
 }
 
 }  // namespace alpaca::markets
@@ -1,80 +1,99 @@
 #include <alpaca/markets/news.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status News::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing news JSON");
-    }
+namespace {
+const char* kNewsParseError = "Received parse error when deserializing news JSON";
+const char* kNewsArticlesParseError = "Received parse error when deserializing news articles JSON";
+}  // namespace
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a news object");
-    }
+namespace detail {
+
+namespace {
+
+constexpr auto kNewsImageFields = makeFieldTable<NewsImage>(
+    field("size", &NewsImage::size),
+    field("url", &NewsImage::url));
 
-    PARSE_UINT64(id, "id")
-    PARSE_STRING(headline, "headline")
-    PARSE_STRING(author, "author")
-    PARSE_STRING(created_at, "created_at")
-    PARSE_STRING(updated_at, "updated_at")
-    PARSE_STRING(summary, "summary")
-    PARSE_STRING(content, "content")
-    PARSE_STRING(url, "url")
-    PARSE_STRING(source, "source")
-    PARSE_VECTOR_STRINGS(symbols, "symbols")
-
-    // Parse images array
-    if (d.HasMember("images") && d["images"].IsArray()) {
-        for (auto& item : d["images"].GetArray()) {
-            if (item.IsObject()) {
-                NewsImage img;
-                if (item.HasMember("size") && item["size"].IsString()) {
-                    img.size = item["size"].GetString();
-                }
-                if (item.HasMember("url") && item["url"].IsString()) {
-                    img.url = item["url"].GetString();
-                }
-                images.push_back(img);
+// Images which aren't objects are skipped rather than failing the article
+Status decodeImages(const rapidjson::Value& v, News& news) {
+    if (!v.IsArray()) {
+        return Status();
+    }
+    std::vector<NewsImage> images;
+    images.reserve(v.Size());
+    for (auto& item : v.GetArray()) {
+        if (item.IsObject()) {
+            NewsImage image;
+            if (Status status = decodeFields(item, image, kNewsImageFields); !status.ok()) {
+                return status;
             }
+            images.push_back(std::move(image));
         }
     }
-
+    news.images = std::move(images);
     return Status();
 }
 
-Status NewsArticles::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing news articles JSON");
+constexpr auto kNewsFields = makeFieldTable<News>(
+    field("id", &News::id),
+    field("headline", &News::headline),
+    field("author", &News::author),
+    field("created_at", &News::created_at),
+    field("updated_at", &News::updated_at),
+    field("summary", &News::summary),
+    field("content", &News::content),
+    field("url", &News::url),
+    field("source", &News::source),
+    field("symbols", &News::symbols),
+    custom<News>("images", decodeImages));
+
+constexpr auto kNewsArticlesFields = makeFieldTable<NewsArticles>(
+    arrayField<&NewsArticles::news>("news"),
+    field("next_page_token", &NewsArticles::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, News& news) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a news object");
     }
+    return decodeFields(d, news, kNewsFields);
+}
 
+Status decode(const rapidjson::Value& d, NewsArticles& news_articles) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a news articles object");
     }
+    return decodeFields(d, news_articles, kNewsArticlesFields);
+}
 
-    // Parse news array
-    if (d.HasMember("news") && d["news"].IsArray()) {
-        for (auto& item : d["news"].GetArray()) {
-            News article;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            item.Accept(writer);
-            if (Status status = article.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            news.push_back(article);
-        }
+}  // namespace detail
+
+Status News::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kNewsParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(next_page_token, "next_page_token")
+Status News::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kNewsParseError);
+}
 
-    return Status();
+Status NewsArticles::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kNewsArticlesParseError);
+    }
+    return detail::decode(d, *this);
+}
+
+Status NewsArticles::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kNewsArticlesParseError);
 }
 
 }  // namespace alpaca::markets
@@ -1,12 +1,14 @@
 #include <alpaca/markets/option.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
+namespace {
+const char* kOptionContractParseError = "Received parse error when deserializing option contract JSON";
+const char* kOptionContractsParseError = "Received parse error when deserializing option contracts JSON";
+}  // namespace
+
 std::string optionTypeToString(OptionType type) {
     switch (type) {
         case OptionType::Call:
@@ -61,110 +63,103 @@ OptionStatus stringToOptionStatus(const std::string& s) {
     return OptionStatus::Active;
 }
 
-Status OptionContract::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing option contract JSON");
-    }
+namespace detail {
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't an option contract object");
-    }
+namespace {
 
-    PARSE_STRING(id, "id")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_STRING(name, "name")
-    PARSE_BOOL(tradable, "tradable")
-    PARSE_STRING(underlying_symbol, "underlying_symbol")
-    PARSE_STRING(underlying_asset_id, "underlying_asset_id")
-    PARSE_STRING(strike_price, "strike_price")
-    PARSE_STRING(size, "size")
-    PARSE_STRING(expiration_date, "expiration_date")
-    PARSE_STRING(open_interest, "open_interest")
-    PARSE_STRING(open_interest_date, "open_interest_date")
-    PARSE_STRING(close_price, "close_price")
-    PARSE_STRING(close_price_date, "close_price_date")
-
-    // Parse status
-    if (d.HasMember("status") && d["status"].IsString()) {
-        status = stringToOptionStatus(d["status"].GetString());
-    }
+constexpr auto kDeliverableFields = makeFieldTable<Deliverable>(
+    field("type", &Deliverable::type),
+    field("symbol", &Deliverable::symbol),
+    field("asset_id", &Deliverable::asset_id),
+    field("amount", &Deliverable::amount),
+    field("allocation_percentage", &Deliverable::allocation_percentage),
+    field("settlement_type", &Deliverable::settlement_type),
+    field("settlement_method", &Deliverable::settlement_method),
+    field("delayed_settlement", &Deliverable::delayed_settlement));
 
-    // Parse type (call/put)
-    if (d.HasMember("type") && d["type"].IsString()) {
-        type = stringToOptionType(d["type"].GetString());
+// Deliverables which aren't objects are skipped rather than failing the contract
+Status decodeDeliverables(const rapidjson::Value& v, OptionContract& contract) {
+    if (!v.IsArray()) {
+        return Status();
     }
-
-    // Parse style (american/european)
-    if (d.HasMember("style") && d["style"].IsString()) {
-        style = stringToOptionStyle(d["style"].GetString());
-    }
-
-    // Parse deliverables array
-    if (d.HasMember("deliverables") && d["deliverables"].IsArray()) {
-        for (auto& item : d["deliverables"].GetArray()) {
-            if (item.IsObject()) {
-                Deliverable del;
-                if (item.HasMember("type") && item["type"].IsString()) {
-                    del.type = item["type"].GetString();
-                }
-                if (item.HasMember("symbol") && item["symbol"].IsString()) {
-                    del.symbol = item["symbol"].GetString();
-                }
-                if (item.HasMember("asset_id") && item["asset_id"].IsString()) {
-                    del.asset_id = item["asset_id"].GetString();
-                }
-                if (item.HasMember("amount") && item["amount"].IsString()) {
-                    del.amount = item["amount"].GetString();
-                }
-                if (item.HasMember("allocation_percentage") && item["allocation_percentage"].IsString()) {
-                    del.allocation_percentage = item["allocation_percentage"].GetString();
-                }
-                if (item.HasMember("settlement_type") && item["settlement_type"].IsString()) {
-                    del.settlement_type = item["settlement_type"].GetString();
-                }
-                if (item.HasMember("settlement_method") && item["settlement_method"].IsString()) {
-                    del.settlement_method = item["settlement_method"].GetString();
-                }
-                if (item.HasMember("delayed_settlement") && item["delayed_settlement"].IsBool()) {
-                    del.delayed_settlement = item["delayed_settlement"].GetBool();
-                }
-                deliverables.push_back(del);
+    std::vector<Deliverable> deliverables;
+    deliverables.reserve(v.Size());
+    for (auto& item : v.GetArray()) {
+        if (item.IsObject()) {
+            Deliverable deliverable;
+            if (Status status = decodeFields(item, deliverable, kDeliverableFields); !status.ok()) {
+                return status;
             }
+            deliverables.push_back(std::move(deliverable));
         }
     }
-
+    contract.deliverables = std::move(deliverables);
     return Status();
 }
 
-Status OptionContracts::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing option contracts JSON");
+constexpr auto kOptionContractFields = makeFieldTable<OptionContract>(
+    field("id", &OptionContract::id),
+    field("symbol", &OptionContract::symbol),
+    field("name", &OptionContract::name),
+    field("tradable", &OptionContract::tradable),
+    field("underlying_symbol", &OptionContract::underlying_symbol),
+    field("underlying_asset_id", &OptionContract::underlying_asset_id),
+    field("strike_price", &OptionContract::strike_price),
+    field("size", &OptionContract::size),
+    field("expiration_date", &OptionContract::expiration_date),
+    field("open_interest", &OptionContract::open_interest),
+    field("open_interest_date", &OptionContract::open_interest_date),
+    field("close_price", &OptionContract::close_price),
+    field("close_price_date", &OptionContract::close_price_date),
+    enumField<&OptionContract::status, stringToOptionStatus>("status"),
+    enumField<&OptionContract::type, stringToOptionType>("type"),
+    enumField<&OptionContract::style, stringToOptionStyle>("style"),
+    custom<OptionContract>("deliverables", decodeDeliverables));
+
+constexpr auto kOptionContractsFields = makeFieldTable<OptionContracts>(
+    arrayField<&OptionContracts::option_contracts>("option_contracts"),
+    field("next_page_token", &OptionContracts::next_page_token));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, OptionContract& contract) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't an option contract object");
     }
+    return decodeFields(d, contract, kOptionContractFields);
+}
 
+Status decode(const rapidjson::Value& d, OptionContracts& contracts) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't an option contracts object");
     }
+    return decodeFields(d, contracts, kOptionContractsFields);
+}
 
-    // Parse option_contracts array
-    if (d.HasMember("option_contracts") && d["option_contracts"].IsArray()) {
-        for (auto& item : d["option_contracts"].GetArray()) {
-            OptionContract contract;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            item.Accept(writer);
-            if (Status status = contract.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            option_contracts.push_back(contract);
-        }
+}  // namespace detail
+
+Status OptionContract::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kOptionContractParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(next_page_token, "next_page_token")
+Status OptionContract::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kOptionContractParseError);
+}
 
-    return Status();
+Status OptionContracts::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kOptionContractsParseError);
+    }
+    return detail::decode(d, *this);
+}
+
+Status OptionContracts::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kOptionContractsParseError);
 }
 
 }  // namespace alpaca::markets
@@ -1,9 +1,16 @@
 #include <alpaca/markets/order.hpp>
 
-#include "../detail/json.hpp"
+#include <utility>
+
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
+namespace {
+const char* kOrderParseError = "Received parse error when deserializing order JSON";
+const char* kOrderCancelResultsParseError = "Received parse error when deserializing order cancellation JSON";
+}  // namespace
+
 std::string orderDirectionToString(OrderDirection direction) {
     switch (direction) {
         case OrderDirection::Ascending:
@@ -21,6 +28,8 @@ std::string orderSideToString(OrderSide side) {
             return "buy";
         case OrderSide::Sell:
             return "sell";
+        case OrderSide::Unknown:
+            return "unknown";
         default:
             return "buy";
     }
@@ -38,6 +47,8 @@ std::string orderTypeToString(OrderType type) {
             return "stop_limit";
         case OrderType::TrailingStop:
             return "trailing_stop";
+        case OrderType::Unknown:
+            return "unknown";
         default:
             return "market";
     }
@@ -57,6 +68,8 @@ std::string orderTimeInForceToString(OrderTimeInForce tif) {
             return "ioc";
         case OrderTimeInForce::FillOrKill:
             return "fok";
+        case OrderTimeInForce::Unknown:
+            return "unknown";
         default:
             return "day";
     }
@@ -74,6 +87,8 @@ std::string orderClassToString(OrderClass order_class) {
             return "oto";
         case OrderClass::MultiLeg:
             return "mleg";
+        case OrderClass::Unknown:
+            return "unknown";
         default:
             return "simple";
     }
@@ -94,45 +109,271 @@ std::string positionIntentToString(PositionIntent intent) {
     }
 }
 
-Status Order::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing order JSON");
+std::string orderStatusToString(OrderStatus status) {
+    switch (status) {
+        case OrderStatus::New:
+            return "new";
+        case OrderStatus::PartiallyFilled:
+            return "partially_filled";
+        case OrderStatus::Filled:
+            return "filled";
+        case OrderStatus::DoneForDay:
+            return "done_for_day";
+        case OrderStatus::Canceled:
+            return "canceled";
+        case OrderStatus::Expired:
+            return "expired";
+        case OrderStatus::Replaced:
+            return "replaced";
+        case OrderStatus::PendingCancel:
+            return "pending_cancel";
+        case OrderStatus::PendingReplace:
+            return "pending_replace";
+        case OrderStatus::PendingNew:
+            return "pending_new";
+        case OrderStatus::Accepted:
+            return "accepted";
+        case OrderStatus::AcceptedForBidding:
+            return "accepted_for_bidding";
+        case OrderStatus::Stopped:
+            return "stopped";
+        case OrderStatus::Rejected:
+            return "rejected";
+        case OrderStatus::Suspended:
+            return "suspended";
+        case OrderStatus::Calculated:
+            return "calculated";
+        case OrderStatus::Held:
+            return "held";
+        default:
+            return "unknown";
+    }
+}
+
+OrderSide stringToOrderSide(std::string_view s) {
+    if (s == "buy") {
+        return OrderSide::Buy;
+    }
+    if (s == "sell") {
+        return OrderSide::Sell;
     }
+    return OrderSide::Unknown;
+}
+
+OrderType stringToOrderType(std::string_view s) {
+    if (s == "market") {
+        return OrderType::Market;
+    }
+    if (s == "limit") {
+        return OrderType::Limit;
+    }
+    if (s == "stop") {
+        return OrderType::Stop;
+    }
+    if (s == "stop_limit") {
+        return OrderType::StopLimit;
+    }
+    if (s == "trailing_stop") {
+        return OrderType::TrailingStop;
+    }
+    return OrderType::Unknown;
+}
+
+OrderTimeInForce stringToOrderTimeInForce(std::string_view s) {
+    if (s == "day") {
+        return OrderTimeInForce::Day;
+    }
+    if (s == "gtc") {
+        return OrderTimeInForce::GoodUntilCanceled;
+    }
+    if (s == "opg") {
+        return OrderTimeInForce::OPG;
+    }
+    if (s == "cls") {
+        return OrderTimeInForce::CLS;
+    }
+    if (s == "ioc") {
+        return OrderTimeInForce::ImmediateOrCancel;
+    }
+    if (s == "fok") {
+        return OrderTimeInForce::FillOrKill;
+    }
+    return OrderTimeInForce::Unknown;
+}
+
+OrderClass stringToOrderClass(std::string_view s) {
+    // Simple orders may report an empty order_class
+    if (s.empty() || s == "simple") {
+        return OrderClass::Simple;
+    }
+    if (s == "bracket") {
+        return OrderClass::Bracket;
+    }
+    if (s == "oco") {
+        return OrderClass::OneCancelsOther;
+    }
+    if (s == "oto") {
+        return OrderClass::OneTriggersOther;
+    }
+    if (s == "mleg") {
+        return OrderClass::MultiLeg;
+    }
+    return OrderClass::Unknown;
+}
+
+OrderStatus stringToOrderStatus(std::string_view s) {
+    // Ordered roughly by how often each status is seen
+    static constexpr std::pair<std::string_view, OrderStatus> kStatuses[] = {
+        {"new", OrderStatus::New},
+        {"filled", OrderStatus::Filled},
+        {"partially_filled", OrderStatus::PartiallyFilled},
+        {"canceled", OrderStatus::Canceled},
+        {"accepted", OrderStatus::Accepted},
+        {"pending_new", OrderStatus::PendingNew},
+        {"expired", OrderStatus::Expired},
+        {"replaced", OrderStatus::Replaced},
+        {"pending_cancel", OrderStatus::PendingCancel},
+        {"pending_replace", OrderStatus::PendingReplace},
+        {"rejected", OrderStatus::Rejected},
+        {"done_for_day", OrderStatus::DoneForDay},
+        {"accepted_for_bidding", OrderStatus::AcceptedForBidding},
+        {"stopped", OrderStatus::Stopped},
+        {"suspended", OrderStatus::Suspended},
+        {"calculated", OrderStatus::Calculated},
+        {"held", OrderStatus::Held},
+    };
+    for (const auto& [name, status] : kStatuses) {
+        if (s == name) {
+            return status;
+        }
+    }
+    return OrderStatus::Unknown;
+}
+
+namespace detail {
 
+namespace {
+
+constexpr auto kOrderFields = makeFieldTable<Order>(
+    field("asset_class", &Order::asset_class),
+    field("asset_id", &Order::asset_id),
+    field("canceled_at", &Order::canceled_at),
+    field("client_order_id", &Order::client_order_id),
+    field("created_at", &Order::created_at),
+    field("expired_at", &Order::expired_at),
+    field("extended_hours", &Order::extended_hours),
+    field("failed_at", &Order::failed_at),
+    field("filled_at", &Order::filled_at),
+    field("filled_avg_price", &Order::filled_avg_price),
+    field("filled_qty", &Order::filled_qty),
+    field("id", &Order::id),
+    field("legs", &Order::legs),
+    field("limit_price", &Order::limit_price),
+    field("qty", &Order::qty),
+    field("notional", &Order::notional),
+    field("side", &Order::side),
+    field("status", &Order::status),
+    field("stop_price", &Order::stop_price),
+    field("trail_price", &Order::trail_price),
+    field("trail_percent", &Order::trail_percent),
+    field("hwm", &Order::hwm),
+    field("submitted_at", &Order::submitted_at),
+    field("symbol", &Order::symbol),
+    field("time_in_force", &Order::time_in_force),
+    field("type", &Order::type),
+    field("updated_at", &Order::updated_at));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Order& order) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't an order object");
     }
+    return decodeFields(d, order, kOrderFields);
+}
+
+namespace {
+
+void decodeCancelResult(const rapidjson::Value& d, OrderCancelResult& result) {
+    if (!d.IsObject()) {
+        result.status = Status(1, "Order cancellation entry wasn't an object");
+        return;
+    }
+
+    auto body = d.FindMember("body");
+    if (body == d.MemberEnd()) {
+        // A plain order, as in an HTTP 200 response
+        result.http_status = 200;
+        result.status = decode(d, result.order);
+        result.id = result.order.id;
+        return;
+    }
+
+    if (auto id = d.FindMember("id"); id != d.MemberEnd() && id->value.IsString()) {
+        result.id.assign(id->value.GetString(), id->value.GetStringLength());
+    }
+    if (auto status = d.FindMember("status"); status != d.MemberEnd() && status->value.IsInt()) {
+        result.http_status = status->value.GetInt();
+    }
+
+    if (result.http_status >= 200 && result.http_status < 300) {
+        result.status = decode(body->value, result.order);
+        if (result.id.empty()) {
+            result.id = result.order.id;
+        }
+        return;
+    }
+
+    std::string message = "no error message";
+    if (body->value.IsString()) {
+        message = body->value.GetString();
+    } else if (body->value.IsObject()) {
+        if (auto m = body->value.FindMember("message"); m != body->value.MemberEnd() && m->value.IsString()) {
+            message = m->value.GetString();
+        }
+    }
+    result.status = Status(1, "Cancelling order " + result.id + " returned an HTTP " +
+                                  std::to_string(result.http_status) + ": " + message);
+}
 
-    PARSE_STRING(asset_class, "asset_class")
-    PARSE_STRING(asset_id, "asset_id")
-    PARSE_STRING(canceled_at, "canceled_at")
-    PARSE_STRING(client_order_id, "client_order_id")
-    PARSE_STRING(created_at, "created_at")
-    PARSE_STRING(expired_at, "expired_at")
-    PARSE_BOOL(extended_hours, "extended_hours")
-    PARSE_STRING(failed_at, "failed_at")
-    PARSE_STRING(filled_at, "filled_at")
-    PARSE_STRING(filled_avg_price, "filled_avg_price")
-    PARSE_STRING(filled_qty, "filled_qty")
-    PARSE_STRING(id, "id")
-    PARSE_BOOL(legs, "legs")
-    PARSE_STRING(limit_price, "limit_price")
-    PARSE_STRING(qty, "qty")
-    PARSE_STRING(notional, "notional")
-    PARSE_STRING(side, "side")
-    PARSE_STRING(status, "status")
-    PARSE_STRING(stop_price, "stop_price")
-    PARSE_STRING(trail_price, "trail_price")
-    PARSE_STRING(trail_percent, "trail_percent")
-    PARSE_STRING(hwm, "hwm")
-    PARSE_STRING(submitted_at, "submitted_at")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_STRING(time_in_force, "time_in_force")
-    PARSE_STRING(type, "type")
-    PARSE_STRING(updated_at, "updated_at")
+}  // namespace
 
+Status decode(const rapidjson::Value& d, OrderCancelResults& results) {
+    if (!d.IsArray()) {
+        return Status(1, "Deserialized valid JSON but it wasn't an array of order cancellations");
+    }
+    results.results.clear();
+    results.results.reserve(d.Size());
+    for (const auto& entry : d.GetArray()) {
+        decodeCancelResult(entry, results.results.emplace_back());
+    }
     return Status();
 }
 
+}  // namespace detail
+
+Status Order::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kOrderParseError);
+    }
+    return detail::decode(d, *this);
+}
+
+Status Order::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kOrderParseError);
+}
+
+Status OrderCancelResults::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kOrderCancelResultsParseError);
+    }
+    return detail::decode(d, *this);
+}
+
+Status OrderCancelResults::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kOrderCancelResultsParseError);
+}
+
 }  // namespace alpaca::markets
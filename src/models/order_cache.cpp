@@ -0,0 +1,243 @@
+#include <alpaca/markets/order_cache.hpp>
+
+#include <alpaca/markets/compact_order.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+
+namespace alpaca::markets {
+
+namespace {
+constexpr std::array<std::string_view, 6> kTerminalStatuses = {
+    "filled", "canceled", "expired", "replaced", "rejected", "done_for_day",
+};
+
+// Whether an update stamped `incoming` is older than the cached state stamped `cached`
+bool isOlder(const std::string& incoming, const std::string& cached) {
+    std::optional<std::int64_t> incoming_nanos = parseTimestampNanos(incoming);
+    std::optional<std::int64_t> cached_nanos = parseTimestampNanos(cached);
+    if (incoming_nanos && cached_nanos) {
+        return *incoming_nanos < *cached_nanos;
+    }
+    // A missing or malformed timestamp can't be placed in time; keep the previous string ordering for it
+    return incoming < cached;
+}
+
+std::size_t shardIndex(std::string_view key) {
+    return StringHash{}(key) % OrderCache::Snapshot::kShards;
+}
+
+// A snapshot with no orders, whose shards all share one empty shard
+std::shared_ptr<const OrderCache::Snapshot> emptySnapshot() {
+    auto snapshot = std::make_shared<OrderCache::Snapshot>();
+    snapshot->shards.fill(std::make_shared<const OrderCache::Snapshot::Shard>());
+    return snapshot;
+}
+
+// The order with the given id, shared with the snapshot
+std::shared_ptr<const Order> findShared(const OrderCache::Snapshot& snapshot, std::string_view id) {
+    const OrderCache::Snapshot::Shard& holder = snapshot.shard(id);
+    auto it = holder.orders.find(id);
+    return it == holder.orders.end() ? nullptr : it->second;
+}
+}  // namespace
+
+bool isTerminalOrderStatus(std::string_view status) {
+    return std::find(kTerminalStatuses.begin(), kTerminalStatuses.end(), status) != kTerminalStatuses.end();
+}
+
+/**
+ * @brief The snapshot an update builds: a copy of the current one whose shards are copied the first time they change.
+ */
+class OrderCache::Update {
+public:
+    explicit Update(const Snapshot& current) : next_(std::make_shared<Snapshot>(current)) {}
+
+    [[nodiscard]] const Snapshot& view() const { return *next_; }
+
+    /**
+     * @brief A writable copy of the shard holding key.
+     */
+    Snapshot::Shard& shard(std::string_view key) {
+        std::size_t index = shardIndex(key);
+        if (owned_[index] == nullptr) {
+            auto copy = std::make_shared<Snapshot::Shard>(*next_->shards[index]);
+            owned_[index] = copy.get();
+            next_->shards[index] = std::move(copy);
+        }
+        return *owned_[index];
+    }
+
+    Snapshot& snapshot() { return *next_; }
+
+    std::shared_ptr<Snapshot> take() { return std::move(next_); }
+
+private:
+    std::shared_ptr<Snapshot> next_;
+    std::array<Snapshot::Shard*, Snapshot::kShards> owned_{};
+};
+
+const OrderCache::Snapshot::Shard& OrderCache::Snapshot::shard(std::string_view key) const {
+    return *shards[shardIndex(key)];
+}
+
+const Order* OrderCache::Snapshot::find(std::string_view id) const {
+    const Shard& holder = shard(id);
+    auto it = holder.orders.find(id);
+    return it == holder.orders.end() ? nullptr : it->second.get();
+}
+
+const Order* OrderCache::Snapshot::findByClientOrderId(std::string_view client_order_id) const {
+    const Shard& holder = shard(client_order_id);
+    auto it = holder.ids_by_client_order_id.find(client_order_id);
+    return it == holder.ids_by_client_order_id.end() ? nullptr : find(it->second);
+}
+
+std::vector<std::shared_ptr<const Order>> OrderCache::Snapshot::open() const {
+    std::vector<std::shared_ptr<const Order>> result;
+    for (const auto& holder : shards) {
+        for (const auto& [id, order] : holder->orders) {
+            if (!isTerminalOrderStatus(order->status)) {
+                result.push_back(order);
+            }
+        }
+    }
+    return result;
+}
+
+OrderCache::OrderCache(std::size_t max_closed) : max_closed_(max_closed), current_(emptySnapshot()) {}
+
+OrderCache::ReconcileStats OrderCache::reconcile(std::vector<Order> open_orders) {
+    ReconcileStats stats;
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    Update next(*current_.load());
+
+    std::unordered_set<std::string_view> listed;
+    listed.reserve(open_orders.size());
+    for (const Order& order : open_orders) {
+        listed.insert(order.id);
+    }
+    for (const auto& holder : next.view().shards) {
+        for (const auto& [id, order] : holder->orders) {
+            if (!isTerminalOrderStatus(order->status) && !listed.contains(id)) {
+                stats.vanished.push_back(id);
+            }
+        }
+    }
+
+    for (Order& order : open_orders) {
+        bool known = next.view().find(order.id) != nullptr;
+        if (!upsertInto(next, std::move(order))) {
+            continue;
+        }
+        if (known) {
+            ++stats.updated;
+        } else {
+            ++stats.inserted;
+        }
+    }
+    evictClosed(next);
+    publish(next);
+    return stats;
+}
+
+bool OrderCache::apply(const TradeUpdate& update) {
+    return upsert(update.order);
+}
+
+Status OrderCache::apply(const std::string& trade_update_json) {
+    TradeUpdate update;
+    if (Status status = update.fromJSON(trade_update_json); !status.ok()) {
+        return status;
+    }
+    if (update.order.id.empty()) {
+        return Status(1, "Trade update did not contain an order id");
+    }
+    upsert(std::move(update.order));
+    return Status();
+}
+
+bool OrderCache::upsert(Order order) {
+    if (order.id.empty()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    Update next(*current_.load());
+    if (!upsertInto(next, std::move(order))) {
+        return false;
+    }
+    evictClosed(next);
+    publish(next);
+    return true;
+}
+
+std::shared_ptr<const OrderCache::Snapshot> OrderCache::snapshot() const {
+    return current_.load();
+}
+
+std::shared_ptr<const Order> OrderCache::find(std::string_view id) const {
+    return findShared(*snapshot(), id);
+}
+
+std::shared_ptr<const Order> OrderCache::findByClientOrderId(std::string_view client_order_id) const {
+    std::shared_ptr<const Snapshot> current = snapshot();
+    const Snapshot::Shard& holder = current->shard(client_order_id);
+    auto it = holder.ids_by_client_order_id.find(client_order_id);
+    return it == holder.ids_by_client_order_id.end() ? nullptr : findShared(*current, it->second);
+}
+
+bool OrderCache::upsertInto(Update& next, Order&& order) {
+    // Orders are keyed by id, so one without an id could never be found or replaced
+    if (order.id.empty()) {
+        return false;
+    }
+    const Order* cached = next.view().find(order.id);
+    bool was_terminal = false;
+    if (cached != nullptr) {
+        if (isOlder(order.updated_at, cached->updated_at)) {
+            return false;
+        }
+        was_terminal = isTerminalOrderStatus(cached->status);
+    } else {
+        ++next.snapshot().order_count;
+    }
+
+    if (!was_terminal && isTerminalOrderStatus(order.status)) {
+        closed_.push_back(order.id);
+    }
+    if (!order.client_order_id.empty()) {
+        next.shard(order.client_order_id).ids_by_client_order_id[order.client_order_id] = order.id;
+    }
+    Snapshot::Shard& holder = next.shard(order.id);
+    std::string id = order.id;
+    holder.orders[std::move(id)] = std::make_shared<const Order>(std::move(order));
+    return true;
+}
+
+void OrderCache::evictClosed(Update& next) {
+    while (closed_.size() > max_closed_) {
+        const Order* order = next.view().find(closed_.front());
+        if (order != nullptr && isTerminalOrderStatus(order->status)) {
+            std::string client_order_id = order->client_order_id;
+            // Erasing the order from its (writable) shard may free it, so nothing of it is used afterwards
+            next.shard(closed_.front()).orders.erase(closed_.front());
+            if (!client_order_id.empty()) {
+                next.shard(client_order_id).ids_by_client_order_id.erase(client_order_id);
+            }
+            --next.snapshot().order_count;
+        }
+        closed_.pop_front();
+    }
+}
+
+void OrderCache::publish(Update& next) {
+    std::shared_ptr<Snapshot> snapshot = next.take();
+    ++snapshot->version;
+    current_.store(std::move(snapshot));
+}
+
+}  // namespace alpaca::markets
@@ -0,0 +1,332 @@
+#include <alpaca/markets/order_request.hpp>
+
+#include <string_view>
+#include <utility>
+
+namespace alpaca::markets {
+
+namespace {
+
+// Printable ASCII which needs no escaping inside a JSON string
+bool isPlainString(std::string_view value) {
+    for (char c : value) {
+        if (c < 0x20 || c > 0x7e || c == '"' || c == '\\') {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status checkClientOrderId(std::string_view client_order_id) {
+    if (client_order_id.size() > OrderRequest::kMaxClientOrderIdLength) {
+        return Status(1, "Client order id must be at most 128 characters");
+    }
+    if (!isPlainString(client_order_id)) {
+        return Status(1, "Client order id must be printable ASCII without quotes or backslashes");
+    }
+    return Status();
+}
+
+Status checkSymbol(const std::string& symbol) {
+    if (symbol.empty()) {
+        return Status(1, "Order symbol is required");
+    }
+    if (!isPlainString(symbol)) {
+        return Status(1, "Order symbol must be printable ASCII without quotes or backslashes");
+    }
+    return Status();
+}
+
+Status checkPrice(const Decimal& price, const char* name, bool required) {
+    if (price.isNegative()) {
+        return Status(1, std::string("Order ") + name + " must not be negative");
+    }
+    if (required && price.isZero()) {
+        return Status(1, std::string("Order ") + name + " is required for this order type");
+    }
+    return Status();
+}
+
+// The enum helpers return strings short enough for the small-string buffer, so they don't allocate
+void appendString(std::string& out, const char* key_and_quote, std::string_view value) {
+    out += key_and_quote;
+    out += value;
+    out += '"';
+}
+
+void appendDecimal(std::string& out, const char* key_and_quote, const Decimal& value) {
+    out += key_and_quote;
+    value.appendTo(out);
+    out += '"';
+}
+
+void appendOptionalDecimal(std::string& out, const char* key_and_quote, const Decimal& value) {
+    if (!value.isZero()) {
+        appendDecimal(out, key_and_quote, value);
+    }
+}
+
+OrderRequest makeRequest(std::string symbol, Decimal qty, OrderSide side, OrderType type) {
+    OrderRequest request;
+    request.symbol = std::move(symbol);
+    request.qty = qty;
+    request.side = side;
+    request.type = type;
+    return request;
+}
+
+}  // namespace
+
+OrderRequest OrderRequest::market(std::string symbol, Decimal qty, OrderSide side) {
+    return makeRequest(std::move(symbol), qty, side, OrderType::Market);
+}
+
+OrderRequest OrderRequest::notionalMarket(std::string symbol, Decimal notional, OrderSide side) {
+    OrderRequest request = makeRequest(std::move(symbol), Decimal(), side, OrderType::Market);
+    request.notional = notional;
+    return request;
+}
+
+OrderRequest OrderRequest::limit(std::string symbol, Decimal qty, OrderSide side, Decimal limit_price) {
+    OrderRequest request = makeRequest(std::move(symbol), qty, side, OrderType::Limit);
+    request.limit_price = limit_price;
+    return request;
+}
+
+OrderRequest OrderRequest::stop(std::string symbol, Decimal qty, OrderSide side, Decimal stop_price) {
+    OrderRequest request = makeRequest(std::move(symbol), qty, side, OrderType::Stop);
+    request.stop_price = stop_price;
+    return request;
+}
+
+OrderRequest OrderRequest::stopLimit(std::string symbol, Decimal qty, OrderSide side, Decimal stop_price,
+                                     Decimal limit_price) {
+    OrderRequest request = makeRequest(std::move(symbol), qty, side, OrderType::StopLimit);
+    request.stop_price = stop_price;
+    request.limit_price = limit_price;
+    return request;
+}
+
+OrderRequest OrderRequest::trailingStopPrice(std::string symbol, Decimal qty, OrderSide side, Decimal trail_price) {
+    OrderRequest request = makeRequest(std::move(symbol), qty, side, OrderType::TrailingStop);
+    request.trail_price = trail_price;
+    return request;
+}
+
+OrderRequest OrderRequest::trailingStopPercent(std::string symbol, Decimal qty, OrderSide side,
+                                               Decimal trail_percent) {
+    OrderRequest request = makeRequest(std::move(symbol), qty, side, OrderType::TrailingStop);
+    request.trail_percent = trail_percent;
+    return request;
+}
+
+OrderRequest OrderRequest::multiLeg(Decimal qty, std::vector<OrderLeg> legs, Decimal limit_price) {
+    OrderRequest request =
+        makeRequest(std::string(), qty, OrderSide::Buy, limit_price.isZero() ? OrderType::Market : OrderType::Limit);
+    request.limit_price = limit_price;
+    request.order_class = OrderClass::MultiLeg;
+    request.legs = std::move(legs);
+    return request;
+}
+
+OrderRequest& OrderRequest::withTimeInForce(OrderTimeInForce value) {
+    tif = value;
+    return *this;
+}
+
+OrderRequest& OrderRequest::withClientOrderId(std::string value) {
+    client_order_id = std::move(value);
+    return *this;
+}
+
+OrderRequest& OrderRequest::withExtendedHours(bool value) {
+    extended_hours = value;
+    return *this;
+}
+
+OrderRequest& OrderRequest::withPositionIntent(PositionIntent value) {
+    position_intent = value;
+    return *this;
+}
+
+OrderRequest& OrderRequest::withOrderClass(OrderClass value) {
+    order_class = value;
+    return *this;
+}
+
+OrderRequest& OrderRequest::withTakeProfit(Decimal limit) {
+    take_profit = TakeProfit{limit};
+    return *this;
+}
+
+OrderRequest& OrderRequest::withStopLoss(Decimal stop, Decimal limit) {
+    stop_loss = StopLoss{stop, limit};
+    return *this;
+}
+
+OrderRequest& OrderRequest::bracket(Decimal take_profit_limit, Decimal stop_loss_stop, Decimal stop_loss_limit) {
+    order_class = OrderClass::Bracket;
+    return withTakeProfit(take_profit_limit).withStopLoss(stop_loss_stop, stop_loss_limit);
+}
+
+Status OrderRequest::validate() const {
+    if (type == OrderType::Unknown || tif == OrderTimeInForce::Unknown || order_class == OrderClass::Unknown) {
+        return Status(1, "Order type, time_in_force and order_class must not be Unknown");
+    }
+    if (order_class != OrderClass::MultiLeg && side == OrderSide::Unknown) {
+        return Status(1, "Order side must not be Unknown");
+    }
+    if (order_class == OrderClass::MultiLeg) {
+        if (legs.empty()) {
+            return Status(1, "Multi-leg orders need at least one leg");
+        }
+        for (const auto& leg : legs) {
+            if (Status status = checkSymbol(leg.symbol); !status.ok()) {
+                return status;
+            }
+            if (leg.ratio_qty <= Decimal()) {
+                return Status(1, "Order leg ratio_qty must be positive");
+            }
+            if (leg.side == OrderSide::Unknown) {
+                return Status(1, "Order leg side must not be Unknown");
+            }
+        }
+    } else if (!legs.empty()) {
+        return Status(1, "Order legs require OrderClass::MultiLeg");
+    } else if (Status status = checkSymbol(symbol); !status.ok()) {
+        return status;
+    }
+
+    if (qty.isNegative() || notional.isNegative()) {
+        return Status(1, "Order qty and notional must not be negative");
+    }
+    if (qty.isZero() == notional.isZero()) {
+        return Status(1, "Order needs exactly one of qty and notional");
+    }
+    if (!notional.isZero() && (type != OrderType::Market && type != OrderType::Limit)) {
+        return Status(1, "Notional orders must be market or limit orders");
+    }
+
+    bool needs_limit = type == OrderType::Limit || type == OrderType::StopLimit;
+    bool needs_stop = type == OrderType::Stop || type == OrderType::StopLimit;
+    if (Status status = checkPrice(limit_price, "limit_price", needs_limit); !status.ok()) {
+        return status;
+    }
+    if (Status status = checkPrice(stop_price, "stop_price", needs_stop); !status.ok()) {
+        return status;
+    }
+    if (Status status = checkPrice(trail_price, "trail_price", false); !status.ok()) {
+        return status;
+    }
+    if (Status status = checkPrice(trail_percent, "trail_percent", false); !status.ok()) {
+        return status;
+    }
+    if (type == OrderType::TrailingStop && trail_price.isZero() == trail_percent.isZero()) {
+        return Status(1, "Trailing stop orders need exactly one of trail_price and trail_percent");
+    }
+
+    switch (order_class) {
+        case OrderClass::Bracket:
+        case OrderClass::OneCancelsOther:
+            if (!take_profit || !stop_loss) {
+                return Status(1, "Bracket and OCO orders need both take_profit and stop_loss");
+            }
+            break;
+        case OrderClass::OneTriggersOther:
+            if (!take_profit && !stop_loss) {
+                return Status(1, "OTO orders need take_profit or stop_loss");
+            }
+            break;
+        default:
+            break;
+    }
+    if (take_profit) {
+        if (Status status = checkPrice(take_profit->limit_price, "take_profit limit_price", true); !status.ok()) {
+            return status;
+        }
+    }
+    if (stop_loss) {
+        if (Status status = checkPrice(stop_loss->stop_price, "stop_loss stop_price", true); !status.ok()) {
+            return status;
+        }
+        if (Status status = checkPrice(stop_loss->limit_price, "stop_loss limit_price", false); !status.ok()) {
+            return status;
+        }
+    }
+
+    return checkClientOrderId(client_order_id);
+}
+
+Status OrderRequest::render(std::string& out) const {
+    return render(out, client_order_id);
+}
+
+Status OrderRequest::render(std::string& out, std::string_view client_order_id_override) const {
+    if (Status status = validate(); !status.ok()) {
+        return status;
+    }
+    if (Status status = checkClientOrderId(client_order_id_override); !status.ok()) {
+        return status;
+    }
+
+    // Strings were checked by validate(), so they are written without escaping
+    out.assign("{");
+    if (!symbol.empty()) {
+        appendString(out, "\"symbol\":\"", symbol);
+        out += ',';
+    }
+    if (!notional.isZero()) {
+        appendDecimal(out, "\"notional\":\"", notional);
+    } else {
+        appendDecimal(out, "\"qty\":\"", qty);
+    }
+    if (order_class != OrderClass::MultiLeg) {
+        appendString(out, ",\"side\":\"", orderSideToString(side));
+    }
+    appendString(out, ",\"type\":\"", orderTypeToString(type));
+    appendString(out, ",\"time_in_force\":\"", orderTimeInForceToString(tif));
+    appendOptionalDecimal(out, ",\"limit_price\":\"", limit_price);
+    appendOptionalDecimal(out, ",\"stop_price\":\"", stop_price);
+    appendOptionalDecimal(out, ",\"trail_price\":\"", trail_price);
+    appendOptionalDecimal(out, ",\"trail_percent\":\"", trail_percent);
+    if (extended_hours) {
+        out += ",\"extended_hours\":true";
+    }
+    if (!client_order_id_override.empty()) {
+        appendString(out, ",\"client_order_id\":\"", client_order_id_override);
+    }
+    if (order_class != OrderClass::Simple) {
+        appendString(out, ",\"order_class\":\"", orderClassToString(order_class));
+    }
+    if (position_intent) {
+        appendString(out, ",\"position_intent\":\"", positionIntentToString(*position_intent));
+    }
+    if (take_profit) {
+        appendDecimal(out, ",\"take_profit\":{\"limit_price\":\"", take_profit->limit_price);
+        out += '}';
+    }
+    if (stop_loss) {
+        appendDecimal(out, ",\"stop_loss\":{\"stop_price\":\"", stop_loss->stop_price);
+        appendOptionalDecimal(out, ",\"limit_price\":\"", stop_loss->limit_price);
+        out += '}';
+    }
+    if (!legs.empty()) {
+        out += ",\"legs\":[";
+        for (std::size_t i = 0; i < legs.size(); ++i) {
+            const OrderLeg& leg = legs[i];
+            out += i == 0 ? "{" : ",{";
+            appendString(out, "\"symbol\":\"", leg.symbol);
+            appendDecimal(out, ",\"ratio_qty\":\"", leg.ratio_qty);
+            appendString(out, ",\"side\":\"", orderSideToString(leg.side));
+            if (leg.position_intent) {
+                appendString(out, ",\"position_intent\":\"", positionIntentToString(*leg.position_intent));
+            }
+            out += '}';
+        }
+        out += ']';
+    }
+    out += '}';
+    return Status();
+}
+
+}  // namespace alpaca::markets
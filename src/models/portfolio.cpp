@@ -1,27 +1,46 @@
 #include <alpaca/markets/portfolio.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status PortfolioHistory::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing portfolio history JSON");
-    }
+namespace {
+const char* kPortfolioHistoryParseError = "Received parse error when deserializing portfolio history JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kPortfolioHistoryFields = makeFieldTable<PortfolioHistory>(
+    field("base_value", &PortfolioHistory::base_value),
+    field("equity", &PortfolioHistory::equity),
+    field("profit_loss", &PortfolioHistory::profit_loss),
+    field("profit_loss_pct", &PortfolioHistory::profit_loss_pct),
+    field("timeframe", &PortfolioHistory::timeframe),
+    field("timestamp", &PortfolioHistory::timestamp));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, PortfolioHistory& portfolio_history) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a portfolio history object");
     }
+    return decodeFields(d, portfolio_history, kPortfolioHistoryFields);
+}
+
+}  // namespace detail
 
-    PARSE_DOUBLE(base_value, "base_value")
-    PARSE_VECTOR_DOUBLES(equity, "equity")
-    PARSE_VECTOR_DOUBLES(profit_loss, "profit_loss")
-    PARSE_VECTOR_DOUBLES(profit_loss_pct, "profit_loss_pct")
-    PARSE_STRING(timeframe, "timeframe")
-    PARSE_VECTOR_UINT64(timestamp, "timestamp")
+Status PortfolioHistory::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kPortfolioHistoryParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status PortfolioHistory::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kPortfolioHistoryParseError);
 }
 
 }  // namespace alpaca::markets
@@ -1,37 +1,56 @@
 #include <alpaca/markets/position.hpp>
 
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Position::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing position JSON");
-    }
+namespace {
+const char* kPositionParseError = "Received parse error when deserializing position JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kPositionFields = makeFieldTable<Position>(
+    field("asset_class", &Position::asset_class),
+    field("asset_id", &Position::asset_id),
+    field("avg_entry_price", &Position::avg_entry_price),
+    field("change_today", &Position::change_today),
+    field("cost_basis", &Position::cost_basis),
+    field("current_price", &Position::current_price),
+    field("exchange", &Position::exchange),
+    field("lastday_price", &Position::lastday_price),
+    field("market_value", &Position::market_value),
+    field("qty", &Position::qty),
+    field("side", &Position::side),
+    field("symbol", &Position::symbol),
+    field("unrealized_intraday_pl", &Position::unrealized_intraday_pl),
+    field("unrealized_intraday_plpc", &Position::unrealized_intraday_plpc),
+    field("unrealized_pl", &Position::unrealized_pl),
+    field("unrealized_plpc", &Position::unrealized_plpc));
+
+}  // namespace
 
+Status decode(const rapidjson::Value& d, Position& position) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a position object");
     }
+    return decodeFields(d, position, kPositionFields);
+}
+
+}  // namespace detail
+
+Status Position::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kPositionParseError);
+    }
+    return detail::decode(d, *this);
+}
 
-    PARSE_STRING(asset_class, "asset_class")
-    PARSE_STRING(asset_id, "asset_id")
-    PARSE_STRING(avg_entry_price, "avg_entry_price")
-    PARSE_STRING(change_today, "change_today")
-    PARSE_STRING(cost_basis, "cost_basis")
-    PARSE_STRING(current_price, "current_price")
-    PARSE_STRING(exchange, "exchange")
-    PARSE_STRING(lastday_price, "lastday_price")
-    PARSE_STRING(market_value, "market_value")
-    PARSE_STRING(qty, "qty")
-    PARSE_STRING(side, "side")
-    PARSE_STRING(symbol, "symbol")
-    PARSE_STRING(unrealized_intraday_pl, "unrealized_intraday_pl")
-    PARSE_STRING(unrealized_intraday_plpc, "unrealized_intraday_plpc")
-    PARSE_STRING(unrealized_pl, "unrealized_pl")
-    PARSE_STRING(unrealized_plpc, "unrealized_plpc")
-
-    return Status();
+Status Position::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kPositionParseError);
 }
 
 }  // namespace alpaca::markets
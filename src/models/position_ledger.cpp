@@ -0,0 +1,344 @@
+#include <alpaca/markets/position_ledger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace alpaca::markets {
+
+namespace {
+
+// REST models carry numbers as decimal strings. An empty value reads as 0; anything but a plain number is an error
+Status parseDecimal(const std::string& value, std::string_view field, double& out) {
+    out = 0.0;
+    if (value.empty()) {
+        return Status();
+    }
+    // strtod would also take whitespace, "inf", "nan" and hex floats, none of which the API sends
+    char* end = nullptr;
+    if (value.find_first_not_of("0123456789+-.eE") == std::string::npos) {
+        out = std::strtod(value.c_str(), &end);
+    }
+    if (end != value.c_str() + value.size() || !std::isfinite(out)) {
+        out = 0.0;
+        return Status(1, "Malformed " + std::string(field) + ": \"" + value + "\"");
+    }
+    return Status();
+}
+
+void mark(LedgerPosition& position, double price) {
+    position.current_price = price;
+    position.cost_basis = position.qty * position.avg_entry_price;
+    position.market_value = position.qty * price;
+    position.unrealized_pl = position.market_value - position.cost_basis;
+}
+
+void sumMarketValues(PositionLedger::Snapshot& next) {
+    double long_market_value = 0.0;
+    double short_market_value = 0.0;
+    for (const auto& [symbol, position] : next.positions) {
+        if (position.qty < 0) {
+            short_market_value += position.market_value;
+        } else {
+            long_market_value += position.market_value;
+        }
+    }
+    next.account.long_market_value = long_market_value;
+    next.account.short_market_value = short_market_value;
+    next.account.equity = next.account.cash + long_market_value + short_market_value;
+}
+
+using Positions = decltype(PositionLedger::Snapshot::positions);
+
+// Shares opened today can't outnumber, or be on the other side of, the shares held
+void clampOpened(LedgerPosition& position) {
+    if (position.qty == 0.0 || (position.qty > 0) != (position.opened_qty > 0)) {
+        position.opened_qty = 0.0;
+    } else if (std::abs(position.opened_qty) > std::abs(position.qty)) {
+        position.opened_qty = position.qty;
+    }
+}
+
+void fill(Positions& positions, LedgerAccount& account, std::string_view symbol, double qty, double price) {
+    auto it = positions.find(symbol);
+    if (it == positions.end()) {
+        it = positions.emplace(std::string(symbol), LedgerPosition{}).first;
+        it->second.symbol = std::string(symbol);
+    }
+    LedgerPosition& position = it->second;
+
+    double opening = qty;
+    if (position.qty != 0.0 && (position.qty > 0) != (qty > 0)) {
+        // Reduce (and possibly flip) the position: the closed part realizes P&L
+        double closing = std::copysign(std::min(std::abs(qty), std::abs(position.qty)), qty);
+        position.realized_pl -= closing * (price - position.avg_entry_price);
+        position.qty += closing;
+        clampOpened(position);
+        account.buying_power += std::abs(closing) * price;
+        opening = qty - closing;
+    }
+    if (opening != 0.0) {
+        double held = std::abs(position.qty);
+        position.avg_entry_price =
+            (held * position.avg_entry_price + std::abs(opening) * price) / (held + std::abs(opening));
+        position.qty += opening;
+        position.opened_qty += opening;
+        account.buying_power -= std::abs(opening) * price;
+    }
+    clampOpened(position);
+    if (position.qty == 0.0) {
+        position.avg_entry_price = 0.0;
+    }
+    account.cash -= qty * price;
+    mark(position, price);
+}
+
+// A fill, then the position quantity the event reported (if any), which wins over the computed one
+void bookFill(Positions& positions, LedgerAccount& account, std::string_view symbol, double qty, double price,
+              const std::optional<double>& position_qty) {
+    fill(positions, account, symbol, qty, price);
+    if (position_qty) {
+        LedgerPosition& position = positions.find(symbol)->second;
+        position.qty = *position_qty;
+        clampOpened(position);
+        if (position.qty == 0.0) {
+            position.avg_entry_price = 0.0;
+        }
+        mark(position, price);
+    }
+}
+
+// Parse REST results into the ledger's numeric form
+Status parseReconcile(const Account& account, const std::vector<Position>& positions, Positions& reconciled,
+                      LedgerAccount& balances) {
+    reconciled.reserve(positions.size());
+    for (const Position& position : positions) {
+        LedgerPosition& entry = reconciled[position.symbol];
+        entry.symbol = position.symbol;
+        entry.asset_class = position.asset_class;
+        double current_price = 0.0;
+        for (Status status : {parseDecimal(position.qty, position.symbol + " qty", entry.qty),
+                              parseDecimal(position.avg_entry_price, position.symbol + " avg_entry_price",
+                                           entry.avg_entry_price),
+                              parseDecimal(position.lastday_price, position.symbol + " lastday_price",
+                                           entry.lastday_price),
+                              parseDecimal(position.current_price, position.symbol + " current_price",
+                                           current_price)}) {
+            if (!status.ok()) {
+                return status;
+            }
+        }
+        if (position.side == "short" && entry.qty > 0) {
+            entry.qty = -entry.qty;
+        }
+        mark(entry, current_price);
+    }
+
+    for (Status status : {parseDecimal(account.cash, "account cash", balances.cash),
+                          parseDecimal(account.buying_power, "account buying_power", balances.buying_power),
+                          parseDecimal(account.multiplier, "account multiplier", balances.multiplier)}) {
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    if (account.multiplier.empty()) {
+        balances.multiplier = 1.0;
+    }
+    balances.trading_blocked = account.trading_blocked || account.account_blocked;
+    balances.daytrade_count = account.daytrade_count;
+    balances.pattern_day_trader = account.pattern_day_trader;
+    return Status();
+}
+
+}  // namespace
+
+const LedgerPosition* PositionLedger::Snapshot::find(std::string_view symbol) const {
+    auto it = positions.find(symbol);
+    return it == positions.end() ? nullptr : &it->second;
+}
+
+double PositionLedger::Snapshot::qty(std::string_view symbol) const {
+    const LedgerPosition* position = find(symbol);
+    return position == nullptr ? 0.0 : position->qty;
+}
+
+PositionLedger::PositionLedger() : current_(std::make_shared<const Snapshot>()) {}
+
+std::shared_ptr<const PositionLedger::Snapshot> PositionLedger::snapshot() const {
+    return current_.load();
+}
+
+template <typename Update>
+void PositionLedger::publish(Update&& apply) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    publishLocked(std::forward<Update>(apply));
+}
+
+template <typename Update>
+void PositionLedger::publishLocked(Update&& apply) {
+    auto next = std::make_shared<Snapshot>(*current_.load());
+    apply(*next);
+    sumMarketValues(*next);
+    ++next->version;
+    current_.store(std::move(next));
+}
+
+PositionLedger::ReconcileToken PositionLedger::beginReconcile() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    ++pending_reconciles_;
+    return ReconcileToken{fills_};
+}
+
+Status PositionLedger::reconcile(const Account& account, const std::vector<Position>& positions,
+                                 ReconcileToken token) {
+    return reconcileSince(account, positions, token);
+}
+
+Status PositionLedger::reconcile(const Account& account, const std::vector<Position>& positions) {
+    return reconcileSince(account, positions, std::nullopt);
+}
+
+Status PositionLedger::reconcileSince(const Account& account, const std::vector<Position>& positions,
+                                      std::optional<ReconcileToken> token) {
+    // Parse everything before publishing, so a malformed value leaves the ledger as it was
+    Positions reconciled;
+    LedgerAccount balances;
+    Status parsed = parseReconcile(account, positions, reconciled, balances);
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    bool complete = true;
+    if (token) {
+        // The journal must still hold every fill applied since the token
+        complete = token->fills == fills_ || (!journal_.empty() && journal_.front().sequence <= token->fills + 1);
+        if (pending_reconciles_ > 0) {
+            --pending_reconciles_;
+        }
+    }
+    if (parsed.ok() && !complete) {
+        parsed = Status(1, "More fills were applied while the reconcile results were fetched than the ledger "
+                           "journals; fetch them again");
+    }
+
+    if (parsed.ok()) {
+        publishLocked([&](Snapshot& next) {
+            for (const JournaledFill& fill : journal_) {
+                if (token && fill.sequence > token->fills) {
+                    bookFill(reconciled, balances, fill.symbol, fill.qty, fill.price, fill.position_qty);
+                }
+            }
+            // The previous snapshot's realized P&L and opened shares already include the fills applied again above
+            for (auto& [symbol, entry] : reconciled) {
+                if (const LedgerPosition* previous = next.find(symbol)) {
+                    entry.realized_pl = previous->realized_pl;
+                    entry.opened_qty = previous->opened_qty;
+                    clampOpened(entry);
+                }
+            }
+            next.positions = std::move(reconciled);
+            next.account = balances;
+        });
+    }
+    if (pending_reconciles_ == 0) {
+        journal_.clear();
+    }
+    return parsed;
+}
+
+Status PositionLedger::applyFill(const TradeUpdate& update) {
+    if (update.event != "fill" && update.event != "partial_fill") {
+        return Status();
+    }
+    if (update.order.symbol.empty() || update.qty.empty() || update.price.empty()) {
+        return Status(1, "Fill event did not contain symbol, qty and price");
+    }
+    if (update.order.side != "buy" && update.order.side != "sell") {
+        return Status(1, "Fill event has unknown order side: " + update.order.side);
+    }
+
+    double qty = 0.0;
+    double price = 0.0;
+    double position_qty = 0.0;
+    for (Status status : {parseDecimal(update.qty, "fill qty", qty), parseDecimal(update.price, "fill price", price),
+                          parseDecimal(update.position_qty, "fill position_qty", position_qty)}) {
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    if (!update.execution_id.empty()) {
+        if (!executions_.insert(update.execution_id).second) {
+            return Status();
+        }
+        execution_order_.push_back(update.execution_id);
+        if (execution_order_.size() > kRememberedExecutions) {
+            executions_.erase(execution_order_.front());
+            execution_order_.pop_front();
+        }
+    }
+    applyFillLocked(JournaledFill{0, update.order.symbol, update.order.side == "buy" ? qty : -qty, price,
+                                  update.position_qty.empty() ? std::nullopt : std::optional<double>(position_qty)});
+    return Status();
+}
+
+void PositionLedger::applyFill(std::string_view symbol, double qty, double price) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    applyFillLocked(JournaledFill{0, std::string(symbol), qty, price, std::nullopt});
+}
+
+void PositionLedger::applyFillLocked(JournaledFill fill) {
+    publishLocked([&](Snapshot& next) {
+        bookFill(next.positions, next.account, fill.symbol, fill.qty, fill.price, fill.position_qty);
+    });
+    fill.sequence = ++fills_;
+    if (pending_reconciles_ > 0) {
+        journal_.push_back(std::move(fill));
+        if (journal_.size() > kMaxJournaledFills) {
+            journal_.pop_front();
+        }
+    }
+}
+
+void PositionLedger::startTradingDay() {
+    publish([](Snapshot& next) {
+        for (auto& [symbol, position] : next.positions) {
+            position.opened_qty = 0.0;
+        }
+    });
+}
+
+void PositionLedger::updatePrice(std::string_view symbol, double price) {
+    publish([&](Snapshot& next) {
+        auto it = next.positions.find(symbol);
+        if (it != next.positions.end()) {
+            mark(it->second, price);
+        }
+    });
+}
+
+void PositionLedger::updatePrices(const SymbolMap<Trade>& trades) {
+    publish([&](Snapshot& next) {
+        for (const auto& [symbol, trade] : trades) {
+            auto it = next.positions.find(symbol);
+            if (it != next.positions.end() && trade.price > 0) {
+                mark(it->second, trade.price);
+            }
+        }
+    });
+}
+
+void PositionLedger::updatePrices(const SymbolMap<Quote>& quotes) {
+    publish([&](Snapshot& next) {
+        for (const auto& [symbol, quote] : quotes) {
+            auto it = next.positions.find(symbol);
+            if (it != next.positions.end() && quote.bid_price > 0 && quote.ask_price > 0) {
+                mark(it->second, (quote.bid_price + quote.ask_price) / 2);
+            }
+        }
+    });
+}
+
+}  // namespace alpaca::markets
@@ -1,59 +1,74 @@
 #include <alpaca/markets/quote.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Quote::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing quote JSON");
-    }
+namespace {
+const char* kQuoteParseError = "Received parse error when deserializing quote JSON";
+const char* kLatestQuoteParseError = "Received parse error when deserializing latest quote JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
 
+// Market Data API v2 field names
+constexpr auto kQuoteFields = makeFieldTable<Quote>(
+    field("ap", &Quote::ask_price),     // ask price
+    field("as", &Quote::ask_size),      // ask size
+    field("ax", &Quote::ask_exchange),  // ask exchange
+    field("bp", &Quote::bid_price),     // bid price
+    field("bs", &Quote::bid_size),      // bid size
+    field("bx", &Quote::bid_exchange),  // bid exchange
+    field("t", &Quote::timestamp),      // timestamp
+    field("c", &Quote::conditions));    // conditions
+
+// v2 API: quote is under "quote" key
+constexpr auto kLatestQuoteFields = makeFieldTable<LatestQuote>(
+    field("symbol", &LatestQuote::symbol),
+    objectField<&LatestQuote::quote>("quote"));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Quote& quote) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a quote object");
     }
+    return decodeFields(d, quote, kQuoteFields);
+}
 
-    // Market Data API v2 field names
-    PARSE_DOUBLE(ask_price, "ap")     // ask price
-    PARSE_UINT64(ask_size, "as")      // ask size
-    PARSE_STRING(ask_exchange, "ax")  // ask exchange
-    PARSE_DOUBLE(bid_price, "bp")     // bid price
-    PARSE_UINT64(bid_size, "bs")      // bid size
-    PARSE_STRING(bid_exchange, "bx")  // bid exchange
-    PARSE_STRING(timestamp, "t")      // timestamp
-    PARSE_VECTOR_STRINGS(conditions, "c")  // conditions
-
-    return Status();
+Status decode(const rapidjson::Value& d, LatestQuote& latest_quote) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a latest quote object");
+    }
+    return decodeFields(d, latest_quote, kLatestQuoteFields);
 }
 
-Status LatestQuote::fromJSON(const std::string& json) {
+}  // namespace detail
+
+Status Quote::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing latest quote JSON");
+        return Status(1, kQuoteParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a latest quote object");
-    }
+Status Quote::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kQuoteParseError);
+}
 
-    PARSE_STRING(symbol, "symbol")
-
-    // v2 API: quote is under "quote" key
-    if (d.HasMember("quote") && d["quote"].IsObject()) {
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["quote"].Accept(writer);
-        if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status LatestQuote::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kLatestQuoteParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status LatestQuote::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kLatestQuoteParseError);
 }
 
 }  // namespace alpaca::markets
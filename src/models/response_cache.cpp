@@ -0,0 +1,73 @@
+#include <alpaca/markets/response_cache.hpp>
+
+namespace alpaca::markets {
+
+bool ResponseCache::lookupErased(const std::string& key, std::type_index type, std::shared_ptr<const void>& value,
+                                 bool& fresh, std::string& etag) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.type != type) {
+        return false;
+    }
+    Entry& entry = it->second;
+    fresh = Clock::now() < entry.expires;
+    if (!fresh && entry.etag.empty()) {
+        recency_.erase(entry.recency);
+        entries_.erase(it);
+        return false;
+    }
+    recency_.splice(recency_.begin(), recency_, entry.recency);
+    value = entry.value;
+    etag = entry.etag;
+    return true;
+}
+
+void ResponseCache::storeErased(const std::string& key, std::type_index type, std::shared_ptr<const void> value,
+                                std::chrono::milliseconds ttl, std::string etag) {
+    if (max_entries_ == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        recency_.splice(recency_.begin(), recency_, it->second.recency);
+        it->second.type = type;
+        it->second.value = std::move(value);
+        it->second.expires = Clock::now() + ttl;
+        it->second.etag = std::move(etag);
+        return;
+    }
+
+    while (entries_.size() >= max_entries_) {
+        entries_.erase(recency_.back());
+        recency_.pop_back();
+    }
+    recency_.push_front(key);
+    entries_.emplace(key, Entry{type, std::move(value), Clock::now() + ttl, std::move(etag), recency_.begin()});
+}
+
+void ResponseCache::renew(const std::string& key, std::chrono::milliseconds ttl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        it->second.expires = Clock::now() + ttl;
+    }
+}
+
+void ResponseCache::invalidate(const std::string& prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) {
+            recency_.erase(it->second.recency);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::size_t ResponseCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+}  // namespace alpaca::markets
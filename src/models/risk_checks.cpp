@@ -0,0 +1,259 @@
+#include <alpaca/markets/risk_checks.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace alpaca::markets {
+
+namespace {
+
+// The position in intent's symbol once the earlier orders of its batch (if any) have filled
+double heldQty(const OrderIntent& intent, const RiskContext& context) {
+    double held = context.ledger ? context.ledger->qty(intent.symbol) : 0.0;
+    if (intent.batch != nullptr) {
+        for (const OrderIntent& earlier : *intent.batch) {
+            if (earlier.symbol == intent.symbol) {
+                held += earlier.signedQty();
+            }
+        }
+    }
+    return held;
+}
+
+// Whether intent trades against held, the position it would reduce
+bool reduces(const OrderIntent& intent, double held) {
+    return held != 0.0 && (held > 0) != (intent.side == OrderSide::Buy);
+}
+
+// Whether any of the position in intent's symbol was opened today: by fills the ledger applied since the start of
+// the trading day, or by the earlier orders of intent's batch that added to it
+bool openedToday(const OrderIntent& intent, const RiskContext& context, double held) {
+    if (const LedgerPosition* position = context.ledger->find(intent.symbol);
+        position != nullptr && position->opened_qty != 0.0 && (position->opened_qty > 0) == (held > 0)) {
+        return true;
+    }
+    if (intent.batch != nullptr) {
+        for (const OrderIntent& earlier : *intent.batch) {
+            if (earlier.symbol == intent.symbol && !reduces(earlier, held)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Only the part of an order which opens or extends a position consumes buying power
+double openingNotional(const OrderIntent& intent, double held, double price) {
+    if (intent.notional > 0) {
+        return intent.notional;
+    }
+    double opening = std::abs(intent.signedQty());
+    if (held != 0.0 && (held > 0) != (intent.signedQty() > 0)) {
+        opening = std::max(0.0, std::abs(intent.signedQty()) - std::abs(held));
+    }
+    return opening * price;
+}
+
+// Buying power used by the earlier orders of intent's batch, each applied to the position the ones before it left
+double batchBuyingPower(const OrderIntent& intent, const RiskContext& context) {
+    if (intent.batch == nullptr) {
+        return 0.0;
+    }
+    // Quotes are only known for intent's symbol
+    RiskContext unquoted;
+    unquoted.ledger = context.ledger;
+    std::unordered_map<std::string_view, double> held;
+    double used = 0.0;
+    for (const OrderIntent& earlier : *intent.batch) {
+        auto it = held.find(earlier.symbol);
+        if (it == held.end()) {
+            it = held.emplace(earlier.symbol, context.ledger ? context.ledger->qty(earlier.symbol) : 0.0).first;
+        }
+        double price =
+            earlier.symbol == intent.symbol ? context.referencePrice(earlier) : unquoted.referencePrice(earlier);
+        used += openingNotional(earlier, it->second, price);
+        it->second += earlier.signedQty();
+    }
+    return used;
+}
+
+}  // namespace
+
+double RiskContext::referencePrice(const OrderIntent& intent) const {
+    if (intent.limit_price > 0) {
+        return intent.limit_price;
+    }
+    if (quote && quote->bid_price > 0 && quote->ask_price > 0) {
+        return (quote->bid_price + quote->ask_price) / 2;
+    }
+    if (ledger) {
+        if (const LedgerPosition* position = ledger->find(intent.symbol); position && position->current_price > 0) {
+            return position->current_price;
+        }
+    }
+    return intent.stop_price;
+}
+
+double RiskContext::orderNotional(const OrderIntent& intent) const {
+    if (intent.notional > 0) {
+        return intent.notional;
+    }
+    return intent.qty * referencePrice(intent);
+}
+
+RiskChecks::RiskChecks(RiskSources sources) : sources_(std::move(sources)) {}
+
+RiskChecks& RiskChecks::add(std::string name, RiskCheck check) {
+    checks_.emplace_back(std::move(name), std::move(check));
+    return *this;
+}
+
+Status RiskChecks::evaluate(const OrderIntent& intent) const {
+    if (checks_.empty()) {
+        return Status();
+    }
+    return evaluate(intent, context(intent));
+}
+
+Status RiskChecks::evaluate(const OrderIntent& intent, const RiskContext& context) const {
+    for (const auto& [name, check] : checks_) {
+        if (Status status = check(intent, context); !status.ok()) {
+            return Status(status.getCode(), "Pre-trade check " + name + " rejected order: " + status.getMessage());
+        }
+    }
+    return Status();
+}
+
+RiskContext RiskChecks::context(const OrderIntent& intent) const {
+    RiskContext context;
+    if (sources_.ledger != nullptr) {
+        context.ledger = sources_.ledger->snapshot();
+    }
+    if (sources_.assets != nullptr) {
+        context.asset = sources_.assets->find(intent.symbol);
+    }
+    if (sources_.quote) {
+        context.quote = sources_.quote(intent.symbol);
+    }
+    return context;
+}
+
+namespace risk {
+
+RiskCheck maxNotional(double max_notional) {
+    return [max_notional](const OrderIntent& intent, const RiskContext& context) {
+        double notional = context.orderNotional(intent);
+        if (notional <= 0) {
+            return Status(1, "no price known to value " + intent.symbol);
+        }
+        if (notional > max_notional) {
+            std::ostringstream ss;
+            ss << "notional " << notional << " exceeds " << max_notional;
+            return Status(1, ss.str());
+        }
+        return Status();
+    };
+}
+
+RiskCheck maxPosition(double max_qty) {
+    return [max_qty](const OrderIntent& intent, const RiskContext& context) {
+        double after = heldQty(intent, context) + intent.signedQty();
+        if (std::abs(after) > max_qty) {
+            std::ostringstream ss;
+            ss << "position in " << intent.symbol << " would be " << after << ", limit " << max_qty;
+            return Status(1, ss.str());
+        }
+        return Status();
+    };
+}
+
+RiskCheck priceBand(double max_deviation) {
+    return [max_deviation](const OrderIntent& intent, const RiskContext& context) {
+        if (!context.quote || context.quote->bid_price <= 0 || context.quote->ask_price <= 0) {
+            return Status();
+        }
+        double mid = (context.quote->bid_price + context.quote->ask_price) / 2;
+        for (double price : {intent.limit_price, intent.stop_price}) {
+            if (price > 0 && std::abs(price - mid) > max_deviation * mid) {
+                std::ostringstream ss;
+                ss << "price " << price << " is more than " << max_deviation * 100 << "% from the quote midpoint "
+                   << mid;
+                return Status(1, ss.str());
+            }
+        }
+        return Status();
+    };
+}
+
+RiskCheck patternDayTrader(int max_day_trades, double min_equity) {
+    return [max_day_trades, min_equity](const OrderIntent& intent, const RiskContext& context) {
+        if (!context.ledger) {
+            return Status();
+        }
+        const LedgerAccount& account = context.ledger->account;
+        if (account.pattern_day_trader || account.equity >= min_equity || account.daytrade_count < max_day_trades) {
+            return Status();
+        }
+        double held = heldQty(intent, context);
+        if (reduces(intent, held) && openedToday(intent, context, held)) {
+            std::ostringstream ss;
+            ss << "closing " << intent.symbol << " opened today would be a day trade; the account has used "
+               << account.daytrade_count << " with equity below " << min_equity;
+            return Status(1, ss.str());
+        }
+        return Status();
+    };
+}
+
+RiskCheck shortable() {
+    return [](const OrderIntent& intent, const RiskContext& context) {
+        if (intent.side != OrderSide::Sell || context.asset == nullptr) {
+            return Status();
+        }
+        double held = heldQty(intent, context);
+        if (intent.qty == 0.0 && intent.notional > 0) {
+            // Notional orders can't sell short, so one passes only if the long position covers it
+            double price = context.referencePrice(intent);
+            if (held > 0 && price <= 0) {
+                return Status(1, "no price known to size the notional sell of " + intent.symbol);
+            }
+            if (held <= 0 || held < intent.notional / price) {
+                return Status(1, "notional sell of " + intent.symbol + " would open a short position");
+            }
+            return Status();
+        }
+        if (held - intent.qty >= 0) {
+            return Status();
+        }
+        if (!context.asset->shortable) {
+            return Status(1, intent.symbol + " is not shortable");
+        }
+        if (!context.asset->easy_to_borrow) {
+            return Status(1, intent.symbol + " is not easy to borrow");
+        }
+        return Status();
+    };
+}
+
+RiskCheck buyingPower() {
+    return [](const OrderIntent& intent, const RiskContext& context) {
+        if (!context.ledger) {
+            return Status();
+        }
+        double notional = openingNotional(intent, heldQty(intent, context), context.referencePrice(intent));
+        double available = context.ledger->account.buying_power - batchBuyingPower(intent, context);
+        if (notional > available) {
+            std::ostringstream ss;
+            ss << "order needs " << notional << " buying power, " << available << " available";
+            return Status(1, ss.str());
+        }
+        return Status();
+    };
+}
+
+}  // namespace risk
+
+}  // namespace alpaca::markets
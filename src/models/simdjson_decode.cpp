@@ -0,0 +1,608 @@
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+
+#include <simdjson.h>
+
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../detail/simdjson_decode.hpp"
+
+namespace alpaca::markets::detail::simd {
+
+namespace {
+
+namespace ondemand = simdjson::ondemand;
+using simdjson::error_code;
+
+/**
+ * @brief Walks an On-Demand document into the models.
+ *
+ * Mirrors the field-table semantics of the RapidJSON decoders: a field with
+ * an unexpected type is skipped and leaves the member untouched, while a
+ * structural error anywhere in the document fails the whole decode with the
+ * model's parse error.
+ */
+class Decoder {
+public:
+    explicit Decoder(const char* parse_error) : parse_error_(parse_error) {}
+
+    Status fail() const {
+        return Status(1, parse_error_);
+    }
+
+    /**
+     * @brief Iterate the fields of an object value, calling on_field(key, value) for each.
+     *
+     * A value which is not an object returns a Status carrying type_error, or
+     * an OK status when type_error is null (the member is optional).
+     */
+    template <typename OnField>
+    Status forEachField(ondemand::value& v, const char* type_error, OnField&& on_field) {
+        ondemand::object object;
+        if (error_code error = v.get_object().get(object); error != simdjson::SUCCESS) {
+            if (error != simdjson::INCORRECT_TYPE) {
+                return fail();
+            }
+            return type_error == nullptr ? Status() : Status(1, type_error);
+        }
+        for (auto result : object) {
+            ondemand::field field;
+            std::string_view key;
+            if (std::move(result).get(field) != simdjson::SUCCESS ||
+                field.unescaped_key().get(key) != simdjson::SUCCESS) {
+                return fail();
+            }
+            if (Status status = on_field(key, field.value()); !status.ok()) {
+                return status;
+            }
+        }
+        return error_ == simdjson::SUCCESS ? Status() : fail();
+    }
+
+    void read(ondemand::value& v, std::string& out) {
+        std::string_view s;
+        if (keep(v.get_string().get(s))) {
+            out.assign(s);
+        }
+    }
+
+    void read(ondemand::value& v, double& out) {
+        double x = 0.0;
+        if (keep(v.get_double().get(x))) {
+            out = x;
+        }
+    }
+
+    void read(ondemand::value& v, uint64_t& out) {
+        uint64_t x = 0;
+        if (keep(v.get_uint64().get(x))) {
+            out = x;
+        }
+    }
+
+    void read(ondemand::value& v, std::vector<std::string>& out) {
+        ondemand::array array;
+        if (!keep(v.get_array().get(array))) {
+            return;
+        }
+        std::vector<std::string> items;
+        for (auto element : array) {
+            std::string_view s;
+            if (keep(element.get_string().get(s))) {
+                items.emplace_back(s);
+            }
+        }
+        out = std::move(items);
+    }
+
+    Status decode(ondemand::value& v, Trade& trade) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a trade object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "p") {
+                                    read(value, trade.price);
+                                } else if (key == "s") {
+                                    read(value, trade.size);
+                                } else if (key == "x") {
+                                    read(value, trade.exchange);
+                                } else if (key == "i") {
+                                    read(value, trade.id);
+                                } else if (key == "t") {
+                                    read(value, trade.timestamp);
+                                } else if (key == "c") {
+                                    read(value, trade.conditions);
+                                } else if (key == "z") {
+                                    read(value, trade.tape);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, Quote& quote) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a quote object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "ap") {
+                                    read(value, quote.ask_price);
+                                } else if (key == "as") {
+                                    read(value, quote.ask_size);
+                                } else if (key == "ax") {
+                                    read(value, quote.ask_exchange);
+                                } else if (key == "bp") {
+                                    read(value, quote.bid_price);
+                                } else if (key == "bs") {
+                                    read(value, quote.bid_size);
+                                } else if (key == "bx") {
+                                    read(value, quote.bid_exchange);
+                                } else if (key == "t") {
+                                    read(value, quote.timestamp);
+                                } else if (key == "c") {
+                                    read(value, quote.conditions);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, Bar& bar) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a bar object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "t") {
+                                    read(value, bar.timestamp);
+                                } else if (key == "o") {
+                                    read(value, bar.open_price);
+                                } else if (key == "h") {
+                                    read(value, bar.high_price);
+                                } else if (key == "l") {
+                                    read(value, bar.low_price);
+                                } else if (key == "c") {
+                                    read(value, bar.close_price);
+                                } else if (key == "v") {
+                                    read(value, bar.volume);
+                                } else if (key == "n") {
+                                    read(value, bar.trade_count);
+                                } else if (key == "vw") {
+                                    read(value, bar.vwap);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, CryptoTrade& trade) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a crypto trade object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "p") {
+                                    read(value, trade.price);
+                                } else if (key == "s") {
+                                    read(value, trade.size);
+                                } else if (key == "t") {
+                                    read(value, trade.timestamp);
+                                } else if (key == "i") {
+                                    read(value, trade.id);
+                                } else if (key == "tks") {
+                                    read(value, trade.taker_side);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, CryptoQuote& quote) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a crypto quote object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "ap") {
+                                    read(value, quote.ask_price);
+                                } else if (key == "as") {
+                                    read(value, quote.ask_size);
+                                } else if (key == "bp") {
+                                    read(value, quote.bid_price);
+                                } else if (key == "bs") {
+                                    read(value, quote.bid_size);
+                                } else if (key == "t") {
+                                    read(value, quote.timestamp);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, CryptoBar& bar) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a crypto bar object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "t") {
+                                    read(value, bar.timestamp);
+                                } else if (key == "o") {
+                                    read(value, bar.open_price);
+                                } else if (key == "h") {
+                                    read(value, bar.high_price);
+                                } else if (key == "l") {
+                                    read(value, bar.low_price);
+                                } else if (key == "c") {
+                                    read(value, bar.close_price);
+                                } else if (key == "v") {
+                                    read(value, bar.volume);
+                                } else if (key == "n") {
+                                    read(value, bar.trade_count);
+                                } else if (key == "vw") {
+                                    read(value, bar.vwap);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, Snapshot& snapshot) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a snapshot object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "latestTrade") {
+                                    return decodeIfObject(value, snapshot.latest_trade);
+                                } else if (key == "latestQuote") {
+                                    return decodeIfObject(value, snapshot.latest_quote);
+                                } else if (key == "minuteBar") {
+                                    return decodeIfObject(value, snapshot.minute_bar);
+                                } else if (key == "dailyBar") {
+                                    return decodeIfObject(value, snapshot.daily_bar);
+                                } else if (key == "prevDailyBar") {
+                                    return decodeIfObject(value, snapshot.prev_daily_bar);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, CryptoSnapshot& snapshot) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a crypto snapshot object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key == "latestTrade") {
+                                    return decodeIfObject(value, snapshot.latest_trade);
+                                } else if (key == "latestQuote") {
+                                    return decodeIfObject(value, snapshot.latest_quote);
+                                } else if (key == "minuteBar") {
+                                    return decodeIfObject(value, snapshot.minute_bar);
+                                } else if (key == "dailyBar") {
+                                    return decodeIfObject(value, snapshot.daily_bar);
+                                } else if (key == "prevDailyBar") {
+                                    return decodeIfObject(value, snapshot.prev_daily_bar);
+                                }
+                                return Status();
+                            });
+    }
+
+    Status decode(ondemand::value& v, Snapshots& snapshots) {
+        return forEachField(v, "Deserialized valid JSON but it wasn't a snapshots object",
+                            [&](std::string_view key, ondemand::value& value) {
+                                if (key != "snapshots") {
+                                    return Status();
+                                }
+                                return forEachField(value, nullptr, [&](std::string_view symbol,
+                                                                        ondemand::value& item) {
+                                    Snapshot snapshot;
+                                    if (Status status = decode(item, snapshot); !status.ok()) {
+                                        return status;
+                                    }
+                                    snapshots.snapshots[std::string(symbol)] = std::move(snapshot);
+                                    return Status();
+                                });
+                            });
+    }
+
+    /**
+     * @brief Decode a "symbol -> [item, ...]" object plus a next_page_token.
+     */
+    template <typename T>
+    Status decodePage(ondemand::value& v, const char* type_error, std::string_view name,
+                      std::map<std::string, std::vector<T>>& out, std::string& next_page_token) {
+        return forEachField(v, type_error, [&](std::string_view key, ondemand::value& value) {
+            if (key == name) {
+                return decodeSymbolArrays(value, out);
+            }
+            if (key == "next_page_token") {
+                read(value, next_page_token);
+            }
+            return Status();
+        });
+    }
+
+    /**
+     * @brief Decode a "symbol -> {...}" object into a SymbolMap with a single sort, as decodeSymbolMap() does.
+     *
+     * When member is empty the symbols are the keys of v itself; otherwise they are the keys of v[member].
+     * A missing or non-object symbol map leaves out empty.
+     */
+    template <typename T>
+    Status decodeSymbolMap(ondemand::value& v, std::string_view member, SymbolMap<T>& out) {
+        if (!member.empty()) {
+            return forEachField(v, nullptr, [&](std::string_view key, ondemand::value& value) {
+                return key == member ? decodeSymbolMap(value, std::string_view(), out) : Status();
+            });
+        }
+        std::vector<typename SymbolMap<T>::value_type> entries;
+        Status status = forEachField(v, nullptr, [&](std::string_view symbol, ondemand::value& value) {
+            T decoded;
+            if (Status item_status = decode(value, decoded); !item_status.ok()) {
+                return item_status;
+            }
+            entries.emplace_back(std::string(symbol), std::move(decoded));
+            return Status();
+        });
+        if (status.ok()) {
+            out = SymbolMap<T>(std::move(entries));
+        }
+        return status;
+    }
+
+private:
+    /**
+     * @brief Record fatal errors; report whether the value was read successfully.
+     *
+     * Type and range mismatches are not fatal: RapidJSON's Is*() checks
+     * simply skip those members.
+     */
+    bool keep(error_code error) {
+        if (error == simdjson::SUCCESS) {
+            return true;
+        }
+        if (error != simdjson::INCORRECT_TYPE && error != simdjson::NUMBER_OUT_OF_RANGE &&
+            error != simdjson::BIGINT_ERROR) {
+            error_ = error;
+        }
+        return false;
+    }
+
+    template <typename T>
+    Status decodeIfObject(ondemand::value& v, T& out) {
+        ondemand::json_type type;
+        if (v.type().get(type) != simdjson::SUCCESS) {
+            return fail();
+        }
+        if (type != ondemand::json_type::object) {
+            return Status();
+        }
+        return decode(v, out);
+    }
+
+    template <typename T>
+    Status decodeSymbolArrays(ondemand::value& v, std::map<std::string, std::vector<T>>& out) {
+        return forEachField(v, nullptr, [&](std::string_view symbol, ondemand::value& value) {
+            std::vector<T> items;
+            ondemand::array array;
+            if (keep(value.get_array().get(array))) {
+                size_t count = 0;
+                if (array.count_elements().get(count) == simdjson::SUCCESS) {
+                    items.reserve(count);
+                }
+                for (auto element : array) {
+                    ondemand::value item;
+                    if (std::move(element).get(item) != simdjson::SUCCESS) {
+                        return fail();
+                    }
+                    T decoded;
+                    if (Status status = decode(item, decoded); !status.ok()) {
+                        return status;
+                    }
+                    items.push_back(std::move(decoded));
+                }
+            }
+            out[std::string(symbol)] = std::move(items);
+            return Status();
+        });
+    }
+
+    const char* parse_error_;
+    error_code error_ = simdjson::SUCCESS;
+};
+
+/**
+ * @brief Pad a string in place by growing its capacity, so it can be iterated without a copy.
+ */
+simdjson::padded_string_view padInPlace(std::string& json) {
+    json.reserve(json.size() + simdjson::SIMDJSON_PADDING);
+    return simdjson::padded_string_view(json.data(), json.size(), json.capacity());
+}
+
+/**
+ * @brief Iterate a padded document and hand its root value to decode_root.
+ */
+template <typename DecodeRoot>
+Status decodeDocument(simdjson::padded_string_view json, const char* parse_error, const char* type_error,
+                      DecodeRoot&& decode_root) {
+    // Parsers own sizeable internal buffers; keep one per thread and reuse it.
+    thread_local ondemand::parser parser;
+
+    ondemand::document doc;
+    if (parser.iterate(json).get(doc) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+
+    ondemand::json_type type;
+    if (doc.type().get(type) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+    if (type != ondemand::json_type::object) {
+        return Status(1, type_error);
+    }
+
+    ondemand::value root;
+    if (doc.get_value().get(root) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+
+    Decoder decoder(parse_error);
+    if (Status status = decode_root(decoder, root, type_error); !status.ok()) {
+        return status;
+    }
+
+    // RapidJSON rejects trailing content after the root value; so do we.
+    if (!doc.at_end()) {
+        return decoder.fail();
+    }
+    return Status();
+}
+
+/**
+ * @brief Decode a paginated "symbol -> [item, ...]" response into the given map member.
+ */
+template <typename T, typename Item>
+Status decodePageDocument(simdjson::padded_string_view json, T& out, std::map<std::string, std::vector<Item>> T::*member,
+                          std::string_view name, const char* parse_error, const char* type_error) {
+    return decodeDocument(json, parse_error, type_error,
+                          [&](Decoder& decoder, ondemand::value& root, const char* root_type_error) {
+                              return decoder.decodePage(root, root_type_error, name, out.*member,
+                                                        out.next_page_token);
+                          });
+}
+
+const char* kBarsTypeError = "Deserialized valid JSON but it wasn't a bars object";
+const char* kMultiTradesTypeError = "Deserialized valid JSON but it wasn't a multi trades object";
+const char* kMultiQuotesTypeError = "Deserialized valid JSON but it wasn't a multi quotes object";
+const char* kSnapshotsTypeError = "Deserialized valid JSON but it wasn't a snapshots object";
+const char* kCryptoTradesTypeError = "Deserialized valid JSON but it wasn't a crypto trades object";
+const char* kCryptoQuotesTypeError = "Deserialized valid JSON but it wasn't a crypto quotes object";
+const char* kCryptoBarsTypeError = "Deserialized valid JSON but it wasn't a crypto bars object";
+
+Status decodeSnapshotsDocument(simdjson::padded_string_view json, Snapshots& snapshots, const char* parse_error) {
+    return decodeDocument(json, parse_error, kSnapshotsTypeError,
+                          [&](Decoder& decoder, ondemand::value& root, const char*) {
+                              return decoder.decode(root, snapshots);
+                          });
+}
+
+/**
+ * @brief Decode a multi-symbol "latest" or snapshots response; a root which is not an object decodes as empty.
+ */
+template <typename T>
+Status decodeSymbolMapDocument(simdjson::padded_string_view json, std::string_view member, SymbolMap<T>& out,
+                               const char* parse_error) {
+    thread_local ondemand::parser parser;
+
+    ondemand::document doc;
+    if (parser.iterate(json).get(doc) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+
+    ondemand::json_type type;
+    if (doc.type().get(type) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+    if (type != ondemand::json_type::object) {
+        return Status();
+    }
+
+    ondemand::value root;
+    if (doc.get_value().get(root) != simdjson::SUCCESS) {
+        return Status(1, parse_error);
+    }
+
+    Decoder decoder(parse_error);
+    if (Status status = decoder.decodeSymbolMap(root, member, out); !status.ok()) {
+        return status;
+    }
+    if (!doc.at_end()) {
+        return decoder.fail();
+    }
+    return Status();
+}
+
+}  // namespace
+
+Status decodeJSON(const std::string& json, Bars& bars, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, bars, &Bars::bars, "bars", parse_error, kBarsTypeError);
+}
+
+Status decodeJSON(std::string& json, Bars& bars, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), bars, &Bars::bars, "bars", parse_error, kBarsTypeError);
+}
+
+Status decodeJSON(const std::string& json, MultiTrades& multi_trades, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, multi_trades, &MultiTrades::trades, "trades", parse_error, kMultiTradesTypeError);
+}
+
+Status decodeJSON(std::string& json, MultiTrades& multi_trades, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), multi_trades, &MultiTrades::trades, "trades", parse_error, kMultiTradesTypeError);
+}
+
+Status decodeJSON(const std::string& json, MultiQuotes& multi_quotes, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, multi_quotes, &MultiQuotes::quotes, "quotes", parse_error, kMultiQuotesTypeError);
+}
+
+Status decodeJSON(std::string& json, MultiQuotes& multi_quotes, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), multi_quotes, &MultiQuotes::quotes, "quotes", parse_error, kMultiQuotesTypeError);
+}
+
+Status decodeJSON(const std::string& json, Snapshots& snapshots, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodeSnapshotsDocument(padded, snapshots, parse_error);
+}
+
+Status decodeJSON(std::string& json, Snapshots& snapshots, const char* parse_error) {
+    return decodeSnapshotsDocument(padInPlace(json), snapshots, parse_error);
+}
+
+Status decodeJSON(const std::string& json, CryptoTrades& trades, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, trades, &CryptoTrades::trades, "trades", parse_error, kCryptoTradesTypeError);
+}
+
+Status decodeJSON(std::string& json, CryptoTrades& trades, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), trades, &CryptoTrades::trades, "trades", parse_error, kCryptoTradesTypeError);
+}
+
+Status decodeJSON(const std::string& json, CryptoQuotes& quotes, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, quotes, &CryptoQuotes::quotes, "quotes", parse_error, kCryptoQuotesTypeError);
+}
+
+Status decodeJSON(std::string& json, CryptoQuotes& quotes, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), quotes, &CryptoQuotes::quotes, "quotes", parse_error, kCryptoQuotesTypeError);
+}
+
+Status decodeJSON(const std::string& json, CryptoBars& bars, const char* parse_error) {
+    simdjson::padded_string padded(json);
+    return decodePageDocument(padded, bars, &CryptoBars::bars, "bars", parse_error, kCryptoBarsTypeError);
+}
+
+Status decodeJSON(std::string& json, CryptoBars& bars, const char* parse_error) {
+    return decodePageDocument(padInPlace(json), bars, &CryptoBars::bars, "bars", parse_error, kCryptoBarsTypeError);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Trade>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Quote>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Bar>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<Snapshot>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoTrade>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoQuote>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoBar>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+Status decodeSymbolMapJSON(std::string& json, std::string_view member, SymbolMap<CryptoSnapshot>& out,
+                           const char* parse_error) {
+    return decodeSymbolMapDocument(padInPlace(json), member, out, parse_error);
+}
+
+}  // namespace alpaca::markets::detail::simd
+
+#endif  // ALPACA_MARKETS_USE_SIMDJSON
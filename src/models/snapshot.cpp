@@ -1,101 +1,78 @@
 #include <alpaca/markets/snapshot.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/simdjson_decode.hpp"
 
 namespace alpaca::markets {
 
-Status Snapshot::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing snapshot JSON");
-    }
+namespace {
+const char* kSnapshotParseError = "Received parse error when deserializing snapshot JSON";
+const char* kSnapshotsParseError = "Received parse error when deserializing snapshots JSON";
+}  // namespace
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a snapshot object");
-    }
+namespace detail {
 
-    // Parse latest trade
-    if (d.HasMember("latestTrade") && d["latestTrade"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["latestTrade"].Accept(writer);
-        if (Status status = latest_trade.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
-    }
+namespace {
 
-    // Parse latest quote
-    if (d.HasMember("latestQuote") && d["latestQuote"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["latestQuote"].Accept(writer);
-        if (Status status = latest_quote.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
-    }
+constexpr auto kSnapshotFields = makeFieldTable<Snapshot>(
+    objectField<&Snapshot::latest_trade>("latestTrade"),
+    objectField<&Snapshot::latest_quote>("latestQuote"),
+    objectField<&Snapshot::minute_bar>("minuteBar"),
+    objectField<&Snapshot::daily_bar>("dailyBar"),
+    objectField<&Snapshot::prev_daily_bar>("prevDailyBar"));
 
-    // Parse minute bar
-    if (d.HasMember("minuteBar") && d["minuteBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["minuteBar"].Accept(writer);
-        if (Status status = minute_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
-    }
+// Snapshots are keyed by symbol
+constexpr auto kSnapshotsFields = makeFieldTable<Snapshots>(
+    symbolObjectsField<&Snapshots::snapshots>("snapshots"));
 
-    // Parse daily bar
-    if (d.HasMember("dailyBar") && d["dailyBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["dailyBar"].Accept(writer);
-        if (Status status = daily_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
-    }
+}  // namespace
 
-    // Parse previous daily bar
-    if (d.HasMember("prevDailyBar") && d["prevDailyBar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["prevDailyBar"].Accept(writer);
-        if (Status status = prev_daily_bar.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status decode(const rapidjson::Value& d, Snapshot& snapshot) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a snapshot object");
     }
+    return decodeFields(d, snapshot, kSnapshotFields);
+}
 
-    return Status();
+Status decode(const rapidjson::Value& d, Snapshots& snapshots) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a snapshots object");
+    }
+    return decodeFields(d, snapshots, kSnapshotsFields);
 }
 
-Status Snapshots::fromJSON(const std::string& json) {
+}  // namespace detail
+
+Status Snapshot::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing snapshots JSON");
+        return Status(1, kSnapshotParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a snapshots object");
-    }
+Status Snapshot::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kSnapshotParseError);
+}
 
-    // Parse snapshots - keyed by symbol
-    if (d.HasMember("snapshots") && d["snapshots"].IsObject()) {
-        for (auto& m : d["snapshots"].GetObject()) {
-            std::string symbol = m.name.GetString();
-            Snapshot snapshot;
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = snapshot.fromJSON(s.GetString()); !status.ok()) {
-                return status;
-            }
-            snapshots[symbol] = snapshot;
-        }
+Status Snapshots::fromJSON(const std::string& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kSnapshotsParseError);
+#else
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kSnapshotsParseError);
     }
+    return detail::decode(d, *this);
+#endif
+}
 
-    return Status();
+Status Snapshots::fromJSON(std::string&& json) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeJSON(json, *this, kSnapshotsParseError);
+#else
+    return detail::decodeInsitu(json, *this, kSnapshotsParseError);
+#endif
 }
 
 }  // namespace alpaca::markets
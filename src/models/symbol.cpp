@@ -0,0 +1,57 @@
+#include <alpaca/markets/symbol.hpp>
+
+#include <mutex>
+
+namespace alpaca::markets {
+
+SymbolTable& SymbolTable::global() {
+    static SymbolTable table;
+    return table;
+}
+
+SymbolId SymbolTable::intern(std::string_view symbol) {
+    {
+        std::shared_lock lock(mutex_);
+        if (auto it = ids_.find(symbol); it != ids_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock lock(mutex_);
+    // Another thread may have interned the symbol between the two locks
+    if (auto it = ids_.find(symbol); it != ids_.end()) {
+        return it->second;
+    }
+    auto id = static_cast<SymbolId>(names_.size());
+    const std::string& name = names_.emplace_back(symbol);
+    ids_.emplace(name, id);
+    return id;
+}
+
+SymbolId SymbolTable::find(std::string_view symbol) const {
+    std::shared_lock lock(mutex_);
+    auto it = ids_.find(symbol);
+    return it == ids_.end() ? kInvalidSymbolId : it->second;
+}
+
+std::string_view SymbolTable::name(SymbolId id) const {
+    std::shared_lock lock(mutex_);
+    if (id >= names_.size()) {
+        return {};
+    }
+    return names_[id];
+}
+
+std::size_t SymbolTable::size() const {
+    std::shared_lock lock(mutex_);
+    return names_.size();
+}
+
+SymbolId internSymbol(std::string_view symbol) {
+    return SymbolTable::global().intern(symbol);
+}
+
+std::string_view symbolName(SymbolId id) {
+    return SymbolTable::global().name(id);
+}
+
+}  // namespace alpaca::markets
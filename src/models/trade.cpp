@@ -1,58 +1,73 @@
 #include <alpaca/markets/trade.hpp>
 
-#include <rapidjson/stringbuffer.h>
-#include <rapidjson/writer.h>
-
-#include "../detail/json.hpp"
+#include "../detail/decode.hpp"
 
 namespace alpaca::markets {
 
-Status Trade::fromJSON(const std::string& json) {
-    rapidjson::Document d;
-    if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing trade JSON");
-    }
+namespace {
+const char* kTradeParseError = "Received parse error when deserializing trade JSON";
+const char* kLatestTradeParseError = "Received parse error when deserializing latest trade JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
 
+// Market Data API v2 field names
+constexpr auto kTradeFields = makeFieldTable<Trade>(
+    field("p", &Trade::price),       // price
+    field("s", &Trade::size),        // size
+    field("x", &Trade::exchange),    // exchange
+    field("i", &Trade::id),          // trade ID
+    field("t", &Trade::timestamp),   // timestamp
+    field("c", &Trade::conditions),  // conditions
+    field("z", &Trade::tape));       // tape
+
+// v2 API: trade is under "trade" key
+constexpr auto kLatestTradeFields = makeFieldTable<LatestTrade>(
+    field("symbol", &LatestTrade::symbol),
+    objectField<&LatestTrade::trade>("trade"));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, Trade& trade) {
     if (!d.IsObject()) {
         return Status(1, "Deserialized valid JSON but it wasn't a trade object");
     }
+    return decodeFields(d, trade, kTradeFields);
+}
 
-    // Market Data API v2 field names
-    PARSE_DOUBLE(price, "p")           // price
-    PARSE_UINT64(size, "s")            // size
-    PARSE_STRING(exchange, "x")        // exchange
-    PARSE_UINT64(id, "i")              // trade ID
-    PARSE_STRING(timestamp, "t")       // timestamp
-    PARSE_VECTOR_STRINGS(conditions, "c")  // conditions
-    PARSE_STRING(tape, "z")            // tape
-
-    return Status();
+Status decode(const rapidjson::Value& d, LatestTrade& latest_trade) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a latest trade object");
+    }
+    return decodeFields(d, latest_trade, kLatestTradeFields);
 }
 
-Status LatestTrade::fromJSON(const std::string& json) {
+}  // namespace detail
+
+Status Trade::fromJSON(const std::string& json) {
     rapidjson::Document d;
     if (d.Parse(json.c_str()).HasParseError()) {
-        return Status(1, "Received parse error when deserializing latest trade JSON");
+        return Status(1, kTradeParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    if (!d.IsObject()) {
-        return Status(1, "Deserialized valid JSON but it wasn't a latest trade object");
-    }
+Status Trade::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kTradeParseError);
+}
 
-    PARSE_STRING(symbol, "symbol")
-
-    // v2 API: trade is under "trade" key
-    if (d.HasMember("trade") && d["trade"].IsObject()) {
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["trade"].Accept(writer);
-        if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-            return status;
-        }
+Status LatestTrade::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kLatestTradeParseError);
     }
+    return detail::decode(d, *this);
+}
 
-    return Status();
+Status LatestTrade::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kLatestTradeParseError);
 }
 
 }  // namespace alpaca::markets
@@ -0,0 +1,47 @@
+#include <alpaca/markets/trade_update.hpp>
+
+#include "../detail/decode.hpp"
+
+namespace alpaca::markets {
+
+namespace {
+const char* kTradeUpdateParseError = "Received parse error when deserializing trade update JSON";
+}  // namespace
+
+namespace detail {
+
+namespace {
+
+constexpr auto kTradeUpdateFields = makeFieldTable<TradeUpdate>(
+    field("event", &TradeUpdate::event),
+    field("execution_id", &TradeUpdate::execution_id),
+    objectField<&TradeUpdate::order>("order"),
+    field("position_qty", &TradeUpdate::position_qty),
+    field("price", &TradeUpdate::price),
+    field("qty", &TradeUpdate::qty),
+    field("timestamp", &TradeUpdate::timestamp));
+
+}  // namespace
+
+Status decode(const rapidjson::Value& d, TradeUpdate& update) {
+    if (!d.IsObject()) {
+        return Status(1, "Deserialized valid JSON but it wasn't a trade update object");
+    }
+    return decodeFields(d, update, kTradeUpdateFields);
+}
+
+}  // namespace detail
+
+Status TradeUpdate::fromJSON(const std::string& json) {
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        return Status(1, kTradeUpdateParseError);
+    }
+    return detail::decode(d, *this);
+}
+
+Status TradeUpdate::fromJSON(std::string&& json) {
+    return detail::decodeInsitu(json, *this, kTradeUpdateParseError);
+}
+
+}  // namespace alpaca::markets
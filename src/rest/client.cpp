@@ -5,23 +5,134 @@
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <optional>
 #include <sstream>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
 #include <utility>
 
+#include "../detail/chunks.hpp"
+#include "../detail/decode.hpp"
+#include "../detail/order_submit.hpp"
+#include "../detail/rate_limiter.hpp"
+#include "../detail/simdjson_decode.hpp"
+
 namespace alpaca::markets {
 
+namespace detail {
+
+/**
+ * @brief The outcome of one coalesced GET, shared by every caller that asked for it while it was in flight.
+ */
+struct SharedResponse {
+    httplib::Error error = httplib::Error::Success;
+    std::optional<httplib::Response> response;  // Empty if the request got no response
+};
+
+}  // namespace detail
+
 namespace {
 const char* kJSONContentType = "application/json";
 
-httplib::Headers makeHeaders(const Environment& environment) {
+/**
+ * @brief The Accept-Encoding for a request to host: the encodings httplib was built to decode, or "identity".
+ */
+const char* acceptEncoding(const std::string& host, const Environment& environment) {
+    const CompressionConfig& config = environment.getCompressionConfig();
+    if (!(host == environment.getDataOrigin() ? config.data_api : config.trading_api)) {
+        return "identity";
+    }
+#if defined(CPPHTTPLIB_BROTLI_SUPPORT) && defined(CPPHTTPLIB_ZLIB_SUPPORT)
+    return "br, gzip, deflate";
+#elif defined(CPPHTTPLIB_BROTLI_SUPPORT)
+    return "br";
+#elif defined(CPPHTTPLIB_ZLIB_SUPPORT)
+    return "gzip, deflate";
+#else
+    return "identity";
+#endif
+}
+
+/**
+ * @brief Headers for a request to host: authentication plus content negotiation.
+ *
+ * Accept-Encoding is always set, since httplib adds its own to any request without one when it is built with
+ * compression support, and that would ignore the CompressionConfig.
+ */
+httplib::Headers makeRequestHeaders(const std::string& host, const Environment& environment) {
     return {
         {"APCA-API-KEY-ID", environment.getAPIKeyID()},
         {"APCA-API-SECRET-KEY", environment.getAPISecretKey()},
+        {"Accept-Encoding", acceptEncoding(host, environment)},
     };
 }
 
+/**
+ * @brief Headers for a request to the trading host.
+ */
+httplib::Headers makeHeaders(const Environment& environment) {
+    return makeRequestHeaders(environment.getTradingOrigin(), environment);
+}
+
+/**
+ * @brief Apply the Environment's TimeoutConfig to a connection.
+ */
+void applyTimeouts(httplib::Client& client, const Environment& environment) {
+    const TimeoutConfig& timeouts = environment.getTimeoutConfig();
+    client.set_connection_timeout(timeouts.connection_timeout);
+    client.set_read_timeout(timeouts.read_timeout);
+    client.set_write_timeout(timeouts.write_timeout);
+}
+
+/**
+ * @brief Send a GET request. When `flights` is set, identical requests already in flight share its response.
+ *
+ * Requests are identical when their host, path and extra_headers match. Every caller receives its own copy
+ * of the shared response, status, headers and error alike, since callers decode the body in place.
+ */
+httplib::Result sendGet(const std::string& host, const std::string& path, const Environment& environment,
+                        SingleFlight<std::shared_ptr<const detail::SharedResponse>>* flights,
+                        const httplib::Headers& extra_headers = {}) {
+    auto get = [&] {
+        httplib::Client client(host);
+        applyTimeouts(client, environment);
+        httplib::Headers headers = makeRequestHeaders(host, environment);
+        headers.insert(extra_headers.begin(), extra_headers.end());
+        return client.Get(path, headers);
+    };
+    if (flights == nullptr) {
+        return get();
+    }
+
+    std::string key = host + path;
+    for (const auto& [name, value] : extra_headers) {
+        key += "\n" + name + ": " + value;
+    }
+    std::shared_ptr<const detail::SharedResponse> shared = flights->run(key, [&] {
+        httplib::Result resp = get();
+        auto result = std::make_shared<detail::SharedResponse>();
+        result->error = resp.error();
+        if (resp) {
+            result->response = std::move(*resp);
+        }
+        return std::shared_ptr<const detail::SharedResponse>(std::move(result));
+    });
+    if (!shared->response) {
+        return httplib::Result(nullptr, shared->error);
+    }
+    return httplib::Result(std::make_unique<httplib::Response>(*shared->response), shared->error);
+}
+
 /**
  * @brief Parse an API error from a non-200 HTTP response.
  * 
@@ -58,6 +169,272 @@ Status makeErrorStatus(const std::string& endpoint, int status_code, const std::
     ss << "Call to " << endpoint << " failed: " << err.what();
     return Status(1, ss.str());
 }
+
+/**
+ * @brief Parse an optional decimal order field ("" reads as 0) passed to the string-based submit calls.
+ */
+Status parseOrderDecimal(const std::string& value, const char* name, Decimal& out) {
+    if (value.empty()) {
+        out = Decimal();
+        return Status();
+    }
+    std::optional<Decimal> parsed = Decimal::parse(value);
+    if (!parsed) {
+        return Status(1, std::string("Invalid order ") + name + ": " + value);
+    }
+    out = *parsed;
+    return Status();
+}
+
+/**
+ * @brief The numeric view of request that pre-trade checks are asked about.
+ */
+OrderIntent makeOrderIntent(const OrderRequest& request) {
+    return OrderIntent{request.symbol,
+                       request.side,
+                       request.type,
+                       request.qty.toDouble(),
+                       request.notional.toDouble(),
+                       request.limit_price.toDouble(),
+                       request.stop_price.toDouble()};
+}
+
+/**
+ * @brief Run the pre-trade check (if any) and validation on one order of a batch, returning the first failure.
+ *
+ * The check sees the orders of the batch accepted so far in OrderIntent::batch; if request passes, it is
+ * appended to them.
+ */
+Status checkOrderRequest(const std::function<Status(const OrderIntent&)>& pre_trade_check,
+                         const OrderRequest& request, std::vector<OrderIntent>& accepted) {
+    OrderIntent intent = makeOrderIntent(request);
+    if (pre_trade_check) {
+        intent.batch = &accepted;
+        if (Status status = pre_trade_check(intent); !status.ok()) {
+            return status;
+        }
+        intent.batch = nullptr;
+    }
+    if (Status status = request.validate(); !status.ok()) {
+        return status;
+    }
+    accepted.push_back(std::move(intent));
+    return Status();
+}
+
+/**
+ * @brief Run send(client, buffer, i, http_status) for every index in pending, storing its result in
+ * batch.results[i] and the HTTP status it reports in batch.http_statuses[i].
+ *
+ * Up to BatchConfig::max_concurrency workers each open one keep-alive connection to the trading host and pull
+ * the next pending index until none are left. Each worker passes send the same scratch buffer for every
+ * request, so bodies and URLs can be built without allocating per request. Fills in the batch's counts and
+ * elapsed time.
+ */
+template <typename Send>
+void runOrderBatch(const Environment& environment, const std::vector<std::size_t>& pending, OrderBatchResult& batch,
+                   Send send) {
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<std::size_t> next{0};
+    std::size_t concurrency =
+        std::min(std::max<std::size_t>(environment.getBatchConfig().max_concurrency, 1), pending.size());
+    batch.http_statuses.assign(batch.results.size(), 0);
+    if (concurrency > 0) {
+        std::vector<char> done(pending.size(), 0);
+        Status error = detail::runWorkers(concurrency, [&] {
+            httplib::Client client(environment.getTradingOrigin());
+            detail::configureOrderClient(client, environment);
+            std::string buffer;
+            for (std::size_t i = next++; i < pending.size(); i = next++) {
+                batch.results[pending[i]] = send(client, buffer, pending[i], batch.http_statuses[pending[i]]);
+                done[i] = 1;
+            }
+        });
+        // A worker that threw left the request it was sending without a result
+        for (std::size_t i = 0; i < pending.size() && !error.ok(); ++i) {
+            if (!done[i]) {
+                batch.results[pending[i]].first = error;
+            }
+        }
+    }
+    batch.elapsed = std::chrono::steady_clock::now() - start;
+
+    for (const auto& [status, order] : batch.results) {
+        ++(status.ok() ? batch.succeeded : batch.failed);
+    }
+}
+
+/**
+ * @brief Decode a multi-symbol "latest" or snapshots response body with the configured JSON backend.
+ *
+ * member names the object holding the symbol map, or is empty when the symbols are keys of the root object.
+ * The body is parsed in place.
+ */
+template <typename T>
+Status decodeSymbolMapBody(std::string& body, std::string_view member, SymbolMap<T>& out, const char* parse_error) {
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+    return detail::simd::decodeSymbolMapJSON(body, member, out, parse_error);
+#else
+    rapidjson::Document d;
+    if (d.ParseInsitu(body.data()).HasParseError()) {
+        return Status(1, parse_error);
+    }
+    if (!d.IsObject()) {
+        return Status();
+    }
+    if (member.empty()) {
+        return detail::decodeSymbolMap(d, out);
+    }
+    auto it = d.FindMember(rapidjson::StringRef(member.data(), member.size()));
+    return it == d.MemberEnd() ? Status() : detail::decodeSymbolMap(it->value, out);
+#endif
+}
+
+/**
+ * @brief The URL of one page of a symbol's historical trades or quotes (kind is "trades" or "quotes").
+ */
+std::string historyUrl(const std::string& symbol, const char* kind, const std::string& start, const std::string& end,
+                       unsigned int limit, const std::string& page_token) {
+    httplib::Params params;
+    if (!start.empty()) {
+        params.insert({"start", start});
+    }
+    if (!end.empty()) {
+        params.insert({"end", end});
+    }
+    if (limit > 0) {
+        params.insert({"limit", std::to_string(limit)});
+    }
+    if (!page_token.empty()) {
+        params.insert({"page_token", page_token});
+    }
+
+    std::string query_string = httplib::detail::params_to_query_str(params);
+    std::string url = "/v2/stocks/" + symbol + "/" + kind;
+    if (!query_string.empty()) {
+        url += "?" + query_string;
+    }
+    return url;
+}
+
+/**
+ * @brief Decode the response to historyUrl(), appending the items of the page to items.
+ */
+template <typename T>
+Status decodeHistoryPage(const std::string& url, httplib::Result& resp, const char* kind, std::vector<T>& items,
+                         std::string& next_page_token) {
+    if (!resp) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an empty response";
+        return Status(1, ss.str());
+    }
+
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
+        return Status(1, ss.str());
+    }
+
+    rapidjson::Document d;
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
+        return Status(1, std::string("Received parse error when deserializing ") + kind + " JSON");
+    }
+
+    if (d.HasMember(kind) && d[kind].IsArray()) {
+        for (auto& o : d[kind].GetArray()) {
+            T item;
+            if (Status status = detail::decode(o, item); !status.ok()) {
+                return status;
+            }
+            items.push_back(std::move(item));
+        }
+    }
+
+    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
+        next_page_token = d["next_page_token"].GetString();
+    }
+    return Status();
+}
+
+/**
+ * @brief The URL of one page of bars for symbols.
+ */
+std::string barsUrl(const std::vector<std::string>& symbols, const std::string& start, const std::string& end,
+                    const std::string& timeframe, unsigned int limit, const std::string& page_token) {
+    std::string symbols_string;
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        symbols_string += symbols[i];
+        if (i < symbols.size() - 1) {
+            symbols_string += ",";
+        }
+    }
+
+    httplib::Params params{
+        {"symbols", symbols_string},
+        {"timeframe", timeframe},
+        {"limit", std::to_string(limit)},
+    };
+    if (!start.empty()) {
+        params.insert({"start", start});
+    }
+    if (!end.empty()) {
+        params.insert({"end", end});
+    }
+    if (!page_token.empty()) {
+        params.insert({"page_token", page_token});
+    }
+    std::string query_string = httplib::detail::params_to_query_str(params);
+
+    // Market Data API v2 endpoint
+    return "/v2/stocks/bars?" + query_string;
+}
+
+/**
+ * @brief Decode the response to barsUrl().
+ */
+Status decodeBarsPage(const std::string& url, httplib::Result& resp, Bars& bars) {
+    if (!resp) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an empty response";
+        return Status(1, ss.str());
+    }
+
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
+        return Status(1, ss.str());
+    }
+
+    return bars.fromJSON(std::move(resp->body));
+}
+
+/**
+ * @brief Page through ranges with detail::downloadRangePages, each worker on one keep-alive connection to the data host.
+ *
+ * fetch(client, headers, range, page_token, items, next_page_token) requests one page of range over the
+ * worker's connection and appends its items.
+ */
+template <typename T, typename Fetch>
+std::pair<Status, std::vector<T>> downloadHistory(const Environment& environment, const std::vector<TimeRange>& ranges,
+                                                  const ParallelDownloadConfig& config, Fetch fetch) {
+    std::vector<std::vector<T>> results(ranges.size());
+    Status status = detail::downloadRangePages(ranges.size(), config, [&] {
+        auto client = std::make_shared<httplib::Client>(environment.getDataOrigin());
+        client->set_keep_alive(true);
+        applyTimeouts(*client, environment);
+        auto headers = std::make_shared<httplib::Headers>(makeRequestHeaders(environment.getDataOrigin(), environment));
+        return detail::RangePageFetch([&, client, headers](std::size_t i, const std::string& page_token) {
+            std::string next_page_token;
+            Status page_status = fetch(*client, *headers, ranges[i], page_token, results[i], next_page_token);
+            return std::make_pair(page_status, std::move(next_page_token));
+        });
+    });
+    if (!status.ok()) {
+        return std::make_pair(status, std::vector<T>());
+    }
+    return std::make_pair(Status(), detail::concatRanges(results));
+}
+
 }  // namespace
 
 Client::Client(Environment& environment) {
@@ -67,6 +444,78 @@ Client::Client(Environment& environment) {
         }
     }
     environment_ = environment;
+    if (environment_.getRequestCoalescing()) {
+        in_flight_ = std::make_shared<SingleFlight<std::shared_ptr<const detail::SharedResponse>>>();
+    }
+    if (environment_.getCacheConfig().enabled) {
+        cache_ = std::make_shared<ResponseCache>(environment_.getCacheConfig().max_entries);
+    }
+    if (std::size_t per_minute = environment_.getBatchConfig().max_requests_per_minute; per_minute > 0) {
+        order_limiter_ = std::make_shared<detail::RateLimiter>(per_minute, std::chrono::minutes(1));
+    }
+}
+
+template <typename T, typename Decode>
+std::pair<Status, T> Client::cachedGet(std::chrono::milliseconds ttl, const std::string& host, const std::string& path,
+                                       Decode decode) const {
+    ResponseCache::Lookup<T> cached;
+    std::string key = host + path;
+    bool use_cache = cache_ && ttl.count() > 0;
+    httplib::Headers revalidate;
+    if (use_cache) {
+        cached = cache_->lookup<T>(key);
+        if (cached.fresh) {
+            return std::make_pair(Status(), *cached.value);
+        }
+        if (cached.value && !cached.etag.empty() && environment_.getCacheConfig().revalidate) {
+            revalidate.emplace("If-None-Match", cached.etag);
+        }
+    }
+    httplib::Result resp = sendGet(host, path, environment_, in_flight_.get(), revalidate);
+
+    if (!resp) {
+        std::ostringstream ss;
+        ss << "Call to " << path << " returned an empty response";
+        return std::make_pair(Status(1, ss.str()), T());
+    }
+
+    if (use_cache && resp->status == 304 && cached.value) {
+        cache_->renew(key, ttl);
+        return std::make_pair(Status(), *cached.value);
+    }
+
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to " << path << " returned an HTTP " << resp->status << ": " << resp->body;
+        return std::make_pair(Status(1, ss.str()), T());
+    }
+
+    std::string etag = resp->get_header_value("ETag");
+    std::pair<Status, T> result = decode(resp->body);
+    if (use_cache && result.first.ok()) {
+        cache_->store(key, result.second, ttl, std::move(etag));
+    }
+    return result;
+}
+
+void Client::setPreTradeCheck(std::function<Status(const OrderIntent&)> check) {
+    pre_trade_check_ = std::move(check);
+}
+
+void Client::setOrderCache(const OrderCache* cache) {
+    order_cache_ = cache;
+}
+
+void Client::invalidateCache(const std::string& path_prefix) const {
+    if (!cache_) {
+        return;
+    }
+    if (path_prefix.empty()) {
+        cache_->invalidate();
+        return;
+    }
+    cache_->invalidate(environment_.getTradingOrigin() + path_prefix);
+    cache_->invalidate(environment_.getDataOrigin() + path_prefix);
 }
 
 // ==================== Account ====================
@@ -74,8 +523,7 @@ Client::Client(Environment& environment) {
 std::pair<Status, Account> Client::getAccount() const {
     Account account;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get("/v2/account", makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), "/v2/account", environment_, in_flight_.get());
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/account returned an empty response"), account);
     }
@@ -84,14 +532,14 @@ std::pair<Status, Account> Client::getAccount() const {
         return std::make_pair(makeErrorStatus("/v2/account", resp->status, resp->body), account);
     }
 
-    return std::make_pair(account.fromJSON(resp->body), account);
+    return std::make_pair(account.fromJSON(std::move(resp->body)), account);
 }
 
 std::pair<Status, AccountConfigurations> Client::getAccountConfigurations() const {
     AccountConfigurations account_configurations;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get("/v2/account/configurations", makeHeaders(environment_));
+    httplib::Result resp =
+        sendGet(environment_.getTradingOrigin(), "/v2/account/configurations", environment_, in_flight_.get());
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/account/configurations returned an empty response"),
                               account_configurations);
@@ -103,7 +551,7 @@ std::pair<Status, AccountConfigurations> Client::getAccountConfigurations() cons
         return std::make_pair(Status(1, ss.str()), account_configurations);
     }
 
-    return std::make_pair(account_configurations.fromJSON(resp->body), account_configurations);
+    return std::make_pair(account_configurations.fromJSON(std::move(resp->body)), account_configurations);
 }
 
 std::pair<Status, AccountConfigurations> Client::updateAccountConfigurations(bool no_shorting,
@@ -112,27 +560,14 @@ std::pair<Status, AccountConfigurations> Client::updateAccountConfigurations(boo
                                                                              bool suspend_trade) const {
     AccountConfigurations account_configurations;
 
-    rapidjson::StringBuffer s;
-    s.Clear();
-    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-    writer.StartObject();
-
-    writer.Key("no_shorting");
-    writer.Bool(no_shorting);
-
-    writer.Key("dtbp_check");
-    writer.String(dtbp_check.c_str());
-
-    writer.Key("trade_confirm_email");
-    writer.String(trade_confirm_email.c_str());
+    AccountConfigurations requested;
+    requested.no_shorting = no_shorting;
+    requested.dtbp_check = dtbp_check;
+    requested.trade_confirm_email = trade_confirm_email;
+    requested.suspend_trade = suspend_trade;
+    std::string body = detail::encodeJSON(requested);
 
-    writer.Key("suspend_trade");
-    writer.Bool(suspend_trade);
-
-    writer.EndObject();
-    const char* body = s.GetString();
-
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Patch("/v2/account/configurations", makeHeaders(environment_), body, kJSONContentType);
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/account/configurations returned an empty response"),
@@ -145,7 +580,7 @@ std::pair<Status, AccountConfigurations> Client::updateAccountConfigurations(boo
         return std::make_pair(Status(1, ss.str()), account_configurations);
     }
 
-    return std::make_pair(account_configurations.fromJSON(resp->body), account_configurations);
+    return std::make_pair(account_configurations.fromJSON(std::move(resp->body)), account_configurations);
 }
 
 std::pair<Status, std::vector<std::variant<TradeActivity, NonTradeActivity>>> Client::getAccountActivity(
@@ -163,8 +598,7 @@ std::pair<Status, std::vector<std::variant<TradeActivity, NonTradeActivity>>> Cl
         url += "?activity_types=" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -178,7 +612,7 @@ std::pair<Status, std::vector<std::variant<TradeActivity, NonTradeActivity>>> Cl
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing activities JSON"), activities);
     }
     for (auto& a : d.GetArray()) {
@@ -189,23 +623,18 @@ std::pair<Status, std::vector<std::variant<TradeActivity, NonTradeActivity>>> Cl
             return std::make_pair(Status(1, "Activity didn't have activity_type attribute"), activities);
         }
 
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        a.Accept(writer);
-
         if (activity_type == "FILL") {
             TradeActivity activity;
-            if (Status status = activity.fromJSON(s.GetString()); !status.ok()) {
+            if (Status status = detail::decode(a, activity); !status.ok()) {
                 return std::make_pair(status, activities);
             }
-            activities.push_back(activity);
+            activities.push_back(std::move(activity));
         } else {
             NonTradeActivity activity;
-            if (Status status = activity.fromJSON(s.GetString()); !status.ok()) {
+            if (Status status = detail::decode(a, activity); !status.ok()) {
                 return std::make_pair(status, activities);
             }
-            activities.push_back(activity);
+            activities.push_back(std::move(activity));
         }
     }
 
@@ -222,8 +651,7 @@ std::pair<Status, Order> Client::getOrder(const std::string& id, bool nested) co
         url += "?nested=true";
     }
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -236,7 +664,7 @@ std::pair<Status, Order> Client::getOrder(const std::string& id, bool nested) co
         return std::make_pair(Status(1, ss.str()), order);
     }
 
-    return std::make_pair(order.fromJSON(resp->body), order);
+    return std::make_pair(order.fromJSON(std::move(resp->body)), order);
 }
 
 std::pair<Status, Order> Client::getOrderByClientOrderID(const std::string& client_order_id) const {
@@ -244,8 +672,7 @@ std::pair<Status, Order> Client::getOrderByClientOrderID(const std::string& clie
 
     std::string url = "/v2/orders:by_client_order_id?client_order_id=" + client_order_id;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -258,14 +685,13 @@ std::pair<Status, Order> Client::getOrderByClientOrderID(const std::string& clie
         return std::make_pair(Status(1, ss.str()), order);
     }
 
-    return std::make_pair(order.fromJSON(resp->body), order);
+    return std::make_pair(order.fromJSON(std::move(resp->body)), order);
 }
 
-std::pair<Status, std::vector<Order>> Client::getOrders(ActionStatus status, int limit, const std::string& after,
-                                                        const std::string& until, OrderDirection direction,
-                                                        bool nested) const {
-    std::vector<Order> orders;
+namespace {
 
+std::string makeOrdersUrl(ActionStatus status, int limit, const std::string& after, const std::string& until,
+                          OrderDirection direction, bool nested) {
     httplib::Params params{
         {"status", actionStatusToString(status)},
         {"limit", std::to_string(limit)},
@@ -280,10 +706,75 @@ std::pair<Status, std::vector<Order>> Client::getOrders(ActionStatus status, int
     if (nested) {
         params.insert({"nested", "true"});
     }
-    std::string query_string = httplib::detail::params_to_query_str(params);
-    httplib::SSLClient client(environment_.getTradingHost());
-    std::string url = "/v2/orders?" + query_string;
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    return "/v2/orders?" + httplib::detail::params_to_query_str(params);
+}
+
+/**
+ * @brief Format nanoseconds since the Unix epoch as an RFC 3339 UTC timestamp with nine fractional digits.
+ */
+std::string formatTimestampNanos(std::int64_t nanos) {
+    using namespace std::chrono;
+    sys_time<nanoseconds> time{nanoseconds(nanos)};
+    sys_days day = floor<days>(time);
+    year_month_day date(day);
+    hh_mm_ss<nanoseconds> clock(time - day);
+    char out[40];
+    std::snprintf(out, sizeof(out), "%04d-%02u-%02uT%02d:%02d:%02d.%09lldZ", static_cast<int>(date.year()),
+                  static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+                  static_cast<int>(clock.hours().count()), static_cast<int>(clock.minutes().count()),
+                  static_cast<int>(clock.seconds().count()), static_cast<long long>(clock.subseconds().count()));
+    return out;
+}
+
+/**
+ * @brief The ids of every open order, paging through GET /v2/orders oldest first.
+ *
+ * `after` is exclusive, so each page starts 1 ns before the last submission time seen, keeping orders that
+ * share it; the ones seen already are dropped by id.
+ */
+std::pair<Status, std::vector<std::string>> listOpenOrderIds(const Client& client) {
+    constexpr int kPageSize = 500;  // The most GET /v2/orders returns at once
+    std::vector<std::string> ids;
+    std::unordered_set<std::string> seen;
+    std::string after;
+    while (true) {
+        auto [status, page] = client.getOrders(ActionStatus::Open, kPageSize, after, "", OrderDirection::Ascending);
+        if (!status.ok()) {
+            return std::make_pair(status, ids);
+        }
+        std::optional<std::int64_t> last;
+        bool progressed = false;
+        for (auto& order : page) {
+            const std::string& submitted = order.submitted_at.empty() ? order.created_at : order.submitted_at;
+            if (std::optional<std::int64_t> at = parseTimestampNanos(submitted); at && (!last || *at > *last)) {
+                last = at;
+            }
+            if (seen.insert(order.id).second) {
+                ids.push_back(std::move(order.id));
+                progressed = true;
+            }
+        }
+        if (page.size() < static_cast<std::size_t>(kPageSize)) {
+            return std::make_pair(Status(), ids);
+        }
+        if (!last || !progressed) {
+            return std::make_pair(
+                Status(1, "Could not page through open orders: a full page had no new orders or no timestamps"),
+                ids);
+        }
+        after = formatTimestampNanos(*last - 1);
+    }
+}
+
+}  // namespace
+
+std::pair<Status, std::vector<Order>> Client::getOrders(ActionStatus status, int limit, const std::string& after,
+                                                        const std::string& until, OrderDirection direction,
+                                                        bool nested) const {
+    std::vector<Order> orders;
+
+    std::string url = makeOrdersUrl(status, limit, after, until, direction, nested);
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -297,24 +788,44 @@ std::pair<Status, std::vector<Order>> Client::getOrders(ActionStatus status, int
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing orders JSON"), orders);
     }
     for (auto& o : d.GetArray()) {
         Order order;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status parse_status = order.fromJSON(s.GetString()); !parse_status.ok()) {
+        if (Status parse_status = detail::decode(o, order); !parse_status.ok()) {
             return std::make_pair(parse_status, orders);
         }
-        orders.push_back(order);
+        orders.push_back(std::move(order));
     }
 
     return std::make_pair(Status(), orders);
 }
 
+std::pair<Status, std::vector<CompactOrder>> Client::getCompactOrders(ActionStatus status, int limit,
+                                                                      const std::string& after,
+                                                                      const std::string& until,
+                                                                      OrderDirection direction) const {
+    CompactOrders orders;
+
+    std::string url = makeOrdersUrl(status, limit, after, until, direction, false);
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
+    if (!resp) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an empty response";
+        return std::make_pair(Status(1, ss.str()), std::move(orders.orders));
+    }
+
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
+        return std::make_pair(Status(1, ss.str()), std::move(orders.orders));
+    }
+
+    Status parse_status = orders.fromJSON(std::move(resp->body));
+    return std::make_pair(parse_status, std::move(orders.orders));
+}
+
 std::pair<Status, Order> Client::submitOrder(const std::string& symbol, int quantity, OrderSide side, OrderType type,
                                              OrderTimeInForce tif, const std::string& limit_price,
                                              const std::string& stop_price, bool extended_hours,
@@ -323,169 +834,130 @@ std::pair<Status, Order> Client::submitOrder(const std::string& symbol, int quan
                                              StopLossParams* stop_loss_params,
                                              const std::string& trail_price,
                                              const std::string& trail_percent) const {
-    Order order;
-
-    rapidjson::StringBuffer s;
-    s.Clear();
-    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-    writer.StartObject();
-
-    writer.Key("symbol");
-    writer.String(symbol.c_str());
-
-    writer.Key("qty");
-    writer.Int(quantity);
-
-    writer.Key("side");
-    writer.String(orderSideToString(side).c_str());
-
-    writer.Key("type");
-    writer.String(orderTypeToString(type).c_str());
-
-    writer.Key("time_in_force");
-    writer.String(orderTimeInForceToString(tif).c_str());
-
-    if (!limit_price.empty()) {
-        writer.Key("limit_price");
-        writer.String(limit_price.c_str());
+    OrderRequest request = OrderRequest::market(symbol, quantity, side);
+    request.type = type;
+    request.tif = tif;
+    request.extended_hours = extended_hours;
+    request.client_order_id = client_order_id;
+    request.order_class = order_class;
+    Status status;
+    if (status = parseOrderDecimal(limit_price, "limit_price", request.limit_price); !status.ok()) {
+        return std::make_pair(status, Order());
     }
-
-    if (!stop_price.empty()) {
-        writer.Key("stop_price");
-        writer.String(stop_price.c_str());
-    }
-
-    // Trailing stop parameters
-    if (!trail_price.empty()) {
-        writer.Key("trail_price");
-        writer.String(trail_price.c_str());
-    }
-
-    if (!trail_percent.empty()) {
-        writer.Key("trail_percent");
-        writer.String(trail_percent.c_str());
-    }
-
-    if (extended_hours) {
-        writer.Key("extended_hours");
-        writer.Bool(extended_hours);
+    if (status = parseOrderDecimal(stop_price, "stop_price", request.stop_price); !status.ok()) {
+        return std::make_pair(status, Order());
     }
-
-    if (!client_order_id.empty()) {
-        writer.Key("client_order_id");
-        writer.String(client_order_id.c_str());
+    if (status = parseOrderDecimal(trail_price, "trail_price", request.trail_price); !status.ok()) {
+        return std::make_pair(status, Order());
     }
-
-    if (order_class != OrderClass::Simple) {
-        writer.Key("order_class");
-        writer.String(orderClassToString(order_class).c_str());
+    if (status = parseOrderDecimal(trail_percent, "trail_percent", request.trail_percent); !status.ok()) {
+        return std::make_pair(status, Order());
     }
-
     if (take_profit_params != nullptr) {
-        writer.Key("take_profit");
-        writer.StartObject();
-        if (!take_profit_params->limitPrice.empty()) {
-            writer.Key("limit_price");
-            writer.String(take_profit_params->limitPrice.c_str());
+        request.take_profit.emplace();
+        if (status = parseOrderDecimal(take_profit_params->limitPrice, "take_profit limit_price",
+                                       request.take_profit->limit_price);
+            !status.ok()) {
+            return std::make_pair(status, Order());
         }
-        writer.EndObject();
     }
-
     if (stop_loss_params != nullptr) {
-        writer.Key("stop_loss");
-        writer.StartObject();
-        if (!stop_loss_params->limitPrice.empty()) {
-            writer.Key("limit_price");
-            writer.String(stop_loss_params->limitPrice.c_str());
+        request.stop_loss.emplace();
+        if (status = parseOrderDecimal(stop_loss_params->stopPrice, "stop_loss stop_price",
+                                       request.stop_loss->stop_price);
+            !status.ok()) {
+            return std::make_pair(status, Order());
         }
-        if (!stop_loss_params->stopPrice.empty()) {
-            writer.Key("stop_price");
-            writer.String(stop_loss_params->stopPrice.c_str());
+        if (status = parseOrderDecimal(stop_loss_params->limitPrice, "stop_loss limit_price",
+                                       request.stop_loss->limit_price);
+            !status.ok()) {
+            return std::make_pair(status, Order());
         }
-        writer.EndObject();
-    }
-
-    writer.EndObject();
-    const char* body = s.GetString();
-
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Post("/v2/orders", makeHeaders(environment_), body, kJSONContentType);
-    if (!resp) {
-        return std::make_pair(Status(1, "Call to /v2/orders returned an empty response"), order);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to /v2/orders returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), order);
     }
-
-    return std::make_pair(order.fromJSON(resp->body), order);
+    return submitOrder(request);
 }
 
 std::pair<Status, Order> Client::submitNotionalOrder(const std::string& symbol, const std::string& notional,
                                                       OrderSide side, OrderType type, OrderTimeInForce tif,
                                                       const std::string& limit_price, bool extended_hours,
                                                       const std::string& client_order_id) const {
-    Order order;
-
-    rapidjson::StringBuffer s;
-    s.Clear();
-    rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-    writer.StartObject();
-
-    writer.Key("symbol");
-    writer.String(symbol.c_str());
-
-    writer.Key("notional");
-    writer.String(notional.c_str());
-
-    writer.Key("side");
-    writer.String(orderSideToString(side).c_str());
-
-    writer.Key("type");
-    writer.String(orderTypeToString(type).c_str());
-
-    writer.Key("time_in_force");
-    writer.String(orderTimeInForceToString(tif).c_str());
-
-    if (!limit_price.empty()) {
-        writer.Key("limit_price");
-        writer.String(limit_price.c_str());
-    }
-
-    if (extended_hours) {
-        writer.Key("extended_hours");
-        writer.Bool(extended_hours);
+    OrderRequest request;
+    request.symbol = symbol;
+    request.side = side;
+    request.type = type;
+    request.tif = tif;
+    request.extended_hours = extended_hours;
+    request.client_order_id = client_order_id;
+    Status status;
+    if (status = parseOrderDecimal(notional, "notional", request.notional); !status.ok()) {
+        return std::make_pair(status, Order());
+    }
+    if (status = parseOrderDecimal(limit_price, "limit_price", request.limit_price); !status.ok()) {
+        return std::make_pair(status, Order());
+    }
+    return submitOrder(request);
+}
+
+std::pair<Status, Order> Client::submitOrder(const OrderRequest& request) const {
+    if (pre_trade_check_) {
+        if (Status status = pre_trade_check_(makeOrderIntent(request)); !status.ok()) {
+            return std::make_pair(status, Order());
+        }
     }
 
-    if (!client_order_id.empty()) {
-        writer.Key("client_order_id");
-        writer.String(client_order_id.c_str());
+    std::string body;
+    ClientOrderId generated;
+    std::string_view client_order_id;
+    if (Status status = detail::renderOrderRequest(environment_, request, body, generated, client_order_id);
+        !status.ok()) {
+        return std::make_pair(status, Order());
     }
 
-    writer.EndObject();
-    const char* body = s.GetString();
+    httplib::Client client(environment_.getTradingOrigin());
+    detail::configureOrderClient(client, environment_);
+    int http_status = 0;
+    return detail::submitOrderBody(client, makeHeaders(environment_), body, client_order_id, environment_,
+                                   order_cache_, order_limiter_.get(), http_status);
+}
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Post("/v2/orders", makeHeaders(environment_), body, kJSONContentType);
-    if (!resp) {
-        return std::make_pair(Status(1, "Call to /v2/orders returned an empty response"), order);
-    }
+OrderBatchResult Client::submitOrders(std::span<const OrderRequest> requests) const {
+    OrderBatchResult batch;
+    batch.results.resize(requests.size());
 
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to /v2/orders returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), order);
+    // Checks run here rather than on the workers, so they need not be thread-safe, and each one sees the
+    // exposure of the orders accepted before it
+    std::vector<std::size_t> pending;
+    pending.reserve(requests.size());
+    std::vector<OrderIntent> accepted;
+    accepted.reserve(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        if (Status status = checkOrderRequest(pre_trade_check_, requests[i], accepted); !status.ok()) {
+            batch.results[i].first = status;
+            continue;
+        }
+        pending.push_back(i);
     }
 
-    return std::make_pair(order.fromJSON(resp->body), order);
+    httplib::Headers headers = makeHeaders(environment_);
+    auto send = [&](httplib::Client& client, std::string& body, std::size_t i, int& http_status) {
+        // Already validated above, so rendering cannot fail
+        ClientOrderId generated;
+        std::string_view client_order_id;
+        detail::renderOrderRequest(environment_, requests[i], body, generated, client_order_id);
+        return detail::submitOrderBody(client, headers, body, client_order_id, environment_, order_cache_,
+                                       order_limiter_.get(), http_status);
+    };
+    runOrderBatch(environment_, pending, batch, send);
+    return batch;
 }
 
 std::pair<Status, Order> Client::replaceOrder(const std::string& id, int quantity, OrderTimeInForce tif,
                                               const std::string& limit_price, const std::string& stop_price,
                                               const std::string& client_order_id) const {
     Order order;
+    if (tif == OrderTimeInForce::Unknown) {
+        return std::make_pair(Status(1, "Order time_in_force must not be Unknown"), order);
+    }
 
     rapidjson::StringBuffer s;
     s.Clear();
@@ -518,7 +990,7 @@ std::pair<Status, Order> Client::replaceOrder(const std::string& id, int quantit
 
     std::string url = "/v2/orders/" + id;
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Patch(url.c_str(), makeHeaders(environment_), body, kJSONContentType);
     if (!resp) {
         std::ostringstream ss;
@@ -532,47 +1004,122 @@ std::pair<Status, Order> Client::replaceOrder(const std::string& id, int quantit
         return std::make_pair(Status(1, ss.str()), order);
     }
 
-    return std::make_pair(order.fromJSON(resp->body), order);
+    return std::make_pair(order.fromJSON(std::move(resp->body)), order);
 }
 
 std::pair<Status, std::vector<Order>> Client::cancelOrders() const {
     std::vector<Order> orders;
+    auto [status, results] = cancelAllOrders();
+    if (!status.ok()) {
+        return std::make_pair(status, orders);
+    }
+
+    orders.reserve(results.size());
+    std::size_t failed = 0;
+    const OrderCancelResult* first_failure = nullptr;
+    for (auto& result : results) {
+        if (result.status.ok()) {
+            orders.push_back(std::move(result.order));
+        } else if (failed++ == 0) {
+            first_failure = &result;
+        }
+    }
+    if (failed > 0) {
+        std::ostringstream ss;
+        ss << failed << " of " << results.size() << " orders could not be cancelled; order " << first_failure->id
+           << ": " << first_failure->status.getMessage();
+        return std::make_pair(Status(1, ss.str()), orders);
+    }
+    return std::make_pair(Status(), orders);
+}
+
+std::pair<Status, std::vector<OrderCancelResult>> Client::cancelAllOrders() const {
+    std::vector<OrderCancelResult> results;
+    const BatchConfig& config = environment_.getBatchConfig();
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
+    client.set_connection_timeout(environment_.getTimeoutConfig().connection_timeout);
+    client.set_read_timeout(config.cancel_all_timeout);
     httplib::Result resp = client.Delete("/v2/orders", makeHeaders(environment_));
+
+    if (detail::isAmbiguous(resp) && config.cancel_all_fallback) {
+        // The bulk endpoint is slow or failing: cancel the orders known to be open one by one instead
+        std::vector<std::string> ids;
+        if (order_cache_ != nullptr) {
+            for (const auto& order : order_cache_->snapshot()->open()) {
+                ids.push_back(order->id);
+            }
+        } else {
+            Status status;
+            std::tie(status, ids) = listOpenOrderIds(*this);
+            if (!status.ok()) {
+                return std::make_pair(status, results);
+            }
+        }
+
+        // Skip the follow-up GET of each cancelled order: a mass cancel needs the outcome, not the state
+        OrderBatchResult batch = cancelOrdersById(ids, false);
+
+        // An order the bulk request cancelled after all is rejected with an HTTP 422. Fetch each rejected
+        // order, and count it as cancelled if it is canceled or pending_cancel.
+        std::vector<std::size_t> rejected;
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            if (batch.http_statuses[i] == 422) {
+                rejected.push_back(i);
+            }
+        }
+        if (!rejected.empty()) {
+            OrderBatchResult lookups;
+            lookups.results.resize(ids.size());
+            httplib::Headers headers = makeHeaders(environment_);
+            runOrderBatch(environment_, rejected, lookups,
+                          [&](httplib::Client& client, std::string& url, std::size_t i, int& http_status) {
+                              url.assign("/v2/orders/").append(ids[i]);
+                              httplib::Result lookup = detail::sendRateLimited(
+                                  environment_.getRetryConfig(), order_limiter_.get(),
+                                  [&] { return client.Get(url, headers); });
+                              http_status = lookup ? lookup->status : 0;
+                              return detail::decodeOrderResponse(url, lookup);
+                          });
+            for (std::size_t i : rejected) {
+                auto& [status, order] = lookups.results[i];
+                if (status.ok() && (order.status == "canceled" || order.status == "pending_cancel")) {
+                    batch.results[i] = std::make_pair(Status(), std::move(order));
+                }
+            }
+        }
+
+        results.resize(ids.size());
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            results[i].id = ids[i];
+            results[i].http_status = batch.http_statuses[i];
+            results[i].status = batch.results[i].first;
+            results[i].order = std::move(batch.results[i].second);
+        }
+        return std::make_pair(Status(), results);
+    }
+
     if (!resp) {
-        return std::make_pair(Status(1, "Call to /v2/orders returned an empty response"), orders);
+        return std::make_pair(Status(1, "Call to /v2/orders returned an empty response"), results);
     }
 
     if (resp->status != 200 && resp->status != 207) {
         std::ostringstream ss;
         ss << "Call to /v2/orders returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), orders);
+        return std::make_pair(Status(1, ss.str()), results);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing orders JSON"), orders);
+    OrderCancelResults decoded;
+    if (Status status = decoded.fromJSON(std::move(resp->body)); !status.ok()) {
+        return std::make_pair(status, results);
     }
-    for (auto& o : d.GetArray()) {
-        Order order;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = order.fromJSON(s.GetString()); !status.ok()) {
-            return std::make_pair(status, orders);
-        }
-        orders.push_back(order);
-    }
-
-    return std::make_pair(Status(), orders);
+    return std::make_pair(Status(), std::move(decoded.results));
 }
 
 std::pair<Status, Order> Client::cancelOrder(const std::string& id) const {
     Order order;
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     std::string url = "/v2/orders/" + id;
     httplib::Result resp = client.Delete(url.c_str(), makeHeaders(environment_));
     if (!resp) {
@@ -591,7 +1138,37 @@ std::pair<Status, Order> Client::cancelOrder(const std::string& id) const {
         return std::make_pair(Status(1, ss.str()), order);
     }
 
-    return std::make_pair(order.fromJSON(resp->body), order);
+    return std::make_pair(order.fromJSON(std::move(resp->body)), order);
+}
+
+OrderBatchResult Client::cancelOrdersById(std::span<const std::string> ids, bool fetch_cancelled) const {
+    OrderBatchResult batch;
+    batch.results.resize(ids.size());
+    std::vector<std::size_t> pending(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        pending[i] = i;
+    }
+
+    httplib::Headers headers = makeHeaders(environment_);
+    auto send = [&](httplib::Client& client, std::string& url, std::size_t i, int& http_status) {
+        url.assign("/v2/orders/").append(ids[i]);
+        detail::RateLimiter* limiter = order_limiter_.get();
+        httplib::Result resp = detail::sendRateLimited(environment_.getRetryConfig(), limiter,
+                                                       [&] { return client.Delete(url, headers); });
+        http_status = resp ? resp->status : 0;
+        if (resp && resp->status == 204) {
+            if (!fetch_cancelled) {
+                Order order;
+                order.id = ids[i];
+                return std::make_pair(Status(), order);
+            }
+            resp = detail::sendRateLimited(environment_.getRetryConfig(), limiter,
+                                           [&] { return client.Get(url, headers); });
+        }
+        return detail::decodeOrderResponse(url, resp);
+    };
+    runOrderBatch(environment_, pending, batch, send);
+    return batch;
 }
 
 // ==================== Positions ====================
@@ -599,8 +1176,7 @@ std::pair<Status, Order> Client::cancelOrder(const std::string& id) const {
 std::pair<Status, std::vector<Position>> Client::getPositions() const {
     std::vector<Position> positions;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get("/v2/positions", makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), "/v2/positions", environment_, in_flight_.get());
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/positions returned an empty response"), positions);
     }
@@ -612,19 +1188,15 @@ std::pair<Status, std::vector<Position>> Client::getPositions() const {
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing positions JSON"), positions);
     }
     for (auto& o : d.GetArray()) {
         Position position;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = position.fromJSON(s.GetString()); !status.ok()) {
+        if (Status status = detail::decode(o, position); !status.ok()) {
             return std::make_pair(status, positions);
         }
-        positions.push_back(position);
+        positions.push_back(std::move(position));
     }
 
     return std::make_pair(Status(), positions);
@@ -635,8 +1207,7 @@ std::pair<Status, Position> Client::getPosition(const std::string& symbol) const
 
     std::string url = "/v2/positions/" + symbol;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -649,13 +1220,13 @@ std::pair<Status, Position> Client::getPosition(const std::string& symbol) const
         return std::make_pair(Status(1, ss.str()), position);
     }
 
-    return std::make_pair(position.fromJSON(resp->body), position);
+    return std::make_pair(position.fromJSON(std::move(resp->body)), position);
 }
 
 std::pair<Status, std::vector<Position>> Client::closePositions() const {
     std::vector<Position> positions;
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Delete("/v2/positions", makeHeaders(environment_));
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/positions returned an empty response"), positions);
@@ -668,19 +1239,15 @@ std::pair<Status, std::vector<Position>> Client::closePositions() const {
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing positions JSON"), positions);
     }
     for (auto& o : d.GetArray()) {
         Position position;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = position.fromJSON(s.GetString()); !status.ok()) {
+        if (Status status = detail::decode(o, position); !status.ok()) {
             return std::make_pair(status, positions);
         }
-        positions.push_back(position);
+        positions.push_back(std::move(position));
     }
 
     return std::make_pair(Status(), positions);
@@ -689,7 +1256,7 @@ std::pair<Status, std::vector<Position>> Client::closePositions() const {
 std::pair<Status, Position> Client::closePosition(const std::string& symbol) const {
     Position position;
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     std::string url = "/v2/positions/" + symbol;
     httplib::Result resp = client.Delete(url.c_str(), makeHeaders(environment_));
     if (!resp) {
@@ -708,14 +1275,12 @@ std::pair<Status, Position> Client::closePosition(const std::string& symbol) con
         return std::make_pair(Status(1, ss.str()), position);
     }
 
-    return std::make_pair(position.fromJSON(resp->body), position);
+    return std::make_pair(position.fromJSON(std::move(resp->body)), position);
 }
 
 // ==================== Assets ====================
 
 std::pair<Status, std::vector<Asset>> Client::getAssets(ActionStatus asset_status, AssetClass asset_class) const {
-    std::vector<Asset> assets;
-
     httplib::Params params{
         {"status", actionStatusToString(asset_status)},
         {"asset_class", assetClassToString(asset_class)},
@@ -723,160 +1288,91 @@ std::pair<Status, std::vector<Asset>> Client::getAssets(ActionStatus asset_statu
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = "/v2/assets?" + query_string;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), assets);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), assets);
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing assets JSON"), assets);
-    }
-    for (auto& o : d.GetArray()) {
-        Asset asset;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = asset.fromJSON(s.GetString()); !status.ok()) {
-            return std::make_pair(status, assets);
-        }
-        assets.push_back(asset);
-    }
-
-    return std::make_pair(Status(), assets);
+    return cachedGet<std::vector<Asset>>(
+        environment_.getCacheConfig().assets_ttl, environment_.getTradingOrigin(), url, [](std::string& body) {
+            std::vector<Asset> assets;
+            rapidjson::Document d;
+            if (d.ParseInsitu(body.data()).HasParseError()) {
+                return std::make_pair(Status(1, "Received parse error when deserializing assets JSON"), assets);
+            }
+            for (auto& o : d.GetArray()) {
+                Asset asset;
+                if (Status status = detail::decode(o, asset); !status.ok()) {
+                    return std::make_pair(status, assets);
+                }
+                assets.push_back(std::move(asset));
+            }
+            return std::make_pair(Status(), std::move(assets));
+        });
 }
 
 std::pair<Status, Asset> Client::getAsset(const std::string& symbol) const {
-    Asset asset;
-
     std::string url = "/v2/assets/" + symbol;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), asset);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), asset);
-    }
-
-    return std::make_pair(asset.fromJSON(resp->body), asset);
+    return cachedGet<Asset>(
+        environment_.getCacheConfig().assets_ttl, environment_.getTradingOrigin(), url, [](std::string& body) {
+            Asset asset;
+            return std::make_pair(asset.fromJSON(std::move(body)), asset);
+        });
 }
 
 // ==================== Clock & Calendar ====================
 
 std::pair<Status, Clock> Client::getClock() const {
-    Clock clock;
-
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get("/v2/clock", makeHeaders(environment_));
-    if (!resp) {
-        return std::make_pair(Status(1, "Call to /v2/clock returned an empty response"), clock);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to /v2/clock returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), clock);
-    }
-
-    return std::make_pair(clock.fromJSON(resp->body), clock);
+    return cachedGet<Clock>(
+        environment_.getCacheConfig().clock_ttl, environment_.getTradingOrigin(), "/v2/clock", [](std::string& body) {
+            Clock clock;
+            return std::make_pair(clock.fromJSON(std::move(body)), clock);
+        });
 }
 
 std::pair<Status, std::vector<Date>> Client::getCalendar(const std::string& start, const std::string& end) const {
-    std::vector<Date> dates;
-
     std::string url = "/v2/calendar?start=" + start + "&end=" + end;
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), dates);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), dates);
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing calendar JSON"), dates);
-    }
-    for (auto& o : d.GetArray()) {
-        Date date;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = date.fromJSON(s.GetString()); !status.ok()) {
-            return std::make_pair(status, dates);
-        }
-        dates.push_back(date);
-    }
-
-    return std::make_pair(Status(), dates);
+    return cachedGet<std::vector<Date>>(
+        environment_.getCacheConfig().calendar_ttl, environment_.getTradingOrigin(), url, [](std::string& body) {
+            std::vector<Date> dates;
+            rapidjson::Document d;
+            if (d.ParseInsitu(body.data()).HasParseError()) {
+                return std::make_pair(Status(1, "Received parse error when deserializing calendar JSON"), dates);
+            }
+            for (auto& o : d.GetArray()) {
+                Date date;
+                if (Status status = detail::decode(o, date); !status.ok()) {
+                    return std::make_pair(status, dates);
+                }
+                dates.push_back(std::move(date));
+            }
+            return std::make_pair(Status(), std::move(dates));
+        });
 }
 
 // ==================== Watchlists ====================
 
 std::pair<Status, std::vector<Watchlist>> Client::getWatchlists() const {
-    std::vector<Watchlist> watchlists;
-
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get("/v2/watchlists", makeHeaders(environment_));
-    if (!resp) {
-        return std::make_pair(Status(1, "Call to /v2/watchlists returned an empty response"), watchlists);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to /v2/watchlists returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), watchlists);
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing watchlists JSON"), watchlists);
-    }
-    for (auto& o : d.GetArray()) {
-        Watchlist watchlist;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = watchlist.fromJSON(s.GetString()); !status.ok()) {
-            return std::make_pair(status, watchlists);
-        }
-        watchlists.push_back(watchlist);
-    }
-
-    return std::make_pair(Status(), watchlists);
+    return cachedGet<std::vector<Watchlist>>(
+        environment_.getCacheConfig().watchlists_ttl, environment_.getTradingOrigin(), "/v2/watchlists",
+        [](std::string& body) {
+            std::vector<Watchlist> watchlists;
+            rapidjson::Document d;
+            if (d.ParseInsitu(body.data()).HasParseError()) {
+                return std::make_pair(Status(1, "Received parse error when deserializing watchlists JSON"), watchlists);
+            }
+            for (auto& o : d.GetArray()) {
+                Watchlist watchlist;
+                if (Status status = detail::decode(o, watchlist); !status.ok()) {
+                    return std::make_pair(status, watchlists);
+                }
+                watchlists.push_back(std::move(watchlist));
+            }
+            return std::make_pair(Status(), std::move(watchlists));
+        });
 }
 
 std::pair<Status, Watchlist> Client::getWatchlist(const std::string& id) const {
     Watchlist watchlist;
 
     std::string url = "/v2/watchlists/" + id;
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -889,7 +1385,7 @@ std::pair<Status, Watchlist> Client::getWatchlist(const std::string& id) const {
         return std::make_pair(Status(1, ss.str()), watchlist);
     }
 
-    return std::make_pair(watchlist.fromJSON(resp->body), watchlist);
+    return std::make_pair(watchlist.fromJSON(std::move(resp->body)), watchlist);
 }
 
 std::pair<Status, Watchlist> Client::createWatchlist(const std::string& name,
@@ -914,8 +1410,10 @@ std::pair<Status, Watchlist> Client::createWatchlist(const std::string& name,
     writer.EndObject();
     const char* body = s.GetString();
 
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Post("/v2/watchlists", makeHeaders(environment_), body, kJSONContentType);
+    // Even a failed or unanswered mutation may have been applied, so the cached list is dropped either way
+    invalidateCache("/v2/watchlists");
     if (!resp) {
         return std::make_pair(Status(1, "Call to /v2/watchlists returned an empty response"), watchlist);
     }
@@ -926,7 +1424,7 @@ std::pair<Status, Watchlist> Client::createWatchlist(const std::string& name,
         return std::make_pair(Status(1, ss.str()), watchlist);
     }
 
-    return std::make_pair(watchlist.fromJSON(resp->body), watchlist);
+    return std::make_pair(watchlist.fromJSON(std::move(resp->body)), watchlist);
 }
 
 std::pair<Status, Watchlist> Client::updateWatchlist(const std::string& id, const std::string& name,
@@ -952,8 +1450,9 @@ std::pair<Status, Watchlist> Client::updateWatchlist(const std::string& id, cons
     const char* body = s.GetString();
 
     std::string url = "/v2/watchlists/" + id;
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Put(url.c_str(), makeHeaders(environment_), body, kJSONContentType);
+    invalidateCache("/v2/watchlists");
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -966,13 +1465,14 @@ std::pair<Status, Watchlist> Client::updateWatchlist(const std::string& id, cons
         return std::make_pair(Status(1, ss.str()), watchlist);
     }
 
-    return std::make_pair(watchlist.fromJSON(resp->body), watchlist);
+    return std::make_pair(watchlist.fromJSON(std::move(resp->body)), watchlist);
 }
 
 Status Client::deleteWatchlist(const std::string& id) const {
     std::string url = "/v2/watchlists/" + id;
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Delete(url.c_str(), makeHeaders(environment_));
+    invalidateCache("/v2/watchlists");
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1001,8 +1501,9 @@ std::pair<Status, Watchlist> Client::addSymbolToWatchlist(const std::string& id,
     const char* body = s.GetString();
 
     std::string url = "/v2/watchlists/" + id;
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Post(url.c_str(), makeHeaders(environment_), body, kJSONContentType);
+    invalidateCache("/v2/watchlists");
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1015,15 +1516,16 @@ std::pair<Status, Watchlist> Client::addSymbolToWatchlist(const std::string& id,
         return std::make_pair(Status(1, ss.str()), watchlist);
     }
 
-    return std::make_pair(watchlist.fromJSON(resp->body), watchlist);
+    return std::make_pair(watchlist.fromJSON(std::move(resp->body)), watchlist);
 }
 
 std::pair<Status, Watchlist> Client::removeSymbolFromWatchlist(const std::string& id, const std::string& symbol) const {
     Watchlist watchlist;
 
     std::string url = "/v2/watchlists/" + id + "/" + symbol;
-    httplib::SSLClient client(environment_.getTradingHost());
+    httplib::Client client(environment_.getTradingOrigin());
     httplib::Result resp = client.Delete(url.c_str(), makeHeaders(environment_));
+    invalidateCache("/v2/watchlists");
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1035,7 +1537,7 @@ std::pair<Status, Watchlist> Client::removeSymbolFromWatchlist(const std::string
         ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
         return std::make_pair(Status(1, ss.str()), watchlist);
     }
-    return std::make_pair(watchlist.fromJSON(resp->body), watchlist);
+    return std::make_pair(watchlist.fromJSON(std::move(resp->body)), watchlist);
 }
 
 // ==================== Portfolio ====================
@@ -1080,8 +1582,7 @@ std::pair<Status, PortfolioHistory> Client::getPortfolioHistory(const std::strin
     }
 
     std::string url = "/v2/account/portfolio/history" + query_string;
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1094,7 +1595,7 @@ std::pair<Status, PortfolioHistory> Client::getPortfolioHistory(const std::strin
         return std::make_pair(Status(1, ss.str()), portfolio_history);
     }
 
-    return std::make_pair(portfolio_history.fromJSON(resp->body), portfolio_history);
+    return std::make_pair(portfolio_history.fromJSON(std::move(resp->body)), portfolio_history);
 }
 
 // ==================== Market Data (v2) ====================
@@ -1104,48 +1605,41 @@ std::pair<Status, Bars> Client::getBars(const std::vector<std::string>& symbols,
                                         const std::string& page_token) const {
     Bars bars;
 
-    std::string symbols_string;
-    for (size_t i = 0; i < symbols.size(); ++i) {
-        symbols_string += symbols[i];
-        if (i < symbols.size() - 1) {
-            symbols_string += ",";
-        }
-    }
-
-    httplib::Params params{
-        {"symbols", symbols_string},
-        {"timeframe", timeframe},
-        {"limit", std::to_string(limit)},
-    };
-    if (!start.empty()) {
-        params.insert({"start", start});
-    }
-    if (!end.empty()) {
-        params.insert({"end", end});
-    }
-    if (!page_token.empty()) {
-        params.insert({"page_token", page_token});
-    }
-    std::string query_string = httplib::detail::params_to_query_str(params);
-
-    // Market Data API v2 endpoint
-    std::string url = "/v2/stocks/bars?" + query_string;
-
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), bars);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), bars);
-    }
-
-    return std::make_pair(bars.fromJSON(resp->body), bars);
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<Bars>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getBars(chunk, start, end, timeframe, chunk_limit, chunk_token);
+            },
+            [](Bars& into, Bars& from) { into.bars.merge(from.bars); });
+    }
+
+    std::string url = barsUrl(symbols, start, end, timeframe, limit, page_token);
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
+    Status status = decodeBarsPage(url, resp, bars);
+    return std::make_pair(status, bars);
+}
+
+std::pair<Status, std::vector<Bar>> Client::downloadBars(const std::string& symbol,
+                                                         const std::vector<TimeRange>& ranges,
+                                                         const std::string& timeframe,
+                                                         const ParallelDownloadConfig& config) const {
+    return downloadHistory<Bar>(
+        environment_, ranges, config,
+        [&](httplib::Client& client, const httplib::Headers& headers, const TimeRange& range,
+            const std::string& page_token, std::vector<Bar>& items, std::string& next_page_token) {
+            std::string url = barsUrl({symbol}, range.start, range.end, timeframe, config.page_limit, page_token);
+            httplib::Result resp = client.Get(url, headers);
+            Bars bars;
+            if (Status status = decodeBarsPage(url, resp, bars); !status.ok()) {
+                return status;
+            }
+            if (auto it = bars.bars.find(symbol); it != bars.bars.end()) {
+                std::move(it->second.begin(), it->second.end(), std::back_inserter(items));
+            }
+            next_page_token = std::move(bars.next_page_token);
+            return Status();
+        });
 }
 
 std::pair<Status, LatestTrade> Client::getLatestTrade(const std::string& symbol) const {
@@ -1154,8 +1648,7 @@ std::pair<Status, LatestTrade> Client::getLatestTrade(const std::string& symbol)
     // Market Data API v2 endpoint
     std::string url = "/v2/stocks/" + symbol + "/trades/latest";
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1168,7 +1661,7 @@ std::pair<Status, LatestTrade> Client::getLatestTrade(const std::string& symbol)
         return std::make_pair(Status(1, ss.str()), latest_trade);
     }
 
-    return std::make_pair(latest_trade.fromJSON(resp->body), latest_trade);
+    return std::make_pair(latest_trade.fromJSON(std::move(resp->body)), latest_trade);
 }
 
 std::pair<Status, LatestQuote> Client::getLatestQuote(const std::string& symbol) const {
@@ -1177,8 +1670,7 @@ std::pair<Status, LatestQuote> Client::getLatestQuote(const std::string& symbol)
     // Market Data API v2 endpoint
     std::string url = "/v2/stocks/" + symbol + "/quotes/latest";
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1191,11 +1683,17 @@ std::pair<Status, LatestQuote> Client::getLatestQuote(const std::string& symbol)
         return std::make_pair(Status(1, ss.str()), latest_quote);
     }
 
-    return std::make_pair(latest_quote.fromJSON(resp->body), latest_quote);
+    return std::make_pair(latest_quote.fromJSON(std::move(resp->body)), latest_quote);
 }
 
-std::pair<Status, std::map<std::string, Trade>> Client::getLatestTrades(const std::vector<std::string>& symbols) const {
-    std::map<std::string, Trade> trades;
+std::pair<Status, SymbolMap<Trade>> Client::getLatestTrades(const std::vector<std::string>& symbols) const {
+    SymbolMap<Trade> trades;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<Trade>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestTrades(chunk); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -1207,8 +1705,7 @@ std::pair<Status, std::map<std::string, Trade>> Client::getLatestTrades(const st
 
     std::string url = "/v2/stocks/trades/latest?symbols=" + symbols_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1221,30 +1718,19 @@ std::pair<Status, std::map<std::string, Trade>> Client::getLatestTrades(const st
         return std::make_pair(Status(1, ss.str()), trades);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing latest trades JSON"), trades);
-    }
-
-    if (d.HasMember("trades") && d["trades"].IsObject()) {
-        for (auto& m : d["trades"].GetObject()) {
-            Trade trade;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, trades);
-            }
-            trades[m.name.GetString()] = trade;
-        }
-    }
-
-    return std::make_pair(Status(), trades);
+    Status status = decodeSymbolMapBody(resp->body, "trades", trades,
+                                        "Received parse error when deserializing latest trades JSON");
+    return std::make_pair(status, std::move(trades));
 }
 
-std::pair<Status, std::map<std::string, Quote>> Client::getLatestQuotes(const std::vector<std::string>& symbols) const {
-    std::map<std::string, Quote> quotes;
+std::pair<Status, SymbolMap<Quote>> Client::getLatestQuotes(const std::vector<std::string>& symbols) const {
+    SymbolMap<Quote> quotes;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<Quote>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestQuotes(chunk); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -1256,8 +1742,7 @@ std::pair<Status, std::map<std::string, Quote>> Client::getLatestQuotes(const st
 
     std::string url = "/v2/stocks/quotes/latest?symbols=" + symbols_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1270,26 +1755,9 @@ std::pair<Status, std::map<std::string, Quote>> Client::getLatestQuotes(const st
         return std::make_pair(Status(1, ss.str()), quotes);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing latest quotes JSON"), quotes);
-    }
-
-    if (d.HasMember("quotes") && d["quotes"].IsObject()) {
-        for (auto& m : d["quotes"].GetObject()) {
-            Quote quote;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, quotes);
-            }
-            quotes[m.name.GetString()] = quote;
-        }
-    }
-
-    return std::make_pair(Status(), quotes);
+    Status status = decodeSymbolMapBody(resp->body, "quotes", quotes,
+                                        "Received parse error when deserializing latest quotes JSON");
+    return std::make_pair(status, std::move(quotes));
 }
 
 // ==================== Corporate Actions ====================
@@ -1301,8 +1769,6 @@ std::pair<Status, std::vector<Announcement>> Client::getAnnouncements(
     const std::string& symbol,
     const std::string& cusip,
     const std::string& date_type) const {
-    std::vector<Announcement> announcements;
-
     std::string query_string;
 
     if (!ca_types.empty()) {
@@ -1346,42 +1812,28 @@ std::pair<Status, std::vector<Announcement>> Client::getAnnouncements(
         url += "?" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), announcements);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), announcements);
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing announcements JSON"), announcements);
-    }
-
-    if (!d.IsArray()) {
-        return std::make_pair(Status(1, "Expected array of announcements"), announcements);
-    }
+    return cachedGet<std::vector<Announcement>>(
+        environment_.getCacheConfig().announcements_ttl, environment_.getTradingOrigin(), url, [](std::string& body) {
+            std::vector<Announcement> announcements;
+            rapidjson::Document d;
+            if (d.ParseInsitu(body.data()).HasParseError()) {
+                return std::make_pair(Status(1, "Received parse error when deserializing announcements JSON"),
+                                      announcements);
+            }
 
-    for (auto& o : d.GetArray()) {
-        Announcement announcement;
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        o.Accept(writer);
-        if (Status status = announcement.fromJSON(s.GetString()); !status.ok()) {
-            return std::make_pair(status, announcements);
-        }
-        announcements.push_back(announcement);
-    }
+            if (!d.IsArray()) {
+                return std::make_pair(Status(1, "Expected array of announcements"), announcements);
+            }
 
-    return std::make_pair(Status(), announcements);
+            for (auto& o : d.GetArray()) {
+                Announcement announcement;
+                if (Status status = detail::decode(o, announcement); !status.ok()) {
+                    return std::make_pair(status, announcements);
+                }
+                announcements.push_back(std::move(announcement));
+            }
+            return std::make_pair(Status(), std::move(announcements));
+        });
 }
 
 std::pair<Status, Announcement> Client::getAnnouncement(const std::string& id) const {
@@ -1389,8 +1841,7 @@ std::pair<Status, Announcement> Client::getAnnouncement(const std::string& id) c
 
     std::string url = "/v2/corporate_actions/announcements/" + id;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1403,7 +1854,7 @@ std::pair<Status, Announcement> Client::getAnnouncement(const std::string& id) c
         return std::make_pair(Status(1, ss.str()), announcement);
     }
 
-    return std::make_pair(announcement.fromJSON(resp->body), announcement);
+    return std::make_pair(announcement.fromJSON(std::move(resp->body)), announcement);
 }
 
 // ==================== Options ====================
@@ -1467,8 +1918,7 @@ std::pair<Status, OptionContracts> Client::getOptionContracts(
         url += "?" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getTradingOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1481,29 +1931,18 @@ std::pair<Status, OptionContracts> Client::getOptionContracts(
         return std::make_pair(Status(1, ss.str()), contracts);
     }
 
-    return std::make_pair(contracts.fromJSON(resp->body), contracts);
+    return std::make_pair(contracts.fromJSON(std::move(resp->body)), contracts);
 }
 
 std::pair<Status, OptionContract> Client::getOptionContract(const std::string& symbol_or_id) const {
-    OptionContract contract;
-
     std::string url = "/v2/options/contracts/" + symbol_or_id;
 
-    httplib::SSLClient client(environment_.getTradingHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), contract);
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), contract);
-    }
-
-    return std::make_pair(contract.fromJSON(resp->body), contract);
+    return cachedGet<OptionContract>(
+        environment_.getCacheConfig().option_contracts_ttl, environment_.getTradingOrigin(), url,
+        [](std::string& body) {
+            OptionContract contract;
+            return std::make_pair(contract.fromJSON(std::move(body)), contract);
+        });
 }
 
 // ==================== Market Data - Snapshots ====================
@@ -1513,8 +1952,7 @@ std::pair<Status, Snapshot> Client::getSnapshot(const std::string& symbol) const
 
     std::string url = "/v2/stocks/" + symbol + "/snapshot";
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1527,11 +1965,17 @@ std::pair<Status, Snapshot> Client::getSnapshot(const std::string& symbol) const
         return std::make_pair(Status(1, ss.str()), snapshot);
     }
 
-    return std::make_pair(snapshot.fromJSON(resp->body), snapshot);
+    return std::make_pair(snapshot.fromJSON(std::move(resp->body)), snapshot);
 }
 
-std::pair<Status, std::map<std::string, Snapshot>> Client::getSnapshots(const std::vector<std::string>& symbols) const {
-    std::map<std::string, Snapshot> snapshots;
+std::pair<Status, SymbolMap<Snapshot>> Client::getSnapshots(const std::vector<std::string>& symbols) const {
+    SymbolMap<Snapshot> snapshots;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<Snapshot>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getSnapshots(chunk); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -1543,8 +1987,7 @@ std::pair<Status, std::map<std::string, Snapshot>> Client::getSnapshots(const st
 
     std::string url = "/v2/stocks/snapshots?symbols=" + symbols_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1557,27 +2000,9 @@ std::pair<Status, std::map<std::string, Snapshot>> Client::getSnapshots(const st
         return std::make_pair(Status(1, ss.str()), snapshots);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing snapshots JSON"), snapshots);
-    }
-
-    // Response is object keyed by symbol
-    if (d.IsObject()) {
-        for (auto& m : d.GetObject()) {
-            Snapshot snapshot;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = snapshot.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, snapshots);
-            }
-            snapshots[m.name.GetString()] = snapshot;
-        }
-    }
-
-    return std::make_pair(Status(), snapshots);
+    Status status = decodeSymbolMapBody(resp->body, "", snapshots,
+                                        "Received parse error when deserializing snapshots JSON");
+    return std::make_pair(status, std::move(snapshots));
 }
 
 // ==================== Market Data - Latest Bars ====================
@@ -1587,8 +2012,7 @@ std::pair<Status, Bar> Client::getLatestBar(const std::string& symbol) const {
 
     std::string url = "/v2/stocks/" + symbol + "/bars/latest";
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1602,23 +2026,25 @@ std::pair<Status, Bar> Client::getLatestBar(const std::string& symbol) const {
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing latest bar JSON"), bar);
     }
 
     if (d.HasMember("bar") && d["bar"].IsObject()) {
-        rapidjson::StringBuffer s;
-        s.Clear();
-        rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-        d["bar"].Accept(writer);
-        return std::make_pair(bar.fromJSON(s.GetString()), bar);
+        return std::make_pair(detail::decode(d["bar"], bar), bar);
     }
 
     return std::make_pair(Status(1, "Response missing 'bar' field"), bar);
 }
 
-std::pair<Status, std::map<std::string, Bar>> Client::getLatestBars(const std::vector<std::string>& symbols) const {
-    std::map<std::string, Bar> bars;
+std::pair<Status, SymbolMap<Bar>> Client::getLatestBars(const std::vector<std::string>& symbols) const {
+    SymbolMap<Bar> bars;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<Bar>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestBars(chunk); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -1630,8 +2056,7 @@ std::pair<Status, std::map<std::string, Bar>> Client::getLatestBars(const std::v
 
     std::string url = "/v2/stocks/bars/latest?symbols=" + symbols_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1644,26 +2069,9 @@ std::pair<Status, std::map<std::string, Bar>> Client::getLatestBars(const std::v
         return std::make_pair(Status(1, ss.str()), bars);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing latest bars JSON"), bars);
-    }
-
-    if (d.HasMember("bars") && d["bars"].IsObject()) {
-        for (auto& m : d["bars"].GetObject()) {
-            Bar bar;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = bar.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, bars);
-            }
-            bars[m.name.GetString()] = bar;
-        }
-    }
-
-    return std::make_pair(Status(), bars);
+    Status status = decodeSymbolMapBody(resp->body, "bars", bars,
+                                        "Received parse error when deserializing latest bars JSON");
+    return std::make_pair(status, std::move(bars));
 }
 
 // ==================== Market Data - Historical Trades/Quotes ====================
@@ -1676,66 +2084,23 @@ std::pair<Status, std::pair<std::vector<Trade>, std::string>> Client::getTrades(
     const std::string& page_token) const {
     std::vector<Trade> trades;
     std::string next_page_token;
+    std::string url = historyUrl(symbol, "trades", start, end, limit, page_token);
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
+    Status status = decodeHistoryPage(url, resp, "trades", trades, next_page_token);
+    return std::make_pair(status, std::make_pair(std::move(trades), std::move(next_page_token)));
+}
 
-    httplib::Params params;
-    if (!start.empty()) {
-        params.insert({"start", start});
-    }
-    if (!end.empty()) {
-        params.insert({"end", end});
-    }
-    if (limit > 0) {
-        params.insert({"limit", std::to_string(limit)});
-    }
-    if (!page_token.empty()) {
-        params.insert({"page_token", page_token});
-    }
-
-    std::string query_string = httplib::detail::params_to_query_str(params);
-    std::string url = "/v2/stocks/" + symbol + "/trades";
-    if (!query_string.empty()) {
-        url += "?" + query_string;
-    }
-
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), std::make_pair(trades, next_page_token));
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), std::make_pair(trades, next_page_token));
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing trades JSON"), 
-                              std::make_pair(trades, next_page_token));
-    }
-
-    if (d.HasMember("trades") && d["trades"].IsArray()) {
-        for (auto& o : d["trades"].GetArray()) {
-            Trade trade;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            o.Accept(writer);
-            if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, std::make_pair(trades, next_page_token));
-            }
-            trades.push_back(trade);
-        }
-    }
-
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
-    }
-
-    return std::make_pair(Status(), std::make_pair(trades, next_page_token));
+std::pair<Status, std::vector<Trade>> Client::downloadTrades(const std::string& symbol,
+                                                          const std::vector<TimeRange>& ranges,
+                                                          const ParallelDownloadConfig& config) const {
+    return downloadHistory<Trade>(
+        environment_, ranges, config,
+        [&](httplib::Client& client, const httplib::Headers& headers, const TimeRange& range,
+            const std::string& page_token, std::vector<Trade>& items, std::string& next_page_token) {
+            std::string url = historyUrl(symbol, "trades", range.start, range.end, config.page_limit, page_token);
+            httplib::Result resp = client.Get(url, headers);
+            return decodeHistoryPage(url, resp, "trades", items, next_page_token);
+        });
 }
 
 std::pair<Status, std::pair<std::vector<Quote>, std::string>> Client::getQuotes(
@@ -1746,66 +2111,23 @@ std::pair<Status, std::pair<std::vector<Quote>, std::string>> Client::getQuotes(
     const std::string& page_token) const {
     std::vector<Quote> quotes;
     std::string next_page_token;
+    std::string url = historyUrl(symbol, "quotes", start, end, limit, page_token);
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
+    Status status = decodeHistoryPage(url, resp, "quotes", quotes, next_page_token);
+    return std::make_pair(status, std::make_pair(std::move(quotes), std::move(next_page_token)));
+}
 
-    httplib::Params params;
-    if (!start.empty()) {
-        params.insert({"start", start});
-    }
-    if (!end.empty()) {
-        params.insert({"end", end});
-    }
-    if (limit > 0) {
-        params.insert({"limit", std::to_string(limit)});
-    }
-    if (!page_token.empty()) {
-        params.insert({"page_token", page_token});
-    }
-
-    std::string query_string = httplib::detail::params_to_query_str(params);
-    std::string url = "/v2/stocks/" + symbol + "/quotes";
-    if (!query_string.empty()) {
-        url += "?" + query_string;
-    }
-
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
-    if (!resp) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an empty response";
-        return std::make_pair(Status(1, ss.str()), std::make_pair(quotes, next_page_token));
-    }
-
-    if (resp->status != 200) {
-        std::ostringstream ss;
-        ss << "Call to " << url << " returned an HTTP " << resp->status << ": " << resp->body;
-        return std::make_pair(Status(1, ss.str()), std::make_pair(quotes, next_page_token));
-    }
-
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing quotes JSON"),
-                              std::make_pair(quotes, next_page_token));
-    }
-
-    if (d.HasMember("quotes") && d["quotes"].IsArray()) {
-        for (auto& o : d["quotes"].GetArray()) {
-            Quote quote;
-            rapidjson::StringBuffer s;
-            s.Clear();
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            o.Accept(writer);
-            if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, std::make_pair(quotes, next_page_token));
-            }
-            quotes.push_back(quote);
-        }
-    }
-
-    if (d.HasMember("next_page_token") && d["next_page_token"].IsString()) {
-        next_page_token = d["next_page_token"].GetString();
-    }
-
-    return std::make_pair(Status(), std::make_pair(quotes, next_page_token));
+std::pair<Status, std::vector<Quote>> Client::downloadQuotes(const std::string& symbol,
+                                                          const std::vector<TimeRange>& ranges,
+                                                          const ParallelDownloadConfig& config) const {
+    return downloadHistory<Quote>(
+        environment_, ranges, config,
+        [&](httplib::Client& client, const httplib::Headers& headers, const TimeRange& range,
+            const std::string& page_token, std::vector<Quote>& items, std::string& next_page_token) {
+            std::string url = historyUrl(symbol, "quotes", range.start, range.end, config.page_limit, page_token);
+            httplib::Result resp = client.Get(url, headers);
+            return decodeHistoryPage(url, resp, "quotes", items, next_page_token);
+        });
 }
 
 // ==================== Market Data - Multi-Symbol Historical ====================
@@ -1818,6 +2140,15 @@ std::pair<Status, MultiTrades> Client::getMultiTrades(
     const std::string& page_token) const {
     MultiTrades multi_trades;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<MultiTrades>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getMultiTrades(chunk, start, end, chunk_limit, chunk_token);
+            },
+            [](MultiTrades& into, MultiTrades& from) { into.trades.merge(from.trades); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -1843,8 +2174,7 @@ std::pair<Status, MultiTrades> Client::getMultiTrades(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = "/v2/stocks/trades?" + query_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1857,7 +2187,7 @@ std::pair<Status, MultiTrades> Client::getMultiTrades(
         return std::make_pair(Status(1, ss.str()), multi_trades);
     }
 
-    return std::make_pair(multi_trades.fromJSON(resp->body), multi_trades);
+    return std::make_pair(multi_trades.fromJSON(std::move(resp->body)), multi_trades);
 }
 
 std::pair<Status, MultiQuotes> Client::getMultiQuotes(
@@ -1868,6 +2198,15 @@ std::pair<Status, MultiQuotes> Client::getMultiQuotes(
     const std::string& page_token) const {
     MultiQuotes multi_quotes;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<MultiQuotes>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getMultiQuotes(chunk, start, end, chunk_limit, chunk_token);
+            },
+            [](MultiQuotes& into, MultiQuotes& from) { into.quotes.merge(from.quotes); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -1893,8 +2232,7 @@ std::pair<Status, MultiQuotes> Client::getMultiQuotes(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = "/v2/stocks/quotes?" + query_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1907,7 +2245,7 @@ std::pair<Status, MultiQuotes> Client::getMultiQuotes(
         return std::make_pair(Status(1, ss.str()), multi_quotes);
     }
 
-    return std::make_pair(multi_quotes.fromJSON(resp->body), multi_quotes);
+    return std::make_pair(multi_quotes.fromJSON(std::move(resp->body)), multi_quotes);
 }
 
 // ==================== Market Data - Auctions ====================
@@ -1940,8 +2278,7 @@ std::pair<Status, Auctions> Client::getAuctions(
         url += "?" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -1954,7 +2291,7 @@ std::pair<Status, Auctions> Client::getAuctions(
         return std::make_pair(Status(1, ss.str()), auctions);
     }
 
-    return std::make_pair(auctions.fromJSON(resp->body), auctions);
+    return std::make_pair(auctions.fromJSON(std::move(resp->body)), auctions);
 }
 
 std::pair<Status, Auctions> Client::getMultiAuctions(
@@ -1965,6 +2302,15 @@ std::pair<Status, Auctions> Client::getMultiAuctions(
     const std::string& page_token) const {
     Auctions auctions;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<Auctions>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getMultiAuctions(chunk, start, end, chunk_limit, chunk_token);
+            },
+            [](Auctions& into, Auctions& from) { into.auctions.merge(from.auctions); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -1990,8 +2336,7 @@ std::pair<Status, Auctions> Client::getMultiAuctions(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = "/v2/stocks/auctions?" + query_string;
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2004,7 +2349,7 @@ std::pair<Status, Auctions> Client::getMultiAuctions(
         return std::make_pair(Status(1, ss.str()), auctions);
     }
 
-    return std::make_pair(auctions.fromJSON(resp->body), auctions);
+    return std::make_pair(auctions.fromJSON(std::move(resp->body)), auctions);
 }
 
 // ==================== Market Data - Corporate Actions ====================
@@ -2058,8 +2403,7 @@ std::pair<Status, CorporateActions> Client::getCorporateActions(
         url += "?" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2072,7 +2416,7 @@ std::pair<Status, CorporateActions> Client::getCorporateActions(
         return std::make_pair(Status(1, ss.str()), corporate_actions);
     }
 
-    return std::make_pair(corporate_actions.fromJSON(resp->body), corporate_actions);
+    return std::make_pair(corporate_actions.fromJSON(std::move(resp->body)), corporate_actions);
 }
 
 // ==================== News API ====================
@@ -2123,8 +2467,7 @@ std::pair<Status, NewsArticles> Client::getNews(
         url += "?" + query_string;
     }
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2137,7 +2480,7 @@ std::pair<Status, NewsArticles> Client::getNews(
         return std::make_pair(Status(1, ss.str()), news_articles);
     }
 
-    return std::make_pair(news_articles.fromJSON(resp->body), news_articles);
+    return std::make_pair(news_articles.fromJSON(std::move(resp->body)), news_articles);
 }
 
 // ==================== Crypto Market Data ====================
@@ -2156,8 +2499,7 @@ std::pair<Status, CryptoTrade> Client::getLatestCryptoTrade(
 
     std::string url = makeCryptoUrl("/latest/trades?symbols=" + symbol, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2171,27 +2513,30 @@ std::pair<Status, CryptoTrade> Client::getLatestCryptoTrade(
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing crypto trade JSON"), trade);
     }
 
     if (d.HasMember("trades") && d["trades"].IsObject()) {
         auto& trades_obj = d["trades"];
         if (trades_obj.HasMember(symbol.c_str()) && trades_obj[symbol.c_str()].IsObject()) {
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            trades_obj[symbol.c_str()].Accept(writer);
-            return std::make_pair(trade.fromJSON(s.GetString()), trade);
+            return std::make_pair(detail::decode(trades_obj[symbol.c_str()], trade), trade);
         }
     }
 
     return std::make_pair(Status(1, "Trade not found for symbol"), trade);
 }
 
-std::pair<Status, std::map<std::string, CryptoTrade>> Client::getLatestCryptoTrades(
+std::pair<Status, SymbolMap<CryptoTrade>> Client::getLatestCryptoTrades(
     const std::vector<std::string>& symbols,
     CryptoFeed feed) const {
-    std::map<std::string, CryptoTrade> trades;
+    SymbolMap<CryptoTrade> trades;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<CryptoTrade>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestCryptoTrades(chunk, feed); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -2203,8 +2548,7 @@ std::pair<Status, std::map<std::string, CryptoTrade>> Client::getLatestCryptoTra
 
     std::string url = makeCryptoUrl("/latest/trades?symbols=" + symbols_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2217,25 +2561,9 @@ std::pair<Status, std::map<std::string, CryptoTrade>> Client::getLatestCryptoTra
         return std::make_pair(Status(1, ss.str()), trades);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing crypto trades JSON"), trades);
-    }
-
-    if (d.HasMember("trades") && d["trades"].IsObject()) {
-        for (auto& m : d["trades"].GetObject()) {
-            CryptoTrade trade;
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = trade.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, trades);
-            }
-            trades[m.name.GetString()] = trade;
-        }
-    }
-
-    return std::make_pair(Status(), trades);
+    Status status = decodeSymbolMapBody(resp->body, "trades", trades,
+                                        "Received parse error when deserializing crypto trades JSON");
+    return std::make_pair(status, std::move(trades));
 }
 
 std::pair<Status, CryptoQuote> Client::getLatestCryptoQuote(
@@ -2245,8 +2573,7 @@ std::pair<Status, CryptoQuote> Client::getLatestCryptoQuote(
 
     std::string url = makeCryptoUrl("/latest/quotes?symbols=" + symbol, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2260,27 +2587,30 @@ std::pair<Status, CryptoQuote> Client::getLatestCryptoQuote(
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing crypto quote JSON"), quote);
     }
 
     if (d.HasMember("quotes") && d["quotes"].IsObject()) {
         auto& quotes_obj = d["quotes"];
         if (quotes_obj.HasMember(symbol.c_str()) && quotes_obj[symbol.c_str()].IsObject()) {
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            quotes_obj[symbol.c_str()].Accept(writer);
-            return std::make_pair(quote.fromJSON(s.GetString()), quote);
+            return std::make_pair(detail::decode(quotes_obj[symbol.c_str()], quote), quote);
         }
     }
 
     return std::make_pair(Status(1, "Quote not found for symbol"), quote);
 }
 
-std::pair<Status, std::map<std::string, CryptoQuote>> Client::getLatestCryptoQuotes(
+std::pair<Status, SymbolMap<CryptoQuote>> Client::getLatestCryptoQuotes(
     const std::vector<std::string>& symbols,
     CryptoFeed feed) const {
-    std::map<std::string, CryptoQuote> quotes;
+    SymbolMap<CryptoQuote> quotes;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<CryptoQuote>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestCryptoQuotes(chunk, feed); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -2292,8 +2622,7 @@ std::pair<Status, std::map<std::string, CryptoQuote>> Client::getLatestCryptoQuo
 
     std::string url = makeCryptoUrl("/latest/quotes?symbols=" + symbols_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2306,25 +2635,9 @@ std::pair<Status, std::map<std::string, CryptoQuote>> Client::getLatestCryptoQuo
         return std::make_pair(Status(1, ss.str()), quotes);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing crypto quotes JSON"), quotes);
-    }
-
-    if (d.HasMember("quotes") && d["quotes"].IsObject()) {
-        for (auto& m : d["quotes"].GetObject()) {
-            CryptoQuote quote;
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = quote.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, quotes);
-            }
-            quotes[m.name.GetString()] = quote;
-        }
-    }
-
-    return std::make_pair(Status(), quotes);
+    Status status = decodeSymbolMapBody(resp->body, "quotes", quotes,
+                                        "Received parse error when deserializing crypto quotes JSON");
+    return std::make_pair(status, std::move(quotes));
 }
 
 std::pair<Status, CryptoBar> Client::getLatestCryptoBar(
@@ -2334,8 +2647,7 @@ std::pair<Status, CryptoBar> Client::getLatestCryptoBar(
 
     std::string url = makeCryptoUrl("/latest/bars?symbols=" + symbol, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2349,27 +2661,30 @@ std::pair<Status, CryptoBar> Client::getLatestCryptoBar(
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing crypto bar JSON"), bar);
     }
 
     if (d.HasMember("bars") && d["bars"].IsObject()) {
         auto& bars_obj = d["bars"];
         if (bars_obj.HasMember(symbol.c_str()) && bars_obj[symbol.c_str()].IsObject()) {
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            bars_obj[symbol.c_str()].Accept(writer);
-            return std::make_pair(bar.fromJSON(s.GetString()), bar);
+            return std::make_pair(detail::decode(bars_obj[symbol.c_str()], bar), bar);
         }
     }
 
     return std::make_pair(Status(1, "Bar not found for symbol"), bar);
 }
 
-std::pair<Status, std::map<std::string, CryptoBar>> Client::getLatestCryptoBars(
+std::pair<Status, SymbolMap<CryptoBar>> Client::getLatestCryptoBars(
     const std::vector<std::string>& symbols,
     CryptoFeed feed) const {
-    std::map<std::string, CryptoBar> bars;
+    SymbolMap<CryptoBar> bars;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<CryptoBar>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getLatestCryptoBars(chunk, feed); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -2381,8 +2696,7 @@ std::pair<Status, std::map<std::string, CryptoBar>> Client::getLatestCryptoBars(
 
     std::string url = makeCryptoUrl("/latest/bars?symbols=" + symbols_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2395,25 +2709,9 @@ std::pair<Status, std::map<std::string, CryptoBar>> Client::getLatestCryptoBars(
         return std::make_pair(Status(1, ss.str()), bars);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing crypto bars JSON"), bars);
-    }
-
-    if (d.HasMember("bars") && d["bars"].IsObject()) {
-        for (auto& m : d["bars"].GetObject()) {
-            CryptoBar bar;
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = bar.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, bars);
-            }
-            bars[m.name.GetString()] = bar;
-        }
-    }
-
-    return std::make_pair(Status(), bars);
+    Status status = decodeSymbolMapBody(resp->body, "bars", bars,
+                                        "Received parse error when deserializing crypto bars JSON");
+    return std::make_pair(status, std::move(bars));
 }
 
 std::pair<Status, CryptoSnapshot> Client::getCryptoSnapshot(
@@ -2423,8 +2721,7 @@ std::pair<Status, CryptoSnapshot> Client::getCryptoSnapshot(
 
     std::string url = makeCryptoUrl("/snapshots?symbols=" + symbol, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2438,27 +2735,30 @@ std::pair<Status, CryptoSnapshot> Client::getCryptoSnapshot(
     }
 
     rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
+    if (d.ParseInsitu(resp->body.data()).HasParseError()) {
         return std::make_pair(Status(1, "Received parse error when deserializing crypto snapshot JSON"), snapshot);
     }
 
     if (d.HasMember("snapshots") && d["snapshots"].IsObject()) {
         auto& snapshots_obj = d["snapshots"];
         if (snapshots_obj.HasMember(symbol.c_str()) && snapshots_obj[symbol.c_str()].IsObject()) {
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            snapshots_obj[symbol.c_str()].Accept(writer);
-            return std::make_pair(snapshot.fromJSON(s.GetString()), snapshot);
+            return std::make_pair(detail::decode(snapshots_obj[symbol.c_str()], snapshot), snapshot);
         }
     }
 
     return std::make_pair(Status(1, "Snapshot not found for symbol"), snapshot);
 }
 
-std::pair<Status, std::map<std::string, CryptoSnapshot>> Client::getCryptoSnapshots(
+std::pair<Status, SymbolMap<CryptoSnapshot>> Client::getCryptoSnapshots(
     const std::vector<std::string>& symbols,
     CryptoFeed feed) const {
-    std::map<std::string, CryptoSnapshot> snapshots;
+    SymbolMap<CryptoSnapshot> snapshots;
+
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutLatest<CryptoSnapshot>(
+            symbols, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk) { return getCryptoSnapshots(chunk, feed); });
+    }
 
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
@@ -2470,8 +2770,7 @@ std::pair<Status, std::map<std::string, CryptoSnapshot>> Client::getCryptoSnapsh
 
     std::string url = makeCryptoUrl("/snapshots?symbols=" + symbols_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2484,25 +2783,9 @@ std::pair<Status, std::map<std::string, CryptoSnapshot>> Client::getCryptoSnapsh
         return std::make_pair(Status(1, ss.str()), snapshots);
     }
 
-    rapidjson::Document d;
-    if (d.Parse(resp->body.c_str()).HasParseError()) {
-        return std::make_pair(Status(1, "Received parse error when deserializing crypto snapshots JSON"), snapshots);
-    }
-
-    if (d.HasMember("snapshots") && d["snapshots"].IsObject()) {
-        for (auto& m : d["snapshots"].GetObject()) {
-            CryptoSnapshot snapshot;
-            rapidjson::StringBuffer s;
-            rapidjson::Writer<rapidjson::StringBuffer> writer(s);
-            m.value.Accept(writer);
-            if (Status status = snapshot.fromJSON(s.GetString()); !status.ok()) {
-                return std::make_pair(status, snapshots);
-            }
-            snapshots[m.name.GetString()] = snapshot;
-        }
-    }
-
-    return std::make_pair(Status(), snapshots);
+    Status status = decodeSymbolMapBody(resp->body, "snapshots", snapshots,
+                                        "Received parse error when deserializing crypto snapshots JSON");
+    return std::make_pair(status, std::move(snapshots));
 }
 
 std::pair<Status, CryptoBars> Client::getCryptoBars(
@@ -2515,6 +2798,15 @@ std::pair<Status, CryptoBars> Client::getCryptoBars(
     CryptoFeed feed) const {
     CryptoBars crypto_bars;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<CryptoBars>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getCryptoBars(chunk, start, end, timeframe, chunk_limit, chunk_token, feed);
+            },
+            [](CryptoBars& into, CryptoBars& from) { into.bars.merge(from.bars); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -2540,8 +2832,7 @@ std::pair<Status, CryptoBars> Client::getCryptoBars(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = makeCryptoUrl("/bars?" + query_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2554,7 +2845,7 @@ std::pair<Status, CryptoBars> Client::getCryptoBars(
         return std::make_pair(Status(1, ss.str()), crypto_bars);
     }
 
-    return std::make_pair(crypto_bars.fromJSON(resp->body), crypto_bars);
+    return std::make_pair(crypto_bars.fromJSON(std::move(resp->body)), crypto_bars);
 }
 
 std::pair<Status, CryptoTrades> Client::getCryptoTrades(
@@ -2566,6 +2857,15 @@ std::pair<Status, CryptoTrades> Client::getCryptoTrades(
     CryptoFeed feed) const {
     CryptoTrades crypto_trades;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<CryptoTrades>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getCryptoTrades(chunk, start, end, chunk_limit, chunk_token, feed);
+            },
+            [](CryptoTrades& into, CryptoTrades& from) { into.trades.merge(from.trades); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -2591,8 +2891,7 @@ std::pair<Status, CryptoTrades> Client::getCryptoTrades(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = makeCryptoUrl("/trades?" + query_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2605,7 +2904,7 @@ std::pair<Status, CryptoTrades> Client::getCryptoTrades(
         return std::make_pair(Status(1, ss.str()), crypto_trades);
     }
 
-    return std::make_pair(crypto_trades.fromJSON(resp->body), crypto_trades);
+    return std::make_pair(crypto_trades.fromJSON(std::move(resp->body)), crypto_trades);
 }
 
 std::pair<Status, CryptoQuotes> Client::getCryptoQuotes(
@@ -2617,6 +2916,15 @@ std::pair<Status, CryptoQuotes> Client::getCryptoQuotes(
     CryptoFeed feed) const {
     CryptoQuotes crypto_quotes;
 
+    if (detail::shouldChunk(symbols, environment_.getSymbolChunkConfig())) {
+        return detail::fanOutPages<CryptoQuotes>(
+            symbols, page_token, limit, environment_.getSymbolChunkConfig(),
+            [&](const std::vector<std::string>& chunk, const std::string& chunk_token, unsigned int chunk_limit) {
+                return getCryptoQuotes(chunk, start, end, chunk_limit, chunk_token, feed);
+            },
+            [](CryptoQuotes& into, CryptoQuotes& from) { into.quotes.merge(from.quotes); });
+    }
+
     std::string symbols_string;
     for (size_t i = 0; i < symbols.size(); ++i) {
         symbols_string += symbols[i];
@@ -2642,8 +2950,7 @@ std::pair<Status, CryptoQuotes> Client::getCryptoQuotes(
     std::string query_string = httplib::detail::params_to_query_str(params);
     std::string url = makeCryptoUrl("/quotes?" + query_string, feed);
 
-    httplib::SSLClient client(environment_.getDataHost());
-    httplib::Result resp = client.Get(url.c_str(), makeHeaders(environment_));
+    httplib::Result resp = sendGet(environment_.getDataOrigin(), url, environment_, in_flight_.get());
     if (!resp) {
         std::ostringstream ss;
         ss << "Call to " << url << " returned an empty response";
@@ -2656,7 +2963,7 @@ std::pair<Status, CryptoQuotes> Client::getCryptoQuotes(
         return std::make_pair(Status(1, ss.str()), crypto_quotes);
     }
 
-    return std::make_pair(crypto_quotes.fromJSON(resp->body), crypto_quotes);
+    return std::make_pair(crypto_quotes.fromJSON(std::move(resp->body)), crypto_quotes);
 }
 
 }  // namespace alpaca::markets
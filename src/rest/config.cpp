@@ -36,6 +36,15 @@ std::string extractHostname(const std::string& url) {
     return host;
 }
 
+// Helper to extract scheme://host[:port] from URL, dropping any path
+std::string extractOrigin(const std::string& url) {
+    std::size_t host_start = url.find("://");
+    if (host_start == std::string::npos) {
+        return "https://" + url.substr(0, url.find('/'));
+    }
+    return url.substr(0, url.find('/', host_start + 3));
+}
+
 // Helper to ensure URL has scheme
 std::string ensureHttpsScheme(const std::string& url) {
     if (url.empty()) return url;
@@ -142,4 +151,12 @@ std::string Environment::getDataHost() const {
     return extractHostname(data_base_url_);
 }
 
+std::string Environment::getTradingOrigin() const {
+    return extractOrigin(trading_base_url_);
+}
+
+std::string Environment::getDataOrigin() const {
+    return extractOrigin(data_base_url_);
+}
+
 }  // namespace alpaca::markets
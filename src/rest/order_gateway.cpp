@@ -0,0 +1,185 @@
+#include <alpaca/markets/order_gateway.hpp>
+
+#include <httplib.h>
+
+#include <charconv>
+#include <optional>
+#include <sstream>
+
+#include "../detail/order_submit.hpp"
+
+namespace alpaca::markets {
+
+namespace {
+/**
+ * @brief Parse a price with the same rule as OrderRequest's Decimals; it must also be positive.
+ */
+std::optional<Decimal> parsePrice(std::string_view value) {
+    std::optional<Decimal> price = Decimal::parse(value);
+    if (!price || price->isNegative() || price->isZero()) {
+        return std::nullopt;
+    }
+    return price;
+}
+
+// Printable ASCII which needs no escaping inside a JSON string
+bool isPlainString(std::string_view value) {
+    for (char c : value) {
+        if (c < 0x20 || c > 0x7e || c == '"' || c == '\\') {
+            return false;
+        }
+    }
+    return true;
+}
+
+void appendEscaped(std::string& out, std::string_view value) {
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+}
+
+void appendStringField(std::string& out, std::string_view key_and_quote, std::string_view value) {
+    out += key_and_quote;
+    out += value;
+    out += '"';
+}
+
+void appendDecimalField(std::string& out, std::string_view key_and_quote, const Decimal& value) {
+    out += key_and_quote;
+    value.appendTo(out);
+    out += '"';
+}
+}  // namespace
+
+OrderTemplate::OrderTemplate(const std::string& symbol, OrderSide side, OrderType type, OrderTimeInForce tif,
+                             bool extended_hours)
+    : has_unknown_(side == OrderSide::Unknown || type == OrderType::Unknown || tif == OrderTimeInForce::Unknown) {
+    prefix_ = "{\"symbol\":\"";
+    appendEscaped(prefix_, symbol);
+    prefix_ += "\",\"side\":\"" + orderSideToString(side) + "\",\"type\":\"" + orderTypeToString(type) +
+               "\",\"time_in_force\":\"" + orderTimeInForceToString(tif) + "\"";
+    if (extended_hours) {
+        prefix_ += ",\"extended_hours\":true";
+    }
+}
+
+Status OrderTemplate::render(std::string& out, int quantity, std::string_view limit_price,
+                             std::string_view stop_price, std::string_view client_order_id) const {
+    if (has_unknown_) {
+        return Status(1, "Order side, type and time_in_force must not be Unknown");
+    }
+    if (quantity <= 0) {
+        return Status(1, "Order quantity must be positive");
+    }
+    std::optional<Decimal> limit;
+    if (!limit_price.empty() && !(limit = parsePrice(limit_price))) {
+        return Status(1, "Limit price must be a positive decimal: " + std::string(limit_price));
+    }
+    std::optional<Decimal> stop;
+    if (!stop_price.empty() && !(stop = parsePrice(stop_price))) {
+        return Status(1, "Stop price must be a positive decimal: " + std::string(stop_price));
+    }
+    if (!isPlainString(client_order_id)) {
+        return Status(1, "Client order id must be printable ASCII without quotes or backslashes");
+    }
+
+    out.assign(prefix_);
+    char digits[16];
+    auto [end, ec] = std::to_chars(digits, digits + sizeof(digits), quantity);
+    appendStringField(out, ",\"qty\":\"", std::string_view(digits, static_cast<std::size_t>(end - digits)));
+    if (limit) {
+        appendDecimalField(out, ",\"limit_price\":\"", *limit);
+    }
+    if (stop) {
+        appendDecimalField(out, ",\"stop_price\":\"", *stop);
+    }
+    if (!client_order_id.empty()) {
+        appendStringField(out, ",\"client_order_id\":\"", client_order_id);
+    }
+    out += '}';
+    return Status();
+}
+
+struct OrderGateway::Impl {
+    Impl(const Environment& env, const std::string& base_url) : environment(env), client(base_url) {}
+
+    Environment environment;
+    httplib::Client client;
+    httplib::Headers headers;
+    std::string body;
+};
+
+OrderGateway::OrderGateway(const Environment& environment)
+    : OrderGateway(environment, environment.getTradingOrigin()) {}
+
+OrderGateway::OrderGateway(const Environment& environment, const std::string& base_url)
+    : impl_(std::make_unique<Impl>(environment, base_url)) {
+    impl_->headers = {
+        {"APCA-API-KEY-ID", environment.getAPIKeyID()},
+        {"APCA-API-SECRET-KEY", environment.getAPISecretKey()},
+    };
+    if (!environment.getCompressionConfig().trading_api) {
+        // Otherwise httplib, when built with compression support, asks for gzip on every order
+        impl_->headers.emplace("Accept-Encoding", "identity");
+    }
+    // Each attempt is bounded like Client's, so a slow answer is resolved within OrderSubmitConfig::budget
+    detail::configureOrderClient(impl_->client, environment);
+    impl_->client.set_tcp_nodelay(true);
+    // Order bodies are a few hundred bytes; sizing once keeps render() allocation-free
+    impl_->body.reserve(512);
+}
+
+OrderGateway::~OrderGateway() = default;
+OrderGateway::OrderGateway(OrderGateway&&) noexcept = default;
+OrderGateway& OrderGateway::operator=(OrderGateway&&) noexcept = default;
+
+Status OrderGateway::warmUp() {
+    httplib::Result resp = impl_->client.Get("/v2/clock", impl_->headers);
+    if (!resp) {
+        return Status(1, "Call to /v2/clock returned an empty response");
+    }
+    // The connection is open either way, but a 401/403 means every order would be rejected too
+    if (resp->status != 200) {
+        std::ostringstream ss;
+        ss << "Call to /v2/clock returned an HTTP " << resp->status << ": " << resp->body;
+        return Status(1, ss.str());
+    }
+    return Status();
+}
+
+std::pair<Status, Order> OrderGateway::submit(const OrderTemplate& order_template, int quantity,
+                                              std::string_view limit_price, std::string_view stop_price,
+                                              std::string_view client_order_id) {
+    ClientOrderId generated;
+    if (client_order_id.empty() && impl_->environment.getGenerateClientOrderIds()) {
+        generated = ClientOrderIdGenerator::global().next();
+        client_order_id = generated.view();
+    }
+    if (Status status = order_template.render(impl_->body, quantity, limit_price, stop_price, client_order_id);
+        !status.ok()) {
+        return std::make_pair(status, Order());
+    }
+    return post(client_order_id);
+}
+
+std::pair<Status, Order> OrderGateway::submit(const OrderRequest& request) {
+    ClientOrderId generated;
+    std::string_view client_order_id;
+    if (Status status = detail::renderOrderRequest(impl_->environment, request, impl_->body, generated,
+                                                   client_order_id);
+        !status.ok()) {
+        return std::make_pair(status, Order());
+    }
+    return post(client_order_id);
+}
+
+std::pair<Status, Order> OrderGateway::post(std::string_view client_order_id) {
+    int http_status = 0;
+    return detail::submitOrderBody(impl_->client, impl_->headers, impl_->body, client_order_id, impl_->environment,
+                                   nullptr, nullptr, http_status);
+}
+
+}  // namespace alpaca::markets
@@ -0,0 +1,135 @@
+#include <alpaca/markets/asset_universe.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+Asset makeAsset(const std::string& symbol, bool tradable, bool shortable, bool easy_to_borrow = false) {
+    Asset asset;
+    asset.symbol = symbol;
+    asset.tradable = tradable;
+    asset.shortable = shortable;
+    asset.easy_to_borrow = easy_to_borrow;
+    asset.marginable = tradable;
+    return asset;
+}
+
+}  // namespace
+
+TEST(AssetMaskTest, SetTestAndCount) {
+    AssetMask mask(130);
+    mask.set(0);
+    mask.set(64);
+    mask.set(129);
+    EXPECT_TRUE(mask.test(64));
+    EXPECT_FALSE(mask.test(65));
+    EXPECT_EQ(mask.count(), 3u);
+
+    std::vector<std::size_t> indices;
+    mask.forEach([&](std::size_t index) { indices.push_back(index); });
+    EXPECT_EQ(indices, (std::vector<std::size_t>{0, 64, 129}));
+
+    mask.set(64, false);
+    EXPECT_EQ(mask.count(), 2u);
+}
+
+TEST(AssetMaskTest, AllSetIgnoresPaddingBits) {
+    AssetMask mask(70, true);
+    EXPECT_EQ(mask.count(), 70u);
+}
+
+TEST(AssetMaskTest, Combine) {
+    AssetMask a(100);
+    AssetMask b(100);
+    a.set(1);
+    a.set(2);
+    b.set(2);
+    b.set(3);
+    EXPECT_EQ((a & b).count(), 1u);
+    EXPECT_EQ((a | b).count(), 3u);
+    EXPECT_EQ(AssetMask(a).subtract(b).count(), 1u);
+    EXPECT_TRUE(AssetMask(a).subtract(b).test(1));
+}
+
+TEST(AssetUniverseTest, LookupBySymbol) {
+    AssetUniverse universe({makeAsset("AAPL", true, true), makeAsset("MSFT", true, false)});
+    EXPECT_EQ(universe.size(), 2u);
+    EXPECT_EQ(universe.indexOf("MSFT"), 1u);
+    EXPECT_EQ(universe.indexOf("TSLA"), AssetUniverse::npos);
+    ASSERT_NE(universe.find("AAPL"), nullptr);
+    EXPECT_TRUE(universe.find("AAPL")->shortable);
+    EXPECT_EQ(universe.find("TSLA"), nullptr);
+}
+
+TEST(AssetUniverseTest, SelectByFlags) {
+    AssetUniverse universe({
+        makeAsset("AAPL", true, true, true),
+        makeAsset("MSFT", true, true, false),
+        makeAsset("OTC", false, false),
+        makeAsset("GME", true, false),
+    });
+
+    EXPECT_EQ(universe.select({AssetFlag::Tradable}).count(), 3u);
+    EXPECT_EQ(universe.symbols(universe.select({AssetFlag::Tradable, AssetFlag::Shortable})),
+              (std::vector<std::string>{"AAPL", "MSFT"}));
+    EXPECT_EQ(universe.symbols(universe.select({AssetFlag::Shortable, AssetFlag::EasyToBorrow})),
+              (std::vector<std::string>{"AAPL"}));
+    EXPECT_EQ(universe.select({}).count(), 4u);
+    EXPECT_EQ(universe.column(AssetFlag::Marginable).count(), 3u);
+}
+
+TEST(AssetUniverseTest, RefreshKeepsIndices) {
+    AssetUniverse universe({makeAsset("AAPL", true, true), makeAsset("MSFT", true, true), makeAsset("XYZ", true, true)});
+
+    auto stats = universe.refresh({makeAsset("MSFT", true, false), makeAsset("AAPL", true, true),
+                                   makeAsset("NVDA", true, true)});
+    EXPECT_EQ(stats.added, 1u);
+    EXPECT_EQ(stats.updated, 2u);
+    EXPECT_EQ(stats.removed, 1u);
+
+    EXPECT_EQ(universe.indexOf("AAPL"), 0u);
+    EXPECT_EQ(universe.indexOf("MSFT"), 1u);
+    EXPECT_EQ(universe.indexOf("XYZ"), 2u);
+    EXPECT_EQ(universe.indexOf("NVDA"), 3u);
+
+    // The delisted asset stays indexed but drops out of every screen
+    EXPECT_FALSE(universe.active().test(2));
+    EXPECT_FALSE(universe.column(AssetFlag::Tradable).test(2));
+    EXPECT_EQ(universe.symbols(universe.select({AssetFlag::Shortable})), (std::vector<std::string>{"AAPL", "NVDA"}));
+
+    // Returning assets become active again
+    stats = universe.refresh({makeAsset("XYZ", true, true)});
+    EXPECT_EQ(stats.updated, 1u);
+    EXPECT_EQ(stats.removed, 3u);
+    EXPECT_EQ(universe.symbols(universe.active()), (std::vector<std::string>{"XYZ"}));
+}
+
+TEST(AssetUniverseTest, DuplicateSymbolsInOneResult) {
+    AssetUniverse universe({makeAsset("AAPL", false, false), makeAsset("AAPL", true, true)});
+    EXPECT_EQ(universe.size(), 1u);
+    EXPECT_TRUE(universe.select({AssetFlag::Shortable}).test(0));
+}
+
+TEST(AssetUniverseTest, Upsert) {
+    AssetUniverse universe({makeAsset("AAPL", true, true)});
+    EXPECT_EQ(universe.upsert(makeAsset("AAPL", true, false)), 0u);
+    EXPECT_FALSE(universe.column(AssetFlag::Shortable).test(0));
+
+    EXPECT_EQ(universe.upsert(makeAsset("TSLA", true, true)), 1u);
+    EXPECT_EQ(universe.symbols(universe.select({AssetFlag::Shortable})), (std::vector<std::string>{"TSLA"}));
+}
+
+TEST(AssetUniverseTest, LargeUniverse) {
+    std::vector<Asset> assets;
+    for (int i = 0; i < 30000; ++i) {
+        assets.push_back(makeAsset("S" + std::to_string(i), i % 2 == 0, i % 3 == 0));
+    }
+    AssetUniverse universe(std::move(assets));
+    EXPECT_EQ(universe.select({AssetFlag::Tradable, AssetFlag::Shortable}).count(), 5000u);
+    EXPECT_EQ(universe.indexOf("S29999"), 29999u);
+}
@@ -82,3 +82,40 @@ TEST(BarTest, FromJSONParseError) {
     Status status = bar.fromJSON("invalid json");
     EXPECT_FALSE(status.ok());
 }
+
+TEST(BarsTest, FromJSONSkipsMistypedFields) {
+    // Both JSON backends must leave mistyped members untouched and ignore unknown keys
+    const std::string json = R"({
+        "bars": {
+            "AAPL": [{"t": "2023-01-01T09:30:00Z", "o": "150.25", "v": 1.5, "n": -3, "c": 151.75, "extra": {"k": [1]}}],
+            "MSFT": null
+        },
+        "next_page_token": null
+    })";
+
+    Bars bars;
+    Status status = bars.fromJSON(json);
+
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(bars.bars["AAPL"].size(), 1u);
+    const Bar& bar = bars.bars["AAPL"][0];
+    EXPECT_EQ(bar.timestamp, "2023-01-01T09:30:00Z");
+    EXPECT_DOUBLE_EQ(bar.open_price, 0.0);
+    EXPECT_EQ(bar.volume, 0u);
+    EXPECT_EQ(bar.trade_count, 0u);
+    EXPECT_DOUBLE_EQ(bar.close_price, 151.75);
+    EXPECT_EQ(bars.bars.count("MSFT"), 1u);
+    EXPECT_TRUE(bars.bars["MSFT"].empty());
+    EXPECT_TRUE(bars.next_page_token.empty());
+}
+
+TEST(BarsTest, FromJSONRejectsMalformedInput) {
+    Bars non_object_bar;
+    EXPECT_FALSE(non_object_bar.fromJSON(R"({"bars": {"AAPL": [1]}})").ok());
+
+    Bars trailing;
+    EXPECT_FALSE(trailing.fromJSON(R"({"bars": {}} trailing)").ok());
+
+    Bars not_an_object;
+    EXPECT_FALSE(not_an_object.fromJSON("[]").ok());
+}
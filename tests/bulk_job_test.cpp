@@ -0,0 +1,246 @@
+#include <alpaca/markets/bulk_job.hpp>
+#include <alpaca/markets/columns.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+class BulkJobTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = (std::filesystem::temp_directory_path() /
+                 ("alpaca_bulk_job_test_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)) + ".checkpoint"))
+                    .string();
+        std::filesystem::remove(path_);
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    std::string path_;
+};
+
+struct IntSink {
+    std::vector<int> items;
+    void append(std::vector<int>&& page) { items.insert(items.end(), page.begin(), page.end()); }
+};
+
+struct TruncatingSink : IntSink {
+    void truncate(uint64_t rows) { items.resize(rows); }
+    [[nodiscard]] std::size_t size() const { return items.size(); }
+};
+
+// Five pages of two items each; fails `failures` times at `fail_page` if set.
+struct FakeEndpoint {
+    int fail_page = -1;
+    int failures = 0;
+    int calls = 0;
+    std::string error = "HTTP 503";
+
+    std::pair<Status, Page<int>> operator()(const std::string& token) {
+        ++calls;
+        int index = token.empty() ? 0 : std::stoi(token);
+        if (index == fail_page && failures > 0) {
+            --failures;
+            return std::make_pair(Status(1, error), Page<int>{});
+        }
+        Page<int> page;
+        page.items = {index * 2, index * 2 + 1};
+        if (index < 4) {
+            page.next_page_token = std::to_string(index + 1);
+        }
+        return std::make_pair(Status(), page);
+    }
+};
+
+RetryConfig fastRetries(int retries) {
+    RetryConfig retry;
+    retry.max_retries = retries;
+    retry.initial_delay = std::chrono::milliseconds(0);
+    return retry;
+}
+
+std::string intKey(const int& i) {
+    return std::to_string(i);
+}
+
+}  // namespace
+
+TEST_F(BulkJobTest, CheckpointRoundTrip) {
+    Checkpoint missing;
+    ASSERT_TRUE(loadCheckpoint(path_, missing).ok());
+    EXPECT_TRUE(missing.page_token.empty());
+    EXPECT_EQ(missing.rows, 0u);
+
+    Checkpoint saved{"trades AAPL 2024-01-01 2024-02-01", "U1lNfDIwMjQ=", 12345, "2024-01-02T14:30:00Z/77", false};
+    ASSERT_TRUE(saveCheckpoint(path_, saved).ok());
+    Checkpoint loaded;
+    ASSERT_TRUE(loadCheckpoint(path_, loaded).ok());
+    EXPECT_EQ(loaded.query, saved.query);
+    EXPECT_EQ(loaded.page_token, saved.page_token);
+    EXPECT_EQ(loaded.rows, 12345u);
+    EXPECT_EQ(loaded.last_key, saved.last_key);
+    EXPECT_FALSE(loaded.complete);
+    EXPECT_FALSE(std::filesystem::exists(path_ + ".tmp"));
+
+    EXPECT_FALSE(saveCheckpoint(path_ + ".missing/checkpoint", saved).ok());
+}
+
+TEST_F(BulkJobTest, RunsToCompletionAndRetriesTransientErrors) {
+    FakeEndpoint endpoint{2, 2};
+    BulkJob<int> job(path_, std::ref(endpoint), intKey, fastRetries(3));
+    IntSink sink;
+    ASSERT_TRUE(job.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(endpoint.calls, 7);
+    EXPECT_TRUE(job.checkpoint().complete);
+    EXPECT_EQ(job.checkpoint().rows, 10u);
+
+    // A completed job does nothing when run again
+    IntSink again;
+    EXPECT_TRUE(job.run(again).ok());
+    EXPECT_TRUE(again.items.empty());
+}
+
+TEST_F(BulkJobTest, RetriesOnlyErrorsARetryCanFix) {
+    EXPECT_EQ(httpStatusOf(Status(1, "Call to /v2/stocks/X/trades returned an HTTP 404: not found")), 404);
+    EXPECT_EQ(httpStatusOf(Status(1, "Call to /v2/orders failed: too many requests (HTTP 429, Code 42910000)")), 429);
+    EXPECT_EQ(httpStatusOf(Status(1, "Call to /v2/stocks/X/trades returned an empty response")), 0);
+    EXPECT_EQ(httpStatusOf(Status(1, "HTTP 5000 isn't a status")), 0);
+
+    FakeEndpoint rejected{1, 10, 0, "Call to /v2/stocks/X/trades returned an HTTP 422: invalid symbol"};
+    BulkJob<int> failed(path_, std::ref(rejected), intKey, fastRetries(3));
+    IntSink sink;
+    Status status = failed.run(sink);
+    EXPECT_EQ(status.getMessage(), rejected.error);
+    EXPECT_EQ(rejected.calls, 2);
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1}));
+
+    FakeEndpoint unreachable{1, 2, 0, "Call to /v2/stocks/X/trades returned an empty response"};
+    BulkJob<int> resumed(path_, std::ref(unreachable), intKey, fastRetries(3));
+    ASSERT_TRUE(resumed.run(sink).ok());
+    EXPECT_EQ(unreachable.calls, 6);
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(BulkJobTest, ResumesFromCheckpointAfterFailure) {
+    FakeEndpoint failing{3, 10};
+    BulkJob<int> first(path_, std::ref(failing), intKey, fastRetries(1));
+    IntSink sink;
+    EXPECT_FALSE(first.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(first.checkpoint().page_token, "3");
+
+    FakeEndpoint healthy;
+    BulkJob<int> second(path_, std::ref(healthy), intKey, fastRetries(1));
+    ASSERT_TRUE(second.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(healthy.calls, 2);
+}
+
+TEST_F(BulkJobTest, TruncatesSinkAndDropsRedeliveredItems) {
+    // Simulate a crash after page 1 reached the sink but before its checkpoint was saved
+    ASSERT_TRUE(saveCheckpoint(path_, Checkpoint{"", "1", 2, "1", false}).ok());
+    TruncatingSink sink;
+    sink.items = {0, 1, 2, 3};
+
+    FakeEndpoint endpoint;
+    BulkJob<int> job(path_, std::ref(endpoint), intKey, fastRetries(0));
+    ASSERT_TRUE(job.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(BulkJobTest, KeepsRowsTheSinkHeldBeforeTheJobStarted) {
+    // Another job already filled the sink; this one fails after two pages
+    TruncatingSink sink;
+    sink.items = {-2, -1};
+    FakeEndpoint failing{2, 10};
+    BulkJob<int> first(path_, std::ref(failing), intKey, fastRetries(0));
+    EXPECT_FALSE(first.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{-2, -1, 0, 1, 2, 3}));
+    EXPECT_EQ(first.checkpoint().sink_base, 2u);
+
+    // Page 2 reached the sink before the crash, but not the checkpoint
+    sink.items.insert(sink.items.end(), {4, 5});
+    FakeEndpoint healthy;
+    BulkJob<int> second(path_, std::ref(healthy), intKey, fastRetries(0));
+    ASSERT_TRUE(second.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{-2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(BulkJobTest, DropsOverlapWhenTokenRewindsIntoDeliveredItems) {
+    // Checkpoint says item 2 was the last delivered, but the saved token re-fetches page 1 (items 2 and 3)
+    ASSERT_TRUE(saveCheckpoint(path_, Checkpoint{"", "1", 3, "2", false}).ok());
+    IntSink sink;
+    sink.items = {0, 1, 2};
+
+    FakeEndpoint endpoint;
+    BulkJob<int> job(path_, std::ref(endpoint), intKey, fastRetries(0));
+    ASSERT_TRUE(job.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+    EXPECT_EQ(job.checkpoint().rows, 10u);
+}
+
+TEST_F(BulkJobTest, RejectsCheckpointForAnotherQuery) {
+    FakeEndpoint failing{3, 10};
+    BulkJob<int> first(path_, std::ref(failing), intKey, fastRetries(0), "ints AAPL");
+    IntSink sink;
+    EXPECT_FALSE(first.run(sink).ok());
+
+    FakeEndpoint other;
+    BulkJob<int> second(path_, std::ref(other), intKey, fastRetries(0), "ints MSFT");
+    IntSink other_sink;
+    Status status = second.run(other_sink);
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("ints AAPL"), std::string::npos);
+    EXPECT_EQ(other.calls, 0);
+    EXPECT_TRUE(other_sink.items.empty());
+
+    // The same query resumes
+    FakeEndpoint healthy;
+    BulkJob<int> third(path_, std::ref(healthy), intKey, fastRetries(0), "ints AAPL");
+    ASSERT_TRUE(third.run(sink).ok());
+    EXPECT_EQ(sink.items, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(BulkJobTest, ColumnsDiscardPageDeliveredAfterLastCheckpoint) {
+    // Page 1 (trades 2 and 3) reached the columns, then the process died before its checkpoint was saved
+    ASSERT_TRUE(saveCheckpoint(path_, Checkpoint{"", "1", 2, "1", false}).ok());
+    TradeColumns columns;
+    std::vector<Trade> delivered(4);
+    for (int i = 0; i < 4; ++i) {
+        delivered[i].id = static_cast<uint64_t>(i);
+    }
+    columns.append(std::move(delivered));
+
+    BulkJob<Trade> job(
+        path_,
+        [](const std::string& token) {
+            int index = token.empty() ? 0 : std::stoi(token);
+            Page<Trade> page;
+            page.items.resize(2);
+            page.items[0].id = static_cast<uint64_t>(index * 2);
+            page.items[1].id = static_cast<uint64_t>(index * 2 + 1);
+            if (index < 2) {
+                page.next_page_token = std::to_string(index + 1);
+            }
+            return std::make_pair(Status(), page);
+        },
+        [](const Trade& trade) { return std::to_string(trade.id); },
+        fastRetries(0));
+    ASSERT_TRUE(job.run(columns).ok());
+    EXPECT_EQ(columns.ids, (std::vector<uint64_t>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(columns.size(), 6u);
+    EXPECT_EQ(columns.timestamps.size(), 6u);
+
+    // Truncating to more rows than the columns hold leaves them alone
+    columns.truncate(10);
+    EXPECT_EQ(columns.size(), 6u);
+}
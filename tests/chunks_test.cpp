@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "detail/chunks.hpp"
+
+using namespace alpaca::markets;
+
+namespace {
+
+struct FakePage {
+    std::map<std::string, std::vector<int>> items;
+    std::string next_page_token;
+};
+
+SymbolChunkConfig chunksOf(std::size_t size) {
+    SymbolChunkConfig config;
+    config.max_symbols_per_request = size;
+    config.max_concurrency = 2;
+    return config;
+}
+
+}  // namespace
+
+TEST(ChunkSymbolsTest, DropsRepeatedSymbols) {
+    auto chunks = detail::chunkSymbols({"AAPL", "MSFT", "AAPL", "TSLA", "MSFT", "GOOG"}, 2);
+    ASSERT_EQ(chunks.size(), 2u);
+    EXPECT_EQ(chunks[0], (std::vector<std::string>{"AAPL", "MSFT"}));
+    EXPECT_EQ(chunks[1], (std::vector<std::string>{"TSLA", "GOOG"}));
+}
+
+TEST(ChunkSymbolsTest, ChunkLimitsAddUpToLimit) {
+    EXPECT_EQ(detail::chunkLimit(1000, 0, 3), 334u);
+    EXPECT_EQ(detail::chunkLimit(1000, 1, 3), 333u);
+    EXPECT_EQ(detail::chunkLimit(1000, 2, 3), 333u);
+    EXPECT_EQ(detail::chunkLimit(2, 2, 3), 1u);
+}
+
+TEST(ChunkSymbolsTest, PageTokensRoundTrip) {
+    std::vector<std::string> tokens{"abc", "", "def"};
+    std::string joined = detail::joinChunkTokens(tokens);
+    std::vector<std::string> parsed(3);
+    ASSERT_TRUE(detail::splitChunkTokens(joined, parsed));
+    EXPECT_EQ(parsed, tokens);
+
+    std::vector<std::string> wrong_count(2);
+    EXPECT_FALSE(detail::splitChunkTokens(joined, wrong_count));
+    EXPECT_FALSE(detail::splitChunkTokens("abc", parsed));
+}
+
+TEST(FanOutPagesTest, SplitsLimitAndKeepsRepeatedSymbolsWhole) {
+    std::mutex mutex;
+    std::vector<unsigned int> limits;
+    auto fetch = [&](const std::vector<std::string>& chunk, const std::string& token, unsigned int limit) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            limits.push_back(limit);
+        }
+        FakePage page;
+        for (const auto& symbol : chunk) {
+            page.items[symbol] = {token.empty() ? 1 : 2};
+        }
+        page.next_page_token = token.empty() ? "next" : "";
+        return std::make_pair(Status(), page);
+    };
+    auto merge = [](FakePage& into, FakePage& from) { into.items.merge(from.items); };
+
+    std::vector<std::string> symbols{"A", "B", "C", "A", "D", "E"};
+    auto [status, first] = detail::fanOutPages<FakePage>(symbols, "", 100, chunksOf(2), fetch, merge);
+    ASSERT_TRUE(status.ok());
+    EXPECT_EQ(first.items.size(), 5u);
+    EXPECT_EQ(first.items["A"], std::vector<int>{1});
+    EXPECT_EQ(first.next_page_token, "chunked:next,next,next");
+
+    // Every chunk asks for its share of the limit, not the whole limit
+    unsigned int total = 0;
+    for (unsigned int limit : limits) {
+        total += limit;
+    }
+    EXPECT_EQ(limits.size(), 3u);
+    EXPECT_EQ(total, 100u);
+
+    auto [next_status, second] =
+        detail::fanOutPages<FakePage>(symbols, first.next_page_token, 100, chunksOf(2), fetch, merge);
+    ASSERT_TRUE(next_status.ok());
+    EXPECT_EQ(second.items["E"], std::vector<int>{2});
+    EXPECT_TRUE(second.next_page_token.empty());
+}
+
+TEST(FanOutPagesTest, ReportsExceptionsAsErrors) {
+    auto fetch = [](const std::vector<std::string>& chunk, const std::string&, unsigned int) {
+        if (chunk.front() == "C") {
+            throw std::runtime_error("connection reset");
+        }
+        return std::make_pair(Status(), FakePage{});
+    };
+    auto merge = [](FakePage& into, FakePage& from) { into.items.merge(from.items); };
+
+    auto [status, page] = detail::fanOutPages<FakePage>({"A", "B", "C", "D"}, "", 100, chunksOf(2), fetch, merge);
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("connection reset"), std::string::npos);
+}
+
+TEST(RunWorkersTest, ReturnsFirstException) {
+    Status status = detail::runWorkers(3, [] { throw std::runtime_error("boom"); });
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("boom"), std::string::npos);
+    EXPECT_TRUE(detail::runWorkers(3, [] {}).ok());
+}
@@ -0,0 +1,85 @@
+#include <alpaca/markets/client_order_id.hpp>
+#include <alpaca/markets/config.hpp>
+#include <alpaca/markets/order_request.hpp>
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(ClientOrderIdTest, FixedWidthFormat) {
+    ClientOrderIdGenerator generator("strategy-1");
+    ClientOrderId first = generator.next();
+    ClientOrderId second = generator.next();
+
+    std::string_view id = first.view();
+    ASSERT_EQ(id.size(), 10 + 1 + ClientOrderIdGenerator::kTimeDigits + 1 + ClientOrderIdGenerator::kSequenceDigits);
+    EXPECT_EQ(id.substr(0, 11), "strategy-1-");
+    EXPECT_EQ(id.substr(id.size() - 9), "-00000001");
+    EXPECT_EQ(second.view().substr(second.size() - 9), "-00000002");
+    EXPECT_EQ(second.size(), first.size());
+}
+
+TEST(ClientOrderIdTest, RandomPrefixPerGenerator) {
+    ClientOrderIdGenerator a;
+    ClientOrderIdGenerator b;
+    EXPECT_EQ(a.prefix().size(), 8u);
+    EXPECT_NE(a.prefix(), b.prefix());
+    EXPECT_EQ(a.next().view().substr(0, 9), std::string(a.prefix()) + "-");
+}
+
+TEST(ClientOrderIdTest, PrefixIsSanitized) {
+    ClientOrderIdGenerator generator("my strat\"1");
+    EXPECT_EQ(generator.prefix(), "my_strat_1");
+
+    ClientOrderIdGenerator long_prefix(std::string(100, 'x'));
+    EXPECT_EQ(long_prefix.prefix().size(), ClientOrderIdGenerator::kMaxPrefixLength);
+    ClientOrderId id = long_prefix.next();
+    EXPECT_LE(id.size(), OrderRequest::kMaxClientOrderIdLength);
+}
+
+TEST(ClientOrderIdTest, UniqueAcrossThreads) {
+    ClientOrderIdGenerator generator;
+    constexpr int kThreads = 8;
+    constexpr int kPerThread = 5000;
+    std::vector<std::vector<std::string>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            ids[t].reserve(kPerThread);
+            for (int i = 0; i < kPerThread; ++i) {
+                ids[t].push_back(generator.next().str());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<std::string> unique;
+    for (const auto& batch : ids) {
+        unique.insert(batch.begin(), batch.end());
+    }
+    EXPECT_EQ(unique.size(), static_cast<std::size_t>(kThreads * kPerThread));
+}
+
+TEST(ClientOrderIdTest, RenderWithGeneratedId) {
+    ClientOrderIdGenerator generator("s");
+    ClientOrderId id = generator.next();
+    auto request = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+    std::string body;
+    ASSERT_TRUE(request.render(body, id.view()).ok());
+    EXPECT_NE(body.find("\"client_order_id\":\"" + id.str() + "\""), std::string::npos);
+    EXPECT_FALSE(request.render(body, "bad\"id").ok());
+}
+
+TEST(ClientOrderIdTest, GenerationIsOnByDefault) {
+    Environment env;
+    EXPECT_TRUE(env.getGenerateClientOrderIds());
+    env.setGenerateClientOrderIds(false);
+    EXPECT_FALSE(env.getGenerateClientOrderIds());
+}
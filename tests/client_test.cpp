@@ -0,0 +1,482 @@
+#include <alpaca/markets/client.hpp>
+#include <httplib.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+/**
+ * Runs a Client against a plain-HTTP httplib::Server on a local port. Tests register
+ * handlers on server_ and then call start().
+ */
+class LocalServerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        port_ = server_.bind_to_any_port("127.0.0.1");
+        ASSERT_GT(port_, 0);
+
+        // The ALPACA_MARKETS_* variables take precedence over custom names, so they must not leak in
+        for (const char* name : {"ALPACA_MARKETS_KEY_ID", "ALPACA_MARKETS_SECRET_KEY", "ALPACA_MARKETS_TRADING_URL",
+                                 "ALPACA_MARKETS_DATA_URL"}) {
+            ::unsetenv(name);
+        }
+        // Both hosts reach the same server, but under different names so the client tells them apart
+        std::string trading_url = "http://127.0.0.1:" + std::to_string(port_);
+        std::string data_url = "http://localhost:" + std::to_string(port_);
+        ::setenv("ALPACA_CLIENT_TEST_KEY_ID", "key", 1);
+        ::setenv("ALPACA_CLIENT_TEST_SECRET_KEY", "secret", 1);
+        ::setenv("ALPACA_CLIENT_TEST_TRADING_URL", trading_url.c_str(), 1);
+        ::setenv("ALPACA_CLIENT_TEST_DATA_URL", data_url.c_str(), 1);
+        environment_ = Environment("ALPACA_CLIENT_TEST_KEY_ID", "ALPACA_CLIENT_TEST_SECRET_KEY",
+                                   "ALPACA_CLIENT_TEST_TRADING_URL", "ALPACA_CLIENT_TEST_DATA_URL");
+        ASSERT_TRUE(environment_.parse().ok());
+    }
+
+    void TearDown() override {
+        server_.stop();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // The socket is already listening, so requests made before the thread accepts them just wait in the backlog
+    void start() {
+        thread_ = std::thread([this] { server_.listen_after_bind(); });
+    }
+
+    httplib::Server server_;
+    int port_ = -1;
+    std::thread thread_;
+    Environment environment_;
+};
+
+const std::string kWatchlistJSON = R"({
+    "id": "wl-1",
+    "account_id": "acct-1",
+    "name": "tech",
+    "assets": [],
+    "created_at": "2024-01-02T14:30:00Z",
+    "updated_at": "2024-01-02T14:30:00Z"
+})";
+
+}  // namespace
+
+TEST(EnvironmentOriginTest, KeepsSchemeAndPort) {
+    ::unsetenv("ALPACA_MARKETS_TRADING_URL");
+    ::unsetenv("ALPACA_MARKETS_DATA_URL");
+    ::setenv("ALPACA_ORIGIN_TEST_KEY_ID", "key", 1);
+    ::setenv("ALPACA_ORIGIN_TEST_SECRET_KEY", "secret", 1);
+    ::setenv("ALPACA_ORIGIN_TEST_TRADING_URL", "http://127.0.0.1:8080/v2", 1);
+    ::setenv("ALPACA_ORIGIN_TEST_DATA_URL", "data.example.com", 1);
+    Environment env("ALPACA_ORIGIN_TEST_KEY_ID", "ALPACA_ORIGIN_TEST_SECRET_KEY", "ALPACA_ORIGIN_TEST_TRADING_URL",
+                    "ALPACA_ORIGIN_TEST_DATA_URL");
+    ASSERT_TRUE(env.parse().ok());
+    EXPECT_EQ(env.getTradingOrigin(), "http://127.0.0.1:8080");
+    EXPECT_EQ(env.getTradingHost(), "127.0.0.1");
+    EXPECT_EQ(env.getDataOrigin(), "https://data.example.com");
+}
+
+TEST_F(LocalServerTest, WatchlistMutationsInvalidateCachedList) {
+    std::atomic<int> lists{0};
+    server_.Get("/v2/watchlists", [&](const httplib::Request&, httplib::Response& res) {
+        ++lists;
+        res.set_content("[" + kWatchlistJSON + "]", "application/json");
+    });
+    auto respond = [](const httplib::Request&, httplib::Response& res) {
+        res.set_content(kWatchlistJSON, "application/json");
+    };
+    server_.Post("/v2/watchlists", respond);
+    server_.Put("/v2/watchlists/wl-1", respond);
+    server_.Post("/v2/watchlists/wl-1", respond);
+    server_.Delete("/v2/watchlists/wl-1/AAPL", respond);
+    server_.Delete("/v2/watchlists/wl-1", [](const httplib::Request&, httplib::Response& res) { res.status = 204; });
+    start();
+
+    environment_.setCacheConfig(CacheConfig::defaultEnabled());
+    Client client(environment_);
+    ASSERT_TRUE(client.getWatchlists().first.ok());
+    ASSERT_TRUE(client.getWatchlists().first.ok());
+    EXPECT_EQ(lists, 1);
+
+    std::vector<std::function<Status()>> mutations = {
+        [&] { return client.createWatchlist("tech", {"AAPL"}).first; },
+        [&] { return client.updateWatchlist("wl-1", "tech", {"AAPL", "MSFT"}).first; },
+        [&] { return client.addSymbolToWatchlist("wl-1", "AAPL").first; },
+        [&] { return client.removeSymbolFromWatchlist("wl-1", "AAPL").first; },
+        [&] { return client.deleteWatchlist("wl-1"); },
+    };
+    int expected_lists = 1;
+    for (const auto& mutate : mutations) {
+        ASSERT_TRUE(mutate().ok());
+        auto [status, watchlists] = client.getWatchlists();
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(watchlists.size(), 1u);
+        EXPECT_EQ(watchlists[0].id, "wl-1");
+        EXPECT_EQ(lists, ++expected_lists);
+    }
+}
+
+TEST_F(LocalServerTest, CoalescedCacheRevalidatesWithETag) {
+    std::vector<std::string> conditions;
+    std::mutex mutex;
+    server_.Get("/v2/clock", [&](const httplib::Request& req, httplib::Response& res) {
+        std::string condition = req.get_header_value("If-None-Match");
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            conditions.push_back(condition);
+        }
+        if (condition == R"("v1")") {
+            res.status = 304;
+            return;
+        }
+        res.set_header("ETag", R"("v1")");
+        res.set_content(R"({"is_open": true, "timestamp": "2024-01-02T14:30:00Z"})", "application/json");
+    });
+    start();
+
+    // Cached responses expire at once, so every call after the first revalidates through the coalescing path
+    CacheConfig cache = CacheConfig::defaultEnabled();
+    cache.clock_ttl = std::chrono::milliseconds(1);
+    environment_.setCacheConfig(cache);
+    environment_.setRequestCoalescing(true);
+    Client client(environment_);
+    for (int i = 0; i < 3; ++i) {
+        auto [status, clock] = client.getClock();
+        ASSERT_TRUE(status.ok()) << status.getMessage();
+        EXPECT_TRUE(clock.is_open);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(conditions, (std::vector<std::string>{"", R"("v1")", R"("v1")"}));
+}
+
+TEST_F(LocalServerTest, TradingRequestsSendConfiguredAcceptEncoding) {
+    std::vector<std::string> encodings;
+    std::mutex mutex;
+    auto record = [&](const httplib::Request& req, httplib::Response& res) {
+        std::lock_guard<std::mutex> lock(mutex);
+        encodings.push_back(req.get_header_value("Accept-Encoding"));
+        res.set_content(kWatchlistJSON, "application/json");
+    };
+    server_.Post("/v2/watchlists", record);
+    server_.Put("/v2/watchlists/wl-1", record);
+    server_.Delete("/v2/watchlists/wl-1/AAPL", record);
+    start();
+
+    // Trading compression is off by default, so no request may ask for gzip
+    Client client(environment_);
+    ASSERT_TRUE(client.createWatchlist("tech", {"AAPL"}).first.ok());
+    ASSERT_TRUE(client.updateWatchlist("wl-1", "tech", {"MSFT"}).first.ok());
+    ASSERT_TRUE(client.removeSymbolFromWatchlist("wl-1", "AAPL").first.ok());
+    EXPECT_EQ(encodings, (std::vector<std::string>{"identity", "identity", "identity"}));
+}
+
+// Runs under whichever JSON backend the library was configured with
+TEST_F(LocalServerTest, MultiSymbolLatestAndSnapshotsDecode) {
+    server_.Get("/v2/stocks/trades/latest", [](const httplib::Request&, httplib::Response& res) {
+        res.set_content(R"({"trades": {"MSFT": {"p": 410.5, "s": 3, "t": "2024-01-02T14:30:00Z"},
+                                       "AAPL": {"p": 185.25, "s": 100, "c": ["@"]}}})",
+                        "application/json");
+    });
+    server_.Get("/v2/stocks/snapshots", [](const httplib::Request&, httplib::Response& res) {
+        res.set_content(R"({"AAPL": {"latestTrade": {"p": 185.25}, "dailyBar": {"c": 186.0, "v": 1000}}})",
+                        "application/json");
+    });
+    start();
+
+    Client client(environment_);
+    auto [trades_status, trades] = client.getLatestTrades({"AAPL", "MSFT"});
+    ASSERT_TRUE(trades_status.ok()) << trades_status.getMessage();
+    ASSERT_EQ(trades.size(), 2u);
+    EXPECT_EQ(trades.begin()->first, "AAPL");
+    EXPECT_DOUBLE_EQ(trades.at("AAPL").price, 185.25);
+    EXPECT_EQ(trades.at("AAPL").conditions, (std::vector<std::string>{"@"}));
+    EXPECT_EQ(trades.at("MSFT").size, 3u);
+
+    auto [snapshots_status, snapshots] = client.getSnapshots({"AAPL"});
+    ASSERT_TRUE(snapshots_status.ok()) << snapshots_status.getMessage();
+    ASSERT_EQ(snapshots.size(), 1u);
+    EXPECT_DOUBLE_EQ(snapshots.at("AAPL").latest_trade.price, 185.25);
+    EXPECT_EQ(snapshots.at("AAPL").daily_bar.volume, 1000u);
+}
+
+namespace {
+
+const std::string kOrderJSON = R"({"id": "order-1", "client_order_id": "cid-1", "symbol": "AAPL", "status": "new"})";
+
+/**
+ * Counts order submissions and by-client-order-id lookups, answering each from a scripted list of HTTP
+ * statuses (the last one repeats). A 200 is answered with kOrderJSON.
+ */
+class OrderSubmitTest : public LocalServerTest {
+protected:
+    void serve(std::vector<int> post_statuses, std::vector<int> lookup_statuses) {
+        auto respond = [](const std::vector<int>& statuses, std::atomic<int>& calls, httplib::Response& res) {
+            int call = calls++;
+            res.status = statuses[std::min<std::size_t>(call, statuses.size() - 1)];
+            if (res.status == 200) {
+                res.set_content(kOrderJSON, "application/json");
+            } else if (res.status == 422) {
+                res.set_content(R"({"code": 40010001, "message": "client_order_id must be unique"})",
+                                "application/json");
+            }
+        };
+        server_.Post("/v2/orders", [this, respond, post_statuses](const httplib::Request& req, httplib::Response& res) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                bodies_.push_back(req.body);
+            }
+            respond(post_statuses, posts_, res);
+        });
+        server_.Get("/v2/orders:by_client_order_id",
+                    [this, respond, lookup_statuses](const httplib::Request& req, httplib::Response& res) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex_);
+                            looked_up_.push_back(req.get_param_value("client_order_id"));
+                        }
+                        respond(lookup_statuses, lookups_, res);
+                    });
+        start();
+
+        OrderSubmitConfig config;
+        config.budget = std::chrono::milliseconds(500);
+        config.attempt_timeout = std::chrono::milliseconds(200);
+        config.lookup_interval = std::chrono::milliseconds(10);
+        config.max_resubmits = 1;
+        environment_.setOrderSubmitConfig(config);
+    }
+
+    std::pair<Status, Order> submit() {
+        Client client(environment_);
+        OrderRequest request = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+        request.client_order_id = "cid-1";
+        return client.submitOrder(request);
+    }
+
+    // Every request carried the same client_order_id
+    void expectSameClientOrderId() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& body : bodies_) {
+            EXPECT_NE(body.find(R"("client_order_id":"cid-1")"), std::string::npos) << body;
+        }
+        for (const auto& id : looked_up_) {
+            EXPECT_EQ(id, "cid-1");
+        }
+    }
+
+    std::atomic<int> posts_{0};
+    std::atomic<int> lookups_{0};
+    std::mutex mutex_;
+    std::vector<std::string> bodies_;
+    std::vector<std::string> looked_up_;
+};
+
+}  // namespace
+
+TEST_F(OrderSubmitTest, AmbiguousFailureFoundByLookup) {
+    serve({500}, {200});
+    auto [status, order] = submit();
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_EQ(order.id, "order-1");
+    EXPECT_EQ(posts_, 1);
+    EXPECT_EQ(lookups_, 1);
+    expectSameClientOrderId();
+}
+
+TEST_F(OrderSubmitTest, AmbiguousFailureFoundInOrderCache) {
+    // The trade_updates stream already reported the order, so no REST lookup is needed
+    serve({500}, {404});
+    OrderCache cache;
+    Order streamed;
+    streamed.id = "order-1";
+    streamed.client_order_id = "cid-1";
+    streamed.status = "new";
+    ASSERT_TRUE(cache.upsert(streamed));
+
+    Client client(environment_);
+    client.setOrderCache(&cache);
+    OrderRequest request = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+    request.client_order_id = "cid-1";
+    auto [status, order] = client.submitOrder(request);
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_EQ(order.id, "order-1");
+    EXPECT_EQ(posts_, 1);
+    EXPECT_EQ(lookups_, 0);
+}
+
+TEST_F(OrderSubmitTest, ResendsWhenLookupFindsNothing) {
+    serve({500, 200}, {404});
+    auto [status, order] = submit();
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_EQ(order.id, "order-1");
+    EXPECT_EQ(posts_, 2);
+    EXPECT_EQ(lookups_, 1);
+    expectSameClientOrderId();
+}
+
+TEST_F(OrderSubmitTest, DuplicateRejectionOfResendMeansAccepted) {
+    // The first attempt landed after the lookup, so the resend is rejected as a duplicate
+    serve({500, 422}, {404, 200});
+    auto [status, order] = submit();
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_EQ(order.id, "order-1");
+    EXPECT_EQ(posts_, 2);
+    EXPECT_EQ(lookups_, 2);
+    expectSameClientOrderId();
+}
+
+TEST_F(OrderSubmitTest, ReturnsClientOrderIdWhenBudgetRunsOut) {
+    // Neither the submission nor any lookup gets a usable answer
+    serve({503}, {503});
+    auto [status, order] = submit();
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("same client_order_id"), std::string::npos) << status.getMessage();
+    EXPECT_EQ(order.client_order_id, "cid-1");
+    EXPECT_TRUE(order.id.empty());
+    EXPECT_EQ(posts_, 1);
+    EXPECT_GT(lookups_, 1);
+    expectSameClientOrderId();
+}
+
+TEST_F(OrderSubmitTest, ReturnsClientOrderIdWhenResendsRunOut) {
+    serve({500}, {404});
+    auto [status, order] = submit();
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("same client_order_id"), std::string::npos) << status.getMessage();
+    EXPECT_EQ(order.client_order_id, "cid-1");
+    EXPECT_EQ(posts_, 2);
+    EXPECT_EQ(lookups_, 2);
+    expectSameClientOrderId();
+}
+
+TEST_F(LocalServerTest, DownloadTradesKeepsOneConnectionPerWorker) {
+    std::mutex mutex;
+    std::set<int> ports;
+    int requests = 0;
+    // Range r has two pages of one trade each, priced 2r and 2r + 1
+    server_.Get("/v2/stocks/AAPL/trades", [&](const httplib::Request& req, httplib::Response& res) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ports.insert(req.remote_port);
+            ++requests;
+        }
+        bool second = req.has_param("page_token");
+        int price = std::stoi(req.get_param_value("start")) * 2 + (second ? 1 : 0);
+        res.set_content(R"({"trades": [{"p": )" + std::to_string(price) + R"(, "s": 1}], "next_page_token": )" +
+                            (second ? "null" : R"("next")") + "}",
+                        "application/json");
+    });
+    start();
+
+    std::vector<TimeRange> ranges;
+    for (int r = 0; r < 6; ++r) {
+        ranges.push_back({std::to_string(r), ""});
+    }
+    ParallelDownloadConfig config;
+    config.max_concurrency = 2;
+    config.requests_per_minute = 0;
+    Client client(environment_);
+    auto [status, trades] = downloadTrades(client, "AAPL", ranges, config);
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    ASSERT_EQ(trades.size(), 12u);
+    for (std::size_t i = 0; i < trades.size(); ++i) {
+        EXPECT_EQ(trades[i].price, static_cast<double>(i));
+    }
+    EXPECT_EQ(requests, 12);
+    EXPECT_LE(ports.size(), 2u);
+}
+
+TEST_F(LocalServerTest, CancelAllFallbackPagesOpenOrdersAndKeepsStatuses) {
+    // 503 open orders, one second apart, except that the 500th and 501st share a submission time
+    std::vector<std::pair<std::string, std::string>> open;
+    for (int i = 0; i < 503; ++i) {
+        int second = i < 500 ? i : i - 1;
+        char submitted_at[32];
+        std::snprintf(submitted_at, sizeof(submitted_at), "2024-01-02T14:%02d:%02dZ", 30 + second / 60, second % 60);
+        open.emplace_back("o-" + std::to_string(i), submitted_at);
+    }
+    std::atomic<int> pages{0};
+    server_.Delete("/v2/orders", [](const httplib::Request&, httplib::Response& res) { res.status = 500; });
+    server_.Get("/v2/orders", [&](const httplib::Request& req, httplib::Response& res) {
+        ++pages;
+        EXPECT_EQ(req.get_param_value("direction"), "asc");
+        auto after = parseTimestampNanos(req.get_param_value("after"));
+        int limit = std::stoi(req.get_param_value("limit"));
+        std::string body = "[";
+        int count = 0;
+        for (const auto& [id, submitted_at] : open) {
+            if ((!after || *parseTimestampNanos(submitted_at) > *after) && count < limit) {
+                body += (count++ > 0 ? "," : "") + std::string(R"({"id": ")") + id + R"(", "submitted_at": ")" +
+                        submitted_at + R"(", "status": "new"})";
+            }
+        }
+        res.set_content(body + "]", "application/json");
+    });
+    // o-7 was already cancelled by the slow bulk request; o-8 filled before it could be cancelled
+    server_.Delete(R"(/v2/orders/([^/]+))", [](const httplib::Request& req, httplib::Response& res) {
+        res.status = req.matches[1] == "o-7" || req.matches[1] == "o-8" ? 422 : 204;
+    });
+    std::atomic<int> lookups{0};
+    server_.Get(R"(/v2/orders/([^/]+))", [&](const httplib::Request& req, httplib::Response& res) {
+        ++lookups;
+        std::string state = req.matches[1] == "o-8" ? "filled" : "pending_cancel";
+        res.set_content(R"({"id": ")" + std::string(req.matches[1]) + R"(", "status": ")" + state + R"("})",
+                        "application/json");
+    });
+    start();
+
+    BatchConfig batch;
+    batch.max_requests_per_minute = 0;
+    environment_.setBatchConfig(batch);
+    Client client(environment_);
+    auto [status, cancels] = client.cancelAllOrders();
+    ASSERT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_EQ(pages, 2);
+    // A mass cancel only fetches the orders whose cancellation was rejected
+    EXPECT_EQ(lookups, 2);
+    ASSERT_EQ(cancels.size(), open.size());
+    for (std::size_t i = 0; i < open.size(); ++i) {
+        EXPECT_EQ(cancels[i].id, open[i].first);
+        if (cancels[i].id == "o-7") {
+            // Already being cancelled: the goal of the request is met
+            EXPECT_EQ(cancels[i].http_status, 422);
+            EXPECT_TRUE(cancels[i].status.ok()) << cancels[i].status.getMessage();
+            EXPECT_EQ(cancels[i].order.status, "pending_cancel");
+        } else if (cancels[i].id == "o-8") {
+            EXPECT_EQ(cancels[i].http_status, 422);
+            EXPECT_FALSE(cancels[i].status.ok());
+        } else {
+            EXPECT_EQ(cancels[i].http_status, 204);
+            EXPECT_TRUE(cancels[i].status.ok());
+            EXPECT_EQ(cancels[i].order.id, open[i].first);
+        }
+    }
+
+    // cancelOrders() returns the accepted cancellations but reports the failure
+    auto [cancel_status, cancelled] = client.cancelOrders();
+    EXPECT_FALSE(cancel_status.ok());
+    EXPECT_NE(cancel_status.getMessage().find("1 of 503 orders could not be cancelled; order o-8"), std::string::npos)
+        << cancel_status.getMessage();
+    EXPECT_EQ(cancelled.size(), open.size() - 1);
+    EXPECT_EQ(lookups, 4);
+
+    // Cancelling by id fetches each cancelled order's state unless asked not to
+    std::vector<std::string> ids = {"o-1", "o-2"};
+    OrderBatchResult fetched = client.cancelOrdersById(ids);
+    ASSERT_EQ(fetched.succeeded, 2u);
+    EXPECT_EQ(fetched.results[0].second.status, "pending_cancel");
+    EXPECT_EQ(lookups, 6);
+}
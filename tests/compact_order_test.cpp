@@ -0,0 +1,215 @@
+#include <alpaca/markets/compact_order.hpp>
+#include <alpaca/markets/order.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+using namespace alpaca::markets;
+
+namespace {
+
+const std::string kOrderJSON = R"({
+    "id": "61e69015-8549-4bfd-b9c3-01e75843f47d",
+    "client_order_id": "eb9e2aaa-f71a-4f51-b5b4-52a6c565dad4",
+    "created_at": "2024-01-02T14:30:00.123456789Z",
+    "updated_at": "2024-01-02T14:30:01.5Z",
+    "submitted_at": "2024-01-02T09:30:00-05:00",
+    "filled_at": null,
+    "expired_at": null,
+    "canceled_at": null,
+    "failed_at": null,
+    "asset_id": "b0b6dd9d-8b9b-48a9-ba46-b9d54906e415",
+    "symbol": "AAPL",
+    "asset_class": "us_equity",
+    "notional": null,
+    "qty": "15.5",
+    "filled_qty": "0.1",
+    "filled_avg_price": "187.123456789",
+    "order_class": "bracket",
+    "type": "stop_limit",
+    "side": "sell",
+    "time_in_force": "gtc",
+    "limit_price": "187.25",
+    "stop_price": "186",
+    "status": "partially_filled",
+    "extended_hours": true,
+    "legs": null,
+    "trail_percent": null,
+    "trail_price": null,
+    "hwm": null
+})";
+
+}  // namespace
+
+TEST(CompactOrderTest, FromJSON) {
+    CompactOrder order;
+    ASSERT_TRUE(order.fromJSON(kOrderJSON).ok());
+
+    EXPECT_EQ(order.id.view(), "61e69015-8549-4bfd-b9c3-01e75843f47d");
+    EXPECT_EQ(order.client_order_id.view(), "eb9e2aaa-f71a-4f51-b5b4-52a6c565dad4");
+    EXPECT_EQ(order.symbol.view(), "AAPL");
+    EXPECT_EQ(order.asset_class.view(), "us_equity");
+
+    EXPECT_EQ(order.side, OrderSide::Sell);
+    EXPECT_EQ(order.type, OrderType::StopLimit);
+    EXPECT_EQ(order.time_in_force, OrderTimeInForce::GoodUntilCanceled);
+    EXPECT_EQ(order.order_class, OrderClass::Bracket);
+    EXPECT_EQ(order.status, OrderStatus::PartiallyFilled);
+    EXPECT_TRUE(order.extended_hours);
+
+    EXPECT_EQ(order.qty, *Decimal::parse("15.5"));
+    EXPECT_EQ(order.filled_qty.units(), 100'000'000);
+    EXPECT_EQ(order.filled_avg_price.toString(), "187.123456789");
+    EXPECT_EQ(order.limit_price, *Decimal::parse("187.25"));
+    EXPECT_EQ(order.stop_price, Decimal(186));
+    EXPECT_TRUE(order.notional.isZero());
+    EXPECT_TRUE(order.hwm.isZero());
+
+    EXPECT_EQ(order.created_at, 1704205800123456789);
+    EXPECT_EQ(order.updated_at, 1704205801500000000);
+    EXPECT_EQ(order.submitted_at, 1704205800000000000);
+    EXPECT_EQ(order.filled_at, 0);
+}
+
+TEST(CompactOrderTest, InPlaceMatchesCopy) {
+    CompactOrder copied;
+    CompactOrder in_place;
+    std::string json = kOrderJSON;
+    ASSERT_TRUE(copied.fromJSON(json).ok());
+    EXPECT_EQ(json, kOrderJSON);
+    ASSERT_TRUE(in_place.fromJSON(std::move(json)).ok());
+    EXPECT_EQ(in_place.id.view(), copied.id.view());
+    EXPECT_EQ(in_place.filled_avg_price, copied.filled_avg_price);
+    EXPECT_EQ(in_place.created_at, copied.created_at);
+}
+
+TEST(CompactOrderTest, FlatValue) {
+    EXPECT_TRUE(std::is_trivially_copyable_v<CompactOrder>);
+    EXPECT_TRUE(std::is_trivially_destructible_v<CompactOrder>);
+}
+
+TEST(CompactOrderTest, RejectsBadValues) {
+    CompactOrder order;
+    EXPECT_FALSE(order.fromJSON(std::string(R"({"qty": "1e3"})")).ok());
+    EXPECT_FALSE(order.fromJSON(std::string(R"({"created_at": "yesterday"})")).ok());
+    EXPECT_FALSE(order.fromJSON(std::string(R"({"symbol": ")" + std::string(40, 'X') + "\"}")).ok());
+    EXPECT_FALSE(order.fromJSON(std::string("[]")).ok());
+}
+
+TEST(CompactOrdersTest, FromJSON) {
+    CompactOrders orders;
+    ASSERT_TRUE(orders.fromJSON("[" + kOrderJSON + "," + R"({"id": "second", "status": "weird_new_status"})" + "]")
+                    .ok());
+    ASSERT_EQ(orders.orders.size(), 2u);
+    EXPECT_EQ(orders.orders[0].symbol.view(), "AAPL");
+    EXPECT_EQ(orders.orders[1].id.view(), "second");
+    EXPECT_EQ(orders.orders[1].status, OrderStatus::Unknown);
+
+    // Decoding again replaces the previous orders
+    ASSERT_TRUE(orders.fromJSON(std::string(R"([{"id": "third"}])")).ok());
+    ASSERT_EQ(orders.orders.size(), 1u);
+    EXPECT_EQ(orders.orders[0].id.view(), "third");
+}
+
+TEST(CompactOrdersTest, SkipsUnknownAndNestedValues) {
+    CompactOrders orders;
+    ASSERT_TRUE(orders
+                    .fromJSON(std::string(R"( [ {"legs": [{"id": "leg", "qty": "1", "legs": null}], "id": "parent",
+                        "extended_hours" : true, "replaced_by": {"a": [1, -2.5e3, true, false, null, "x\"y"]},
+                        "qty": 7, "symbol": "AAPL", "notional": null} , {"id": "next"} ] )"))
+                    .ok());
+    ASSERT_EQ(orders.orders.size(), 2u);
+    EXPECT_EQ(orders.orders[0].id.view(), "parent");
+    EXPECT_EQ(orders.orders[0].symbol.view(), "AAPL");
+    EXPECT_TRUE(orders.orders[0].extended_hours);
+    // A number where a string is expected is ignored, as a null is
+    EXPECT_TRUE(orders.orders[0].qty.isZero());
+    EXPECT_EQ(orders.orders[1].id.view(), "next");
+}
+
+TEST(CompactOrdersTest, UnescapesStrings) {
+    CompactOrder order;
+    ASSERT_TRUE(
+        order.fromJSON(std::string(R"({"client_order_id": "a\"b\\c\/d\u00e9\ud83d\ude00", "sym\u0062ol": "X"})")).ok());
+    EXPECT_EQ(order.client_order_id.view(), "a\"b\\c/d\xc3\xa9\xf0\x9f\x98\x80");
+    EXPECT_EQ(order.symbol.view(), "X");
+}
+
+TEST(CompactOrdersTest, RejectsMalformedJSON) {
+    CompactOrders orders;
+    for (const char* json : {"", "[", "[{]", R"([{"id": "x"},])", R"([{"id" "x"}])", R"([{"id": "x})",
+                             R"([{"id": "x"}] [])", R"([{"qty": 01}])", R"([{"qty": nul}])", R"([{"id": "\q"}])",
+                             "[{\"id\": \"a\nb\"}]", R"([{"id": "\ud83dx"}])"}) {
+        Status status = orders.fromJSON(std::string(json));
+        EXPECT_FALSE(status.ok()) << json;
+        EXPECT_EQ(status.getMessage(), "Received parse error when deserializing orders JSON") << json;
+    }
+
+    ASSERT_TRUE(orders.fromJSON(std::string(R"([{"id": "kept"}])")).ok());
+    EXPECT_EQ(orders.fromJSON(std::string(R"({"id": "x"})")).getMessage(),
+              "Deserialized valid JSON but it wasn't an array of orders");
+    EXPECT_EQ(orders.fromJSON(std::string(R"([{"id": "x"}, 5])")).getMessage(),
+              "Deserialized valid JSON but it wasn't an order object");
+    EXPECT_EQ(orders.fromJSON(std::string(R"([{"qty": "1e3"}])")).getMessage(),
+              "Order number is not a decimal in range: 1e3");
+    // A failed decode leaves no partial result behind
+    EXPECT_TRUE(orders.orders.empty());
+
+    std::string deep = R"([{"legs": )" + std::string(10000, '[') + std::string(10000, ']') + "}]";
+    EXPECT_FALSE(orders.fromJSON(deep).ok());
+}
+
+TEST(TimestampTest, ParseTimestampNanos) {
+    EXPECT_EQ(parseTimestampNanos("1970-01-01T00:00:00Z"), 0);
+    EXPECT_EQ(parseTimestampNanos("1970-01-01T00:00:01.000000001Z"), 1'000'000'001);
+    EXPECT_EQ(parseTimestampNanos("2024-02-29T23:59:59.1234567891Z"), 1709251199123456789);
+    EXPECT_EQ(parseTimestampNanos("2024-01-02T10:30:00+01:30"), parseTimestampNanos("2024-01-02T09:00:00Z"));
+    EXPECT_EQ(parseTimestampNanos("1969-12-31T23:59:59Z"), -1'000'000'000);
+
+    EXPECT_FALSE(parseTimestampNanos("2023-02-29T00:00:00Z"));
+    EXPECT_FALSE(parseTimestampNanos("2024-01-02T24:00:00Z"));
+    EXPECT_FALSE(parseTimestampNanos("2024-01-02T10:30:00"));
+    EXPECT_FALSE(parseTimestampNanos("2024-01-02T10:30:00.Z"));
+    EXPECT_FALSE(parseTimestampNanos("2024-01-02 10:30:00Z"));
+    EXPECT_FALSE(parseTimestampNanos(""));
+}
+
+TEST(OrderStatusTest, StringConversions) {
+    EXPECT_EQ(stringToOrderStatus("accepted_for_bidding"), OrderStatus::AcceptedForBidding);
+    EXPECT_EQ(orderStatusToString(OrderStatus::DoneForDay), "done_for_day");
+    for (int i = 0; i < static_cast<int>(OrderStatus::Unknown); ++i) {
+        auto status = static_cast<OrderStatus>(i);
+        EXPECT_EQ(stringToOrderStatus(orderStatusToString(status)), status);
+    }
+    EXPECT_EQ(stringToOrderType("trailing_stop"), OrderType::TrailingStop);
+    EXPECT_EQ(stringToOrderTimeInForce("fok"), OrderTimeInForce::FillOrKill);
+    EXPECT_EQ(stringToOrderClass(""), OrderClass::Simple);
+    EXPECT_EQ(stringToOrderSide("sell"), OrderSide::Sell);
+}
+
+TEST(OrderStatusTest, UnrecognizedValuesAreUnknown) {
+    EXPECT_EQ(stringToOrderSide("sell_short"), OrderSide::Unknown);
+    EXPECT_EQ(stringToOrderSide(""), OrderSide::Unknown);
+    EXPECT_EQ(stringToOrderType("pegged"), OrderType::Unknown);
+    EXPECT_EQ(stringToOrderTimeInForce("gtd"), OrderTimeInForce::Unknown);
+    EXPECT_EQ(stringToOrderClass("oca"), OrderClass::Unknown);
+    EXPECT_EQ(stringToOrderSide("buy"), OrderSide::Buy);
+    EXPECT_EQ(stringToOrderType("market"), OrderType::Market);
+    EXPECT_EQ(stringToOrderTimeInForce("day"), OrderTimeInForce::Day);
+    EXPECT_EQ(stringToOrderClass("simple"), OrderClass::Simple);
+
+    EXPECT_EQ(orderSideToString(OrderSide::Unknown), "unknown");
+    EXPECT_EQ(orderTypeToString(OrderType::Unknown), "unknown");
+    EXPECT_EQ(orderTimeInForceToString(OrderTimeInForce::Unknown), "unknown");
+    EXPECT_EQ(orderClassToString(OrderClass::Unknown), "unknown");
+
+    // Absent fields stay Unknown instead of reading as a buy market day order
+    CompactOrder order;
+    ASSERT_TRUE(order.fromJSON(std::string(R"({"id": "x", "side": "sell_short"})")).ok());
+    EXPECT_EQ(order.side, OrderSide::Unknown);
+    EXPECT_EQ(order.type, OrderType::Unknown);
+    EXPECT_EQ(order.time_in_force, OrderTimeInForce::Unknown);
+    EXPECT_EQ(order.order_class, OrderClass::Unknown);
+}
@@ -105,3 +105,51 @@ TEST(EnvironmentConfigTest, TimeoutConfig) {
     
     EXPECT_EQ(env.getTimeoutConfig().connection_timeout.count(), 30);
 }
+
+TEST(SymbolChunkConfigTest, DefaultConfig) {
+    SymbolChunkConfig config;
+    EXPECT_EQ(config.max_symbols_per_request, 500u);
+    EXPECT_EQ(config.max_concurrency, 4u);
+    EXPECT_EQ(SymbolChunkConfig::noChunking().max_symbols_per_request, 0u);
+}
+
+TEST(EnvironmentConfigTest, SymbolChunkConfig) {
+    Environment env;
+    
+    // Default chunk config
+    EXPECT_EQ(env.getSymbolChunkConfig().max_symbols_per_request, 500u);
+    
+    // Set custom chunk config
+    SymbolChunkConfig custom;
+    custom.max_symbols_per_request = 100;
+    custom.max_concurrency = 8;
+    env.setSymbolChunkConfig(custom);
+    
+    EXPECT_EQ(env.getSymbolChunkConfig().max_symbols_per_request, 100u);
+    EXPECT_EQ(env.getSymbolChunkConfig().max_concurrency, 8u);
+}
+
+TEST(BatchConfigTest, DefaultConfig) {
+    BatchConfig config;
+    EXPECT_EQ(config.max_concurrency, 8u);
+    EXPECT_EQ(config.cancel_all_timeout, std::chrono::milliseconds(3000));
+    EXPECT_TRUE(config.cancel_all_fallback);
+    EXPECT_EQ(config.max_requests_per_minute, 180u);
+    EXPECT_EQ(BatchConfig::sequential().max_concurrency, 1u);
+
+    Environment env;
+    env.setBatchConfig(BatchConfig::sequential());
+    EXPECT_EQ(env.getBatchConfig().max_concurrency, 1u);
+}
+
+TEST(OrderSubmitConfigTest, DefaultConfig) {
+    OrderSubmitConfig config;
+    EXPECT_EQ(config.budget, std::chrono::milliseconds(5000));
+    EXPECT_EQ(config.attempt_timeout, std::chrono::milliseconds(2000));
+    EXPECT_EQ(config.max_resubmits, 2);
+    EXPECT_EQ(OrderSubmitConfig::noResubmits().max_resubmits, 0);
+
+    Environment env;
+    env.setOrderSubmitConfig(OrderSubmitConfig::noResubmits());
+    EXPECT_EQ(env.getOrderSubmitConfig().max_resubmits, 0);
+}
@@ -0,0 +1,59 @@
+#include <alpaca/markets/account.hpp>
+#include <alpaca/markets/order.hpp>
+#include <alpaca/markets/snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include "detail/decode.hpp"
+
+using namespace alpaca::markets;
+
+namespace {
+
+constexpr auto kTestFields = detail::makeFieldTable<Order>(detail::field("id", &Order::id),
+                                                           detail::field("qty", &Order::qty),
+                                                           detail::field("legs", &Order::legs),
+                                                           detail::field("extended_hours", &Order::extended_hours));
+
+}  // namespace
+
+TEST(FieldTableTest, FindsEveryFieldAndRejectsUnknownKeys) {
+    for (const auto& f : kTestFields.fields()) {
+        const auto* found = kTestFields.find(f.name);
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->name, f.name);
+    }
+    EXPECT_EQ(kTestFields.find("symbol"), nullptr);
+    EXPECT_EQ(kTestFields.find(""), nullptr);
+    EXPECT_EQ(kTestFields.find("qty2"), nullptr);
+}
+
+TEST(FieldTableTest, AccountConfigurationsRoundTrip) {
+    AccountConfigurations configurations;
+    configurations.dtbp_check = "both";
+    configurations.no_shorting = true;
+    configurations.trade_confirm_email = "none";
+
+    std::string json = detail::encodeJSON(configurations);
+
+    AccountConfigurations decoded;
+    ASSERT_TRUE(decoded.fromJSON(json).ok());
+    EXPECT_EQ(decoded.dtbp_check, "both");
+    EXPECT_TRUE(decoded.no_shorting);
+    EXPECT_FALSE(decoded.suspend_trade);
+    EXPECT_EQ(decoded.trade_confirm_email, "none");
+}
+
+TEST(FieldTableTest, DecodesNestedObjects) {
+    const std::string json = R"({"snapshots": {"AAPL": {
+        "latestTrade": {"p": 150.5, "c": ["@", "F"]},
+        "dailyBar": {"v": 1000}
+    }}})";
+
+    Snapshots decoded;
+    ASSERT_TRUE(decoded.fromJSON(json).ok());
+    ASSERT_EQ(decoded.snapshots.count("AAPL"), 1u);
+    EXPECT_DOUBLE_EQ(decoded.snapshots["AAPL"].latest_trade.price, 150.5);
+    EXPECT_EQ(decoded.snapshots["AAPL"].latest_trade.conditions.size(), 2u);
+    EXPECT_EQ(decoded.snapshots["AAPL"].daily_bar.volume, 1000u);
+}
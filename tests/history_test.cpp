@@ -0,0 +1,103 @@
+#include <alpaca/markets/history.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(HistoryTest, SplitTimeRangeEvenly) {
+    auto [status, ranges] = splitTimeRange("2024-01-02T00:00:00Z", "2024-01-02T04:00:00Z", 4);
+    ASSERT_TRUE(status.ok()) << status;
+    ASSERT_EQ(ranges.size(), 4u);
+    EXPECT_EQ(ranges[0].start, "2024-01-02T00:00:00Z");
+    EXPECT_EQ(ranges[0].end, "2024-01-02T00:59:59.999999999Z");
+    EXPECT_EQ(ranges[1].start, "2024-01-02T01:00:00Z");
+    EXPECT_EQ(ranges[3].start, "2024-01-02T03:00:00Z");
+    EXPECT_EQ(ranges[3].end, "2024-01-02T04:00:00Z");
+}
+
+TEST(HistoryTest, SplitTimeRangeHandlesOffsetsAndShortRanges) {
+    auto [status, ranges] = splitTimeRange("2024-01-02T09:30:00-05:00", "2024-01-02T14:30:02Z", 10);
+    ASSERT_TRUE(status.ok()) << status;
+    ASSERT_EQ(ranges.size(), 2u);
+    EXPECT_EQ(ranges[0].start, "2024-01-02T09:30:00-05:00");
+    EXPECT_EQ(ranges[0].end, "2024-01-02T14:30:00.999999999Z");
+    EXPECT_EQ(ranges[1].start, "2024-01-02T14:30:01Z");
+}
+
+TEST(HistoryTest, SplitTimeRangeByDay) {
+    auto [status, ranges] = splitTimeRangeByDay("2024-02-28T12:00:00Z", "2024-03-01T06:00:00.5Z");
+    ASSERT_TRUE(status.ok()) << status;
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(ranges[0].end, "2024-02-28T23:59:59.999999999Z");
+    EXPECT_EQ(ranges[1].start, "2024-02-29T00:00:00Z");
+    EXPECT_EQ(ranges[2].start, "2024-03-01T00:00:00Z");
+    EXPECT_EQ(ranges[2].end, "2024-03-01T06:00:00.5Z");
+}
+
+TEST(HistoryTest, SplitTimeRangeRejectsBadInput) {
+    EXPECT_FALSE(splitTimeRange("yesterday", "2024-01-02", 2).first.ok());
+    EXPECT_FALSE(splitTimeRange("2024-01-03", "2024-01-02", 2).first.ok());
+    EXPECT_FALSE(splitTimeRangeByDay("2024-01-02", "2024-13-01").first.ok());
+}
+
+TEST(HistoryTest, DownloadRangesMergesInRangeOrder) {
+    std::vector<TimeRange> ranges = {{"0", ""}, {"1", ""}, {"2", ""}, {"3", ""}, {"4", ""}};
+    std::atomic<int> calls{0};
+    ParallelDownloadConfig config;
+    config.max_concurrency = 3;
+    config.requests_per_minute = 0;
+
+    // Each range has two pages of two items: range r yields r*4 .. r*4+3
+    auto [status, items] = downloadRanges<int>(
+        ranges,
+        [&](const TimeRange& range, const std::string& page_token) {
+            ++calls;
+            int base = std::stoi(range.start) * 4 + (page_token.empty() ? 0 : 2);
+            Page<int> page;
+            page.items = {base, base + 1};
+            page.next_page_token = page_token.empty() ? "next" : "";
+            return std::make_pair(Status(), page);
+        },
+        config);
+
+    ASSERT_TRUE(status.ok());
+    EXPECT_EQ(calls.load(), 10);
+    ASSERT_EQ(items.size(), 20u);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(items[i], i);
+    }
+}
+
+TEST(HistoryTest, DownloadRangesReportsFirstError) {
+    std::vector<TimeRange> ranges(8);
+    ParallelDownloadConfig config;
+    config.requests_per_minute = 0;
+
+    auto [status, items] = downloadRanges<int>(
+        ranges, [](const TimeRange&, const std::string&) { return std::make_pair(Status(1, "HTTP 500"), Page<int>{}); },
+        config);
+    EXPECT_FALSE(status.ok());
+    EXPECT_EQ(status.getMessage(), "HTTP 500");
+    EXPECT_TRUE(items.empty());
+}
+
+TEST(HistoryTest, DownloadRangesReportsExceptions) {
+    std::vector<TimeRange> ranges(8);
+    ParallelDownloadConfig config;
+    config.requests_per_minute = 0;
+
+    auto [status, items] = downloadRanges<int>(
+        ranges,
+        [](const TimeRange&, const std::string&) -> std::pair<Status, Page<int>> {
+            throw std::runtime_error("connection reset");
+        },
+        config);
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("connection reset"), std::string::npos);
+    EXPECT_TRUE(items.empty());
+}
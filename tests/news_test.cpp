@@ -76,3 +76,24 @@ TEST(NewsTest, FromJSONParseError) {
     Status status = news.fromJSON("invalid json");
     EXPECT_FALSE(status.ok());
 }
+
+TEST(NewsArticlesTest, FromJSONInsitu) {
+    std::string json = R"({
+        "news": [
+            {"id": 1, "headline": "First", "symbols": ["AAPL"], "images": [{"size": "thumb", "url": "https://a"}]},
+            {"id": 2, "headline": "Second", "symbols": ["MSFT", "GOOG"]}
+        ],
+        "next_page_token": "abc"
+    })";
+
+    NewsArticles articles;
+    Status status = articles.fromJSON(std::move(json));
+
+    EXPECT_TRUE(status.ok());
+    ASSERT_EQ(articles.news.size(), 2u);
+    EXPECT_EQ(articles.news[0].headline, "First");
+    ASSERT_EQ(articles.news[0].images.size(), 1u);
+    EXPECT_EQ(articles.news[0].images[0].url, "https://a");
+    EXPECT_EQ(articles.news[1].symbols.size(), 2u);
+    EXPECT_EQ(articles.next_page_token, "abc");
+}
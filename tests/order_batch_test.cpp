@@ -0,0 +1,85 @@
+#include <alpaca/markets/client.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+OrderRequest makeRequest(const std::string& symbol, int quantity) {
+    return OrderRequest::market(symbol, quantity, OrderSide::Buy);
+}
+
+}  // namespace
+
+TEST(OrderBatchTest, EmptyBatchSendsNothing) {
+    Environment env;
+    Client client(env);
+    OrderBatchResult batch = client.submitOrders({});
+    EXPECT_TRUE(batch.ok());
+    EXPECT_TRUE(batch.results.empty());
+    EXPECT_EQ(batch.succeeded, 0u);
+
+    EXPECT_TRUE(client.cancelOrdersById({}).results.empty());
+}
+
+TEST(OrderBatchTest, RejectionsKeepInputOrder) {
+    Environment env;
+    Client client(env);
+    std::vector<std::string> checked;
+    client.setPreTradeCheck([&](const OrderIntent& intent) {
+        checked.push_back(intent.symbol);
+        return Status(1, "rejected " + intent.symbol);
+    });
+
+    std::vector<OrderRequest> requests = {makeRequest("AAPL", 1), makeRequest("MSFT", 2), makeRequest("TSLA", 3)};
+    OrderBatchResult batch = client.submitOrders(requests);
+    ASSERT_EQ(batch.results.size(), 3u);
+    EXPECT_FALSE(batch.ok());
+    EXPECT_EQ(batch.failed, 3u);
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        EXPECT_EQ(batch.results[i].first.getMessage(), "rejected " + requests[i].symbol);
+    }
+    EXPECT_EQ(checked, (std::vector<std::string>{"AAPL", "MSFT", "TSLA"}));
+}
+
+TEST(OrderBatchTest, NotionalRequestsAreCheckedByValue) {
+    Environment env;
+    Client client(env);
+    OrderIntent seen;
+    client.setPreTradeCheck([&](const OrderIntent& intent) {
+        seen = intent;
+        return Status(1, "stop");
+    });
+
+    OrderRequest request = OrderRequest::notionalMarket("AAPL", *Decimal::parse("250.5"), OrderSide::Buy);
+    request.type = OrderType::Limit;
+    request.limit_price = *Decimal::parse("187.25");
+    EXPECT_FALSE(client.submitOrder(request).first.ok());
+    EXPECT_DOUBLE_EQ(seen.qty, 0.0);
+    EXPECT_DOUBLE_EQ(seen.notional, 250.5);
+    EXPECT_DOUBLE_EQ(seen.limit_price, 187.25);
+}
+
+TEST(OrderBatchTest, InvalidRequestsAreNotSent) {
+    Environment env;
+    Client client(env);
+    std::vector<OrderRequest> requests = {OrderRequest::limit("AAPL", 1, OrderSide::Buy, Decimal()),
+                                          OrderRequest::market("", 1, OrderSide::Buy)};
+    OrderBatchResult batch = client.submitOrders(requests);
+    ASSERT_EQ(batch.results.size(), 2u);
+    EXPECT_EQ(batch.failed, 2u);
+    EXPECT_EQ(batch.results[0].first.getMessage(), "Order limit_price is required for this order type");
+    EXPECT_EQ(batch.results[1].first.getMessage(), "Order symbol is required");
+}
+
+TEST(OrderBatchTest, LegacySubmitRejectsUnparseablePrices) {
+    Environment env;
+    Client client(env);
+    auto [status, order] =
+        client.submitOrder("AAPL", 10, OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day, "18x.25");
+    EXPECT_EQ(status.getMessage(), "Invalid order limit_price: 18x.25");
+}
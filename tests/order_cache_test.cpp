@@ -0,0 +1,255 @@
+#include <alpaca/markets/order_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+Order makeOrder(const std::string& id, const std::string& status, const std::string& updated_at,
+                const std::string& client_order_id = "") {
+    Order order;
+    order.id = id;
+    order.client_order_id = client_order_id;
+    order.status = status;
+    order.symbol = "AAPL";
+    order.updated_at = updated_at;
+    return order;
+}
+
+}  // namespace
+
+TEST(TradeUpdateTest, FromJSON) {
+    const std::string json = R"({
+        "event": "partial_fill",
+        "execution_id": "exec-1",
+        "price": "187.25",
+        "qty": "40",
+        "position_qty": "140",
+        "timestamp": "2024-01-02T14:30:01.5Z",
+        "order": {
+            "id": "order-1",
+            "client_order_id": "strategy-1-42",
+            "symbol": "AAPL",
+            "status": "partially_filled",
+            "filled_qty": "40",
+            "updated_at": "2024-01-02T14:30:01.5Z"
+        }
+    })";
+
+    TradeUpdate update;
+    ASSERT_TRUE(update.fromJSON(json).ok());
+    EXPECT_EQ(update.event, "partial_fill");
+    EXPECT_EQ(update.execution_id, "exec-1");
+    EXPECT_EQ(update.price, "187.25");
+    EXPECT_EQ(update.qty, "40");
+    EXPECT_EQ(update.position_qty, "140");
+    EXPECT_EQ(update.order.id, "order-1");
+    EXPECT_EQ(update.order.status, "partially_filled");
+    EXPECT_EQ(update.order.filled_qty, "40");
+}
+
+TEST(OrderCacheTest, ApplyTradeUpdateJSON) {
+    OrderCache cache;
+    cache.reconcile({makeOrder("order-1", "new", "2024-01-02T14:30:00Z", "strategy-1-42")});
+
+    ASSERT_TRUE(cache.apply(std::string(R"({"event":"fill","price":"187.25","qty":"100",)"
+                                        R"("order":{"id":"order-1","client_order_id":"strategy-1-42",)"
+                                        R"("status":"filled","filled_qty":"100",)"
+                                        R"("updated_at":"2024-01-02T14:30:02Z"}})"))
+                    .ok());
+    auto order = cache.findByClientOrderId("strategy-1-42");
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->status, "filled");
+    EXPECT_EQ(order->filled_qty, "100");
+
+    EXPECT_FALSE(cache.apply(std::string("not json")).ok());
+    EXPECT_FALSE(cache.apply(std::string(R"({"event":"fill"})")).ok());
+}
+
+TEST(OrderCacheTest, TerminalStatuses) {
+    EXPECT_TRUE(isTerminalOrderStatus("filled"));
+    EXPECT_TRUE(isTerminalOrderStatus("canceled"));
+    EXPECT_TRUE(isTerminalOrderStatus("replaced"));
+    EXPECT_FALSE(isTerminalOrderStatus("new"));
+    EXPECT_FALSE(isTerminalOrderStatus("partially_filled"));
+    EXPECT_FALSE(isTerminalOrderStatus("pending_cancel"));
+}
+
+TEST(OrderCacheTest, LookupByIdAndClientOrderId) {
+    OrderCache cache;
+    EXPECT_EQ(cache.find("order-1"), nullptr);
+
+    auto stats = cache.reconcile({makeOrder("order-1", "new", "2024-01-02T14:30:00Z", "strategy-1-42"),
+                                  makeOrder("order-2", "accepted", "2024-01-02T14:30:00Z")});
+    EXPECT_EQ(stats.inserted, 2u);
+    EXPECT_EQ(stats.updated, 0u);
+    EXPECT_TRUE(stats.vanished.empty());
+
+    ASSERT_NE(cache.find("order-2"), nullptr);
+    auto order = cache.findByClientOrderId("strategy-1-42");
+    ASSERT_NE(order, nullptr);
+    EXPECT_EQ(order->id, "order-1");
+    EXPECT_EQ(cache.findByClientOrderId("unknown"), nullptr);
+    EXPECT_EQ(cache.snapshot()->open().size(), 2u);
+}
+
+TEST(OrderCacheTest, StaleUpdatesAreIgnored) {
+    OrderCache cache;
+    TradeUpdate fill;
+    fill.event = "fill";
+    fill.order = makeOrder("order-1", "filled", "2024-01-02T14:30:02Z");
+    EXPECT_TRUE(cache.apply(fill));
+
+    // A REST result fetched before the fill arrives after it
+    auto stats = cache.reconcile({makeOrder("order-1", "new", "2024-01-02T14:30:00Z")});
+    EXPECT_EQ(stats.updated, 0u);
+    EXPECT_EQ(cache.find("order-1")->status, "filled");
+
+    TradeUpdate late;
+    late.event = "new";
+    late.order = makeOrder("order-1", "new", "2024-01-02T14:30:00Z");
+    EXPECT_FALSE(cache.apply(late));
+    EXPECT_EQ(cache.find("order-1")->status, "filled");
+}
+
+TEST(OrderCacheTest, ComparesUpdatedAtAsInstants) {
+    // Fraction widths and offsets vary between events; as strings, each of these older stamps sorts after the newer
+    OrderCache cache;
+    EXPECT_TRUE(cache.upsert(makeOrder("order-1", "partially_filled", "2024-01-02T14:30:01.94Z")));
+    EXPECT_FALSE(cache.upsert(makeOrder("order-1", "new", "2024-01-02T14:30:01.9Z")));
+    EXPECT_EQ(cache.find("order-1")->status, "partially_filled");
+
+    EXPECT_TRUE(cache.upsert(makeOrder("order-2", "partially_filled", "2024-01-02T14:30:01.5Z")));
+    EXPECT_FALSE(cache.upsert(makeOrder("order-2", "new", "2024-01-02T14:30:01Z")));
+    EXPECT_EQ(cache.find("order-2")->status, "partially_filled");
+
+    // And the newer stamps are accepted even though they sort first as strings
+    EXPECT_TRUE(cache.upsert(makeOrder("order-3", "new", "2024-01-02T14:30:01.9Z")));
+    EXPECT_TRUE(cache.upsert(makeOrder("order-3", "filled", "2024-01-02T14:30:01.94Z")));
+    EXPECT_EQ(cache.find("order-3")->status, "filled");
+
+    EXPECT_TRUE(cache.upsert(makeOrder("order-4", "new", "2024-01-02T14:30:01Z")));
+    EXPECT_TRUE(cache.upsert(makeOrder("order-4", "filled", "2024-01-02T09:30:01.5-05:00")));
+    EXPECT_EQ(cache.find("order-4")->status, "filled");
+}
+
+TEST(OrderCacheTest, RejectsOrdersWithoutId) {
+    OrderCache cache;
+    EXPECT_FALSE(cache.upsert(makeOrder("", "new", "2024-01-02T14:30:00Z")));
+
+    TradeUpdate update;
+    update.event = "new";
+    update.order = makeOrder("", "new", "2024-01-02T14:30:00Z", "strategy-1-42");
+    EXPECT_FALSE(cache.apply(update));
+
+    auto stats = cache.reconcile({makeOrder("", "new", "2024-01-02T14:30:00Z")});
+    EXPECT_EQ(stats.inserted, 0u);
+    EXPECT_EQ(cache.snapshot()->size(), 0u);
+    EXPECT_EQ(cache.findByClientOrderId("strategy-1-42"), nullptr);
+}
+
+TEST(OrderCacheTest, ReconcileReportsVanishedOrders) {
+    OrderCache cache;
+    cache.reconcile({makeOrder("order-1", "new", "2024-01-02T14:30:00Z"),
+                     makeOrder("order-2", "new", "2024-01-02T14:30:00Z")});
+
+    // order-1 was canceled while the stream was disconnected
+    auto stats = cache.reconcile({makeOrder("order-2", "partially_filled", "2024-01-02T14:31:00Z")});
+    EXPECT_EQ(stats.updated, 1u);
+    EXPECT_EQ(stats.vanished, (std::vector<std::string>{"order-1"}));
+
+    EXPECT_TRUE(cache.upsert(makeOrder("order-1", "canceled", "2024-01-02T14:30:30Z")));
+    EXPECT_TRUE(cache.reconcile({makeOrder("order-2", "partially_filled", "2024-01-02T14:31:00Z")}).vanished.empty());
+}
+
+TEST(OrderCacheTest, SnapshotsAreImmutable) {
+    OrderCache cache;
+    cache.upsert(makeOrder("order-1", "new", "2024-01-02T14:30:00Z"));
+    auto before = cache.snapshot();
+
+    cache.upsert(makeOrder("order-1", "filled", "2024-01-02T14:30:01Z"));
+    EXPECT_EQ(before->find("order-1")->status, "new");
+    EXPECT_EQ(cache.snapshot()->find("order-1")->status, "filled");
+    EXPECT_GT(cache.snapshot()->version, before->version);
+}
+
+TEST(OrderCacheTest, UpdatesShareUntouchedShards) {
+    OrderCache cache;
+    std::vector<Order> open;
+    for (int i = 0; i < 1000; ++i) {
+        open.push_back(makeOrder("order-" + std::to_string(i), "new", "2024-01-02T14:30:00Z",
+                                 "coid-" + std::to_string(i)));
+    }
+    cache.reconcile(std::move(open));
+    auto before = cache.snapshot();
+
+    cache.upsert(makeOrder("order-7", "filled", "2024-01-02T14:30:01Z", "coid-7"));
+    auto after = cache.snapshot();
+
+    // Only the shards holding order-7's id and client_order_id were copied
+    std::size_t copied = 0;
+    for (std::size_t i = 0; i < OrderCache::Snapshot::kShards; ++i) {
+        copied += before->shards[i] != after->shards[i];
+    }
+    EXPECT_GE(copied, 1u);
+    EXPECT_LE(copied, 2u);
+    EXPECT_EQ(after->size(), 1000u);
+    EXPECT_EQ(before->find("order-7")->status, "new");
+    EXPECT_EQ(after->findByClientOrderId("coid-7")->status, "filled");
+    EXPECT_EQ(after->open().size(), 999u);
+}
+
+TEST(OrderCacheTest, EvictsOldestClosedOrders) {
+    OrderCache cache(2);
+    for (int i = 0; i < 4; ++i) {
+        std::string id = "order-" + std::to_string(i);
+        cache.upsert(makeOrder(id, "new", "2024-01-02T14:30:00Z", "coid-" + std::to_string(i)));
+        cache.upsert(makeOrder(id, "filled", "2024-01-02T14:30:01Z", "coid-" + std::to_string(i)));
+    }
+    cache.upsert(makeOrder("order-open", "new", "2024-01-02T14:30:00Z"));
+
+    EXPECT_EQ(cache.find("order-0"), nullptr);
+    EXPECT_EQ(cache.find("order-1"), nullptr);
+    EXPECT_EQ(cache.findByClientOrderId("coid-0"), nullptr);
+    EXPECT_NE(cache.find("order-2"), nullptr);
+    EXPECT_NE(cache.find("order-3"), nullptr);
+    EXPECT_NE(cache.find("order-open"), nullptr);
+    EXPECT_EQ(cache.snapshot()->size(), 3u);
+}
+
+TEST(OrderCacheTest, ConcurrentReadersSeeConsistentOrders) {
+    OrderCache cache;
+    cache.upsert(makeOrder("order-1", "new", "2024-01-02T14:30:00.000Z"));
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    std::atomic<int> inconsistent{0};
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                auto order = cache.find("order-1");
+                if (order == nullptr || order->filled_qty != order->qty) {
+                    ++inconsistent;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i) {
+        Order order = makeOrder("order-1", "partially_filled", "2024-01-02T14:30:01." + std::to_string(1000 + i) + "Z");
+        order.qty = std::to_string(i);
+        order.filled_qty = std::to_string(i);
+        cache.upsert(std::move(order));
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(cache.find("order-1")->qty, "999");
+}
@@ -0,0 +1,134 @@
+#include <alpaca/markets/order_gateway.hpp>
+#include <httplib.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace alpaca::markets;
+
+TEST(OrderTemplateTest, PrefixHoldsFixedFields) {
+    OrderTemplate order_template("AAPL", OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day);
+    EXPECT_EQ(order_template.prefix(), R"({"symbol":"AAPL","side":"buy","type":"limit","time_in_force":"day")");
+
+    OrderTemplate extended("MSFT", OrderSide::Sell, OrderType::Market, OrderTimeInForce::GoodUntilCanceled, true);
+    EXPECT_EQ(extended.prefix(),
+              R"({"symbol":"MSFT","side":"sell","type":"market","time_in_force":"gtc","extended_hours":true)");
+}
+
+TEST(OrderTemplateTest, RenderAppendsVariableFields) {
+    OrderTemplate order_template("AAPL", OrderSide::Buy, OrderType::StopLimit, OrderTimeInForce::Day);
+    std::string body;
+    ASSERT_TRUE(order_template.render(body, 100, "187.25", "186.5", "strategy-1-42").ok());
+    EXPECT_EQ(body,
+              R"({"symbol":"AAPL","side":"buy","type":"stop_limit","time_in_force":"day","qty":"100",)"
+              R"("limit_price":"187.25","stop_price":"186.5","client_order_id":"strategy-1-42"})");
+
+    ASSERT_TRUE(order_template.render(body, 7).ok());
+    EXPECT_EQ(body, R"({"symbol":"AAPL","side":"buy","type":"stop_limit","time_in_force":"day","qty":"7"})");
+}
+
+TEST(OrderTemplateTest, RenderReusesBuffer) {
+    OrderTemplate order_template("AAPL", OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day);
+    std::string body;
+    body.reserve(512);
+    const char* data = body.data();
+    for (int quantity = 1; quantity < 1000; ++quantity) {
+        ASSERT_TRUE(order_template.render(body, quantity, "187.25").ok());
+    }
+    EXPECT_EQ(body.data(), data);
+}
+
+TEST(OrderTemplateTest, RenderRejectsUnsafeInput) {
+    OrderTemplate order_template("AAPL", OrderSide::Buy, OrderType::Limit, OrderTimeInForce::Day);
+    std::string body;
+    EXPECT_FALSE(order_template.render(body, 0, "187.25").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "187.25\",\"side\":\"sell").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "1.2.3").ok());
+    EXPECT_FALSE(order_template.render(body, 10, ".").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "", "-5").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "0").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "1.0000000001").ok());
+    EXPECT_FALSE(order_template.render(body, 10, "187.25", "", "bad\"id").ok());
+
+    OrderTemplate unknown_side("AAPL", OrderSide::Unknown, OrderType::Limit, OrderTimeInForce::Day);
+    EXPECT_FALSE(unknown_side.render(body, 10, "187.25").ok());
+}
+
+TEST(OrderTemplateTest, PricesAreSentInCanonicalForm) {
+    OrderTemplate order_template("AAPL", OrderSide::Buy, OrderType::StopLimit, OrderTimeInForce::Day);
+    std::string body;
+    ASSERT_TRUE(order_template.render(body, 1, "187.", ".5").ok());
+    EXPECT_EQ(body, R"({"symbol":"AAPL","side":"buy","type":"stop_limit","time_in_force":"day","qty":"1",)"
+                    R"("limit_price":"187","stop_price":"0.5"})");
+}
+
+TEST(OrderTemplateTest, SymbolIsEscaped) {
+    OrderTemplate order_template("A\"B", OrderSide::Buy, OrderType::Market, OrderTimeInForce::Day);
+    EXPECT_EQ(order_template.prefix(), R"({"symbol":"A\"B","side":"buy","type":"market","time_in_force":"day")");
+}
+
+TEST(OrderGatewayTest, WarmUpReportsRejectedCredentials) {
+    std::atomic<int> clock_status{401};
+    httplib::Server server;
+    server.Get("/v2/clock", [&](const httplib::Request&, httplib::Response& res) {
+        res.status = clock_status;
+        res.set_content(res.status == 200 ? R"({"is_open":true})" : R"({"message":"unauthorized."})",
+                        "application/json");
+    });
+    int port = server.bind_to_any_port("127.0.0.1");
+    ASSERT_GT(port, 0);
+    std::thread listener([&] { server.listen_after_bind(); });
+
+    // The stand-in does not check credentials, so an unparsed environment (empty keys) is enough
+    Environment env;
+    OrderGateway gateway(env, "http://127.0.0.1:" + std::to_string(port));
+    Status status = gateway.warmUp();
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("HTTP 401"), std::string::npos);
+
+    clock_status = 200;
+    EXPECT_TRUE(gateway.warmUp().ok());
+
+    server.stop();
+    listener.join();
+}
+
+TEST(OrderGatewayTest, ResolvesAmbiguousSubmitByGeneratedClientOrderId) {
+    std::atomic<int> posts{0};
+    std::string sent_id;
+    httplib::Server server;
+    server.Post("/v2/orders", [&](const httplib::Request& req, httplib::Response& res) {
+        auto start = req.body.find(R"("client_order_id":")");
+        if (start != std::string::npos) {
+            start += 19;
+            sent_id = req.body.substr(start, req.body.find('"', start) - start);
+        }
+        // The order is accepted, but the answer is lost behind a 503
+        ++posts;
+        res.status = 503;
+    });
+    server.Get("/v2/orders:by_client_order_id", [&](const httplib::Request& req, httplib::Response& res) {
+        res.set_content(R"({"id":"o-1","client_order_id":")" + req.get_param_value("client_order_id") +
+                            R"(","symbol":"AAPL","status":"accepted"})",
+                        "application/json");
+    });
+    int port = server.bind_to_any_port("127.0.0.1");
+    ASSERT_GT(port, 0);
+    std::thread listener([&] { server.listen_after_bind(); });
+
+    Environment env;
+    OrderGateway gateway(env, "http://127.0.0.1:" + std::to_string(port));
+    OrderTemplate buy("AAPL", OrderSide::Buy, OrderType::Market, OrderTimeInForce::Day);
+    auto [status, order] = gateway.submit(buy, 1);
+    EXPECT_TRUE(status.ok()) << status.getMessage();
+    EXPECT_FALSE(sent_id.empty());
+    EXPECT_EQ(order.id, "o-1");
+    EXPECT_EQ(order.client_order_id, sent_id);
+    EXPECT_EQ(posts, 1);
+
+    server.stop();
+    listener.join();
+}
@@ -0,0 +1,184 @@
+#include <alpaca/markets/decimal.hpp>
+#include <alpaca/markets/order_request.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+using namespace alpaca::markets;
+
+namespace {
+
+Decimal dec(const char* text) {
+    return *Decimal::parse(text);
+}
+
+}  // namespace
+
+TEST(DecimalTest, ParseAndFormatRoundTrip) {
+    for (const char* text : {"0", "100", "187.25", "0.1", "0.000000001", "-42.5", "9000000000.123456789"}) {
+        std::optional<Decimal> value = Decimal::parse(text);
+        ASSERT_TRUE(value.has_value()) << text;
+        EXPECT_EQ(value->toString(), text);
+    }
+    EXPECT_EQ(dec("187.2500").toString(), "187.25");
+    EXPECT_EQ(dec("007").toString(), "7");
+    EXPECT_EQ(dec(".5").toString(), "0.5");
+    EXPECT_EQ(dec("0.1").units(), 100'000'000);
+    EXPECT_EQ(Decimal(3).units(), 3 * Decimal::kUnitsPerOne);
+    EXPECT_DOUBLE_EQ(dec("187.25").toDouble(), 187.25);
+}
+
+TEST(DecimalTest, ParseRejectsMalformedInput) {
+    for (const char* text : {"", "-", ".", "1.2.3", "1e5", "+1", "12a", " 1", "0.0000000001", "99999999999"}) {
+        EXPECT_FALSE(Decimal::parse(text).has_value()) << text;
+    }
+}
+
+TEST(DecimalTest, IntegerConversionsAreRangeChecked) {
+    static_assert(std::is_convertible_v<int, Decimal>);
+    static_assert(std::is_convertible_v<std::uint64_t, Decimal>);
+    static_assert(!std::is_constructible_v<Decimal, bool>);
+    static_assert(!std::is_constructible_v<Decimal, char>);
+    static_assert(!std::is_constructible_v<Decimal, char8_t>);
+    static_assert(!std::is_constructible_v<Decimal, double>);
+
+    constexpr Decimal lot = Decimal::of<1000>();
+    EXPECT_EQ(lot, Decimal(1000));
+    EXPECT_EQ(Decimal::checked(std::uint8_t{200}), Decimal(200));
+    EXPECT_EQ(Decimal::checked(Decimal::kMaxWhole)->units(), Decimal::kMaxWhole * Decimal::kUnitsPerOne);
+    EXPECT_EQ(Decimal::checked(-Decimal::kMaxWhole)->units(), -Decimal::kMaxWhole * Decimal::kUnitsPerOne);
+    EXPECT_FALSE(Decimal::checked(Decimal::kMaxWhole + 1).has_value());
+    EXPECT_FALSE(Decimal::checked(std::numeric_limits<std::int64_t>::min()).has_value());
+    EXPECT_FALSE(Decimal::checked(std::numeric_limits<std::uint64_t>::max()).has_value());
+}
+
+TEST(DecimalTest, Comparison) {
+    EXPECT_LT(dec("0.5"), Decimal(1));
+    EXPECT_EQ(dec("1.0"), Decimal(1));
+    EXPECT_TRUE(Decimal().isZero());
+    EXPECT_TRUE(dec("-0.01").isNegative());
+}
+
+TEST(OrderRequestTest, RenderLimitOrder) {
+    auto request = OrderRequest::limit("AAPL", dec("1.5"), OrderSide::Buy, dec("187.25"))
+                       .withTimeInForce(OrderTimeInForce::GoodUntilCanceled)
+                       .withClientOrderId("strategy-1-42");
+    std::string body;
+    ASSERT_TRUE(request.render(body).ok());
+    EXPECT_EQ(body,
+              R"({"symbol":"AAPL","qty":"1.5","side":"buy","type":"limit","time_in_force":"gtc",)"
+              R"("limit_price":"187.25","client_order_id":"strategy-1-42"})");
+}
+
+TEST(OrderRequestTest, RenderNotionalAndTrailingStop) {
+    std::string body;
+    ASSERT_TRUE(OrderRequest::notionalMarket("AAPL", dec("250.5"), OrderSide::Sell).render(body).ok());
+    EXPECT_EQ(body, R"({"symbol":"AAPL","notional":"250.5","side":"sell","type":"market","time_in_force":"day"})");
+
+    auto trailing = OrderRequest::trailingStopPercent("TSLA", 10, OrderSide::Sell, dec("2.5")).withExtendedHours();
+    ASSERT_TRUE(trailing.render(body).ok());
+    EXPECT_EQ(body,
+              R"({"symbol":"TSLA","qty":"10","side":"sell","type":"trailing_stop","time_in_force":"day",)"
+              R"("trail_percent":"2.5","extended_hours":true})");
+}
+
+TEST(OrderRequestTest, RenderBracket) {
+    auto request = OrderRequest::limit("AAPL", 100, OrderSide::Buy, dec("187.25")).bracket(195, 180, dec("179.5"));
+    std::string body;
+    ASSERT_TRUE(request.render(body).ok());
+    EXPECT_EQ(body,
+              R"({"symbol":"AAPL","qty":"100","side":"buy","type":"limit","time_in_force":"day",)"
+              R"("limit_price":"187.25","order_class":"bracket","take_profit":{"limit_price":"195"},)"
+              R"("stop_loss":{"stop_price":"180","limit_price":"179.5"}})");
+}
+
+TEST(OrderRequestTest, RenderMultiLeg) {
+    auto request = OrderRequest::multiLeg(
+        2,
+        {OrderLeg{"AAPL250620C00190000", 1, OrderSide::Buy, PositionIntent::BuyToOpen},
+         OrderLeg{"AAPL250620C00200000", 1, OrderSide::Sell, PositionIntent::SellToOpen}},
+        dec("1.25"));
+    std::string body;
+    ASSERT_TRUE(request.render(body).ok());
+    EXPECT_EQ(body,
+              R"({"qty":"2","type":"limit","time_in_force":"day","limit_price":"1.25","order_class":"mleg",)"
+              R"("legs":[{"symbol":"AAPL250620C00190000","ratio_qty":"1","side":"buy",)"
+              R"("position_intent":"buy_to_open"},)"
+              R"({"symbol":"AAPL250620C00200000","ratio_qty":"1","side":"sell","position_intent":"sell_to_open"}]})");
+}
+
+TEST(OrderRequestTest, RenderReusesBuffer) {
+    auto request = OrderRequest::limit("AAPL", 100, OrderSide::Buy, dec("187.25"));
+    std::string body;
+    body.reserve(512);
+    const char* data = body.data();
+    for (int quantity = 1; quantity < 1000; ++quantity) {
+        request.qty = quantity;
+        ASSERT_TRUE(request.render(body).ok());
+    }
+    EXPECT_EQ(body.data(), data);
+}
+
+TEST(OrderRequestTest, ValidateRejectsUnknownEnums) {
+    EXPECT_FALSE(OrderRequest::market("AAPL", 1, OrderSide::Unknown).validate().ok());
+    OrderRequest request = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+    ASSERT_TRUE(request.validate().ok());
+    request.type = OrderType::Unknown;
+    EXPECT_FALSE(request.validate().ok());
+    request.type = OrderType::Market;
+    request.tif = OrderTimeInForce::Unknown;
+    EXPECT_FALSE(request.validate().ok());
+    request.tif = OrderTimeInForce::Day;
+    request.order_class = OrderClass::Unknown;
+    EXPECT_FALSE(request.validate().ok());
+    std::string body;
+    EXPECT_FALSE(request.render(body).ok());
+}
+
+TEST(OrderRequestTest, ValidateRejectsIncompleteOrders) {
+    EXPECT_FALSE(OrderRequest::market("", 1, OrderSide::Buy).validate().ok());
+    EXPECT_FALSE(OrderRequest::market("AAPL", 0, OrderSide::Buy).validate().ok());
+    EXPECT_FALSE(OrderRequest::market("AAPL", -1, OrderSide::Buy).validate().ok());
+    EXPECT_FALSE(OrderRequest::market("A\"B", 1, OrderSide::Buy).validate().ok());
+    EXPECT_FALSE(OrderRequest::limit("AAPL", 1, OrderSide::Buy, Decimal()).validate().ok());
+    EXPECT_FALSE(OrderRequest::stop("AAPL", 1, OrderSide::Buy, Decimal()).validate().ok());
+    EXPECT_FALSE(OrderRequest::stopLimit("AAPL", 1, OrderSide::Buy, 10, Decimal()).validate().ok());
+
+    auto both = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+    both.notional = 100;
+    EXPECT_FALSE(both.validate().ok());
+
+    auto notional_stop = OrderRequest::notionalMarket("AAPL", 100, OrderSide::Buy);
+    notional_stop.type = OrderType::Stop;
+    notional_stop.stop_price = 10;
+    EXPECT_FALSE(notional_stop.validate().ok());
+
+    auto trailing = OrderRequest::trailingStopPrice("AAPL", 1, OrderSide::Sell, 2);
+    trailing.trail_percent = 1;
+    EXPECT_FALSE(trailing.validate().ok());
+
+    EXPECT_FALSE(
+        OrderRequest::market("AAPL", 1, OrderSide::Buy).withOrderClass(OrderClass::Bracket).withTakeProfit(195)
+            .validate()
+            .ok());
+    EXPECT_TRUE(
+        OrderRequest::market("AAPL", 1, OrderSide::Buy).withOrderClass(OrderClass::OneTriggersOther).withStopLoss(180)
+            .validate()
+            .ok());
+
+    EXPECT_FALSE(OrderRequest::multiLeg(1, {}).validate().ok());
+    OrderLeg leg;
+    leg.symbol = "AAPL250620C00190000";
+    auto legs_without_class = OrderRequest::multiLeg(1, {leg});
+    legs_without_class.order_class = OrderClass::Simple;
+    EXPECT_FALSE(legs_without_class.validate().ok());
+
+    auto market = OrderRequest::market("AAPL", 1, OrderSide::Buy);
+    EXPECT_FALSE(market.withClientOrderId(std::string(129, 'x')).validate().ok());
+    EXPECT_FALSE(market.withClientOrderId("bad\"id").validate().ok());
+    EXPECT_TRUE(market.withClientOrderId(std::string(128, 'x')).validate().ok());
+}
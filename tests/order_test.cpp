@@ -139,3 +139,47 @@ TEST(OrderTest, FromJSONWithNotional) {
     EXPECT_TRUE(status.ok());
     EXPECT_EQ(order.notional, "1000.00");
 }
+
+TEST(OrderCancelResultsTest, MultiStatusFromJSON) {
+    std::string json = R"([
+        {"id": "order-1", "status": 200, "body": {"id": "order-1", "symbol": "AAPL", "status": "pending_cancel",
+                                                  "qty": "10", "side": "buy", "type": "limit"}},
+        {"id": "order-2", "status": 500, "body": {"code": 50010000, "message": "internal server error"}},
+        {"id": "order-3", "status": 422, "body": "order is already in filled state"},
+        {"id": "order-4", "status": 200, "body": [4]},
+        "garbage"
+    ])";
+
+    OrderCancelResults cancels;
+    ASSERT_TRUE(cancels.fromJSON(std::move(json)).ok());
+    ASSERT_EQ(cancels.results.size(), 5u);
+
+    EXPECT_TRUE(cancels.results[0].status.ok());
+    EXPECT_EQ(cancels.results[0].id, "order-1");
+    EXPECT_EQ(cancels.results[0].http_status, 200);
+    EXPECT_EQ(cancels.results[0].order.symbol, "AAPL");
+
+    EXPECT_FALSE(cancels.results[1].status.ok());
+    EXPECT_EQ(cancels.results[1].http_status, 500);
+    EXPECT_NE(cancels.results[1].status.getMessage().find("internal server error"), std::string::npos);
+
+    EXPECT_FALSE(cancels.results[2].status.ok());
+    EXPECT_EQ(cancels.results[2].id, "order-3");
+    EXPECT_NE(cancels.results[2].status.getMessage().find("filled state"), std::string::npos);
+
+    EXPECT_FALSE(cancels.results[3].status.ok());
+    EXPECT_EQ(cancels.results[3].id, "order-4");
+
+    EXPECT_FALSE(cancels.results[4].status.ok());
+}
+
+TEST(OrderCancelResultsTest, PlainOrderArray) {
+    OrderCancelResults cancels;
+    ASSERT_TRUE(cancels.fromJSON(std::string(R"([{"id": "order-1", "symbol": "MSFT"}])")).ok());
+    ASSERT_EQ(cancels.results.size(), 1u);
+    EXPECT_TRUE(cancels.results[0].status.ok());
+    EXPECT_EQ(cancels.results[0].id, "order-1");
+    EXPECT_EQ(cancels.results[0].http_status, 200);
+
+    EXPECT_FALSE(cancels.fromJSON(std::string(R"({"id": "order-1"})")).ok());
+}
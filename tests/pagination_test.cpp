@@ -0,0 +1,329 @@
+#include <alpaca/markets/bars.hpp>
+#include <alpaca/markets/columns.hpp>
+#include <alpaca/markets/news.hpp>
+#include <alpaca/markets/pagination.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+// Serves `pages` pages of three ints each; tokens are the page index as a string.
+PageIterator<int>::FetchFunc makeFetch(int pages, std::atomic<int>& calls, int fail_page = -1,
+                                       std::atomic<int>* failures_left = nullptr) {
+    return [pages, &calls, fail_page, failures_left](const std::string& token) {
+        ++calls;
+        int index = token.empty() ? 0 : std::stoi(token);
+        if (index == fail_page && failures_left != nullptr && failures_left->fetch_sub(1) > 0) {
+            return std::make_pair(Status(1, "HTTP 500"), Page<int>{});
+        }
+        Page<int> page;
+        page.items = {index * 3, index * 3 + 1, index * 3 + 2};
+        if (index + 1 < pages) {
+            page.next_page_token = std::to_string(index + 1);
+        }
+        return std::make_pair(Status(), page);
+    };
+}
+
+std::vector<int> expectedItems(int pages) {
+    std::vector<int> items;
+    for (int i = 0; i < pages * 3; ++i) {
+        items.push_back(i);
+    }
+    return items;
+}
+
+// Serves two pages of bars for two symbols and two pages of news.
+struct FakeClient {
+    std::pair<Status, Bars> getBars(const std::vector<std::string>&, const std::string&, const std::string&,
+                                    const std::string&, unsigned int, const std::string& page_token) const {
+        Bars bars;
+        double base = page_token.empty() ? 0.0 : 10.0;
+        bars.bars["AAPL"] = {Bar{}, Bar{}};
+        bars.bars["AAPL"][0].close_price = base + 1;
+        bars.bars["AAPL"][1].close_price = base + 2;
+        bars.bars["MSFT"] = {Bar{}};
+        bars.bars["MSFT"][0].close_price = base + 3;
+        bars.next_page_token = page_token.empty() ? "page2" : "";
+        return std::make_pair(Status(), bars);
+    }
+
+    std::pair<Status, NewsArticles> getNews(const std::vector<std::string>&, const std::string&, const std::string&,
+                                            unsigned int, const std::string& page_token, bool, bool = false) const {
+        NewsArticles articles;
+        articles.news.resize(page_token.empty() ? 2 : 1);
+        articles.next_page_token = page_token.empty() ? "page2" : "";
+        return std::make_pair(Status(), articles);
+    }
+};
+
+}  // namespace
+
+TEST(PageIteratorTest, SequentialCollectAll) {
+    std::atomic<int> calls{0};
+    PageIterator<int> it(makeFetch(4, calls));
+    auto [status, items] = it.collectAll();
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ(items, expectedItems(4));
+    EXPECT_EQ(calls.load(), 4);
+    EXPECT_FALSE(it.hasMore());
+    EXPECT_FALSE(it.next().first.ok());
+}
+
+TEST(PageIteratorTest, PrefetchCollectAllMatchesSequential) {
+    for (std::size_t depth : {1u, 2u, 8u}) {
+        std::atomic<int> calls{0};
+        PageIterator<int> it(makeFetch(10, calls), depth);
+        auto [status, items] = it.collectAll();
+        EXPECT_TRUE(status.ok());
+        EXPECT_EQ(items, expectedItems(10));
+        EXPECT_EQ(calls.load(), 10);
+    }
+}
+
+TEST(PageIteratorTest, PrefetchFetchesAheadOfCaller) {
+    std::atomic<int> calls{0};
+    PageIterator<int> it(makeFetch(10, calls), 2);
+
+    auto [status, page] = it.next();
+    ASSERT_TRUE(status.ok());
+    EXPECT_EQ(page.items.front(), 0);
+
+    // The worker fills its buffer of two pages while the caller holds page 0
+    for (int i = 0; i < 500 && calls.load() < 3; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(calls.load(), 3);
+}
+
+TEST(PageIteratorTest, PrefetchErrorCanBeRetried) {
+    std::atomic<int> calls{0};
+    std::atomic<int> failures{1};
+    PageIterator<int> it(makeFetch(3, calls, 1, &failures), 2);
+
+    auto first = it.next();
+    ASSERT_TRUE(first.first.ok());
+    auto failed = it.next();
+    EXPECT_FALSE(failed.first.ok());
+    EXPECT_TRUE(it.hasMore());
+
+    auto [status, rest] = it.collectAll();
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ(rest, (std::vector<int>{3, 4, 5, 6, 7, 8}));
+}
+
+TEST(PageIteratorTest, PrefetchRethrowsFetchException) {
+    std::atomic<int> calls{0};
+    auto fetch = makeFetch(3, calls);
+    bool thrown = false;
+    PageIterator<int> it(
+        [&](const std::string& token) {
+            if (token == "1" && !thrown) {
+                thrown = true;
+                throw std::runtime_error("decoder exploded");
+            }
+            return fetch(token);
+        },
+        2);
+
+    auto first = it.next();
+    ASSERT_TRUE(first.first.ok());
+    EXPECT_THROW(it.next(), std::runtime_error);
+    EXPECT_TRUE(it.hasMore());
+
+    // The worker stopped at the throw; a retry resumes from the failed page
+    auto [status, rest] = it.collectAll();
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ(rest, (std::vector<int>{3, 4, 5, 6, 7, 8}));
+}
+
+TEST(PageIteratorTest, DestroyWhilePrefetching) {
+    std::atomic<int> calls{0};
+    {
+        PageIterator<int> it(makeFetch(1000, calls), 4);
+        ASSERT_TRUE(it.next().first.ok());
+    }
+    EXPECT_LE(calls.load(), 6);
+}
+
+TEST(PageIteratorTest, CopyResumesFromSamePosition) {
+    static_assert(std::is_copy_constructible_v<PageIterator<int>>);
+    std::atomic<int> calls{0};
+    for (std::size_t depth : {0u, 2u}) {
+        PageIterator<int> it(makeFetch(4, calls), depth);
+        ASSERT_TRUE(it.next().first.ok());
+
+        PageIterator<int> copy = it;
+        auto [status, rest] = copy.collectAll();
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(rest, std::vector<int>({3, 4, 5, 6, 7, 8, 9, 10, 11}));
+
+        // The original is unaffected by its copy
+        auto [original_status, original_rest] = it.collectAll();
+        ASSERT_TRUE(original_status.ok());
+        EXPECT_EQ(original_rest, rest);
+
+        copy = it;
+        EXPECT_FALSE(copy.hasMore());
+    }
+}
+
+static_assert(std::ranges::input_range<ItemRange<int>>);
+static_assert(std::ranges::view<ItemRange<int>>);
+
+TEST(ItemRangeTest, RangeForVisitsEveryItemAcrossPages) {
+    std::atomic<int> calls{0};
+    PageIterator<int> it(makeFetch(4, calls));
+    std::vector<int> seen;
+    auto range = it.items();
+    for (int item : range) {
+        seen.push_back(item);
+    }
+    EXPECT_TRUE(range.status().ok());
+    EXPECT_EQ(seen, expectedItems(4));
+}
+
+TEST(ItemRangeTest, ComposesWithViewsAndStopsEarly) {
+    std::atomic<int> calls{0};
+    PageIterator<int> it(makeFetch(100, calls));
+    std::vector<int> seen;
+    for (int item : it.items() | std::views::filter([](int i) { return i % 2 == 0; }) | std::views::take(3)) {
+        seen.push_back(item);
+    }
+    EXPECT_EQ(seen, (std::vector<int>{0, 2, 4}));
+    EXPECT_LE(calls.load(), 3);  // Stops paging once take() is satisfied
+}
+
+TEST(ItemRangeTest, SkipsEmptyPagesAndReportsErrors) {
+    int call = 0;
+    PageIterator<int> it([&call](const std::string&) {
+        ++call;
+        Page<int> page;
+        if (call == 1) {
+            page.next_page_token = "2";
+        } else if (call == 2) {
+            page.items = {7};
+            page.next_page_token = "3";
+        } else {
+            return std::make_pair(Status(1, "HTTP 500"), page);
+        }
+        return std::make_pair(Status(), page);
+    });
+    auto range = it.items();
+    std::vector<int> seen;
+    std::ranges::copy(range, std::back_inserter(seen));
+    EXPECT_EQ(seen, std::vector<int>{7});
+    EXPECT_FALSE(range.status().ok());
+}
+
+TEST(PaginationHelpersTest, BarsIteratorFlattensSymbols) {
+    FakeClient client;
+    auto bars = makeBarsIterator(client, {"AAPL", "MSFT"}, "2024-01-01", "2024-01-31");
+    std::vector<std::pair<std::string, double>> seen;
+    for (const auto& entry : bars.items()) {
+        seen.emplace_back(entry.symbol, entry.item.close_price);
+    }
+    std::vector<std::pair<std::string, double>> expected = {{"AAPL", 1}, {"AAPL", 2}, {"MSFT", 3},
+                                                            {"AAPL", 11}, {"AAPL", 12}, {"MSFT", 13}};
+    EXPECT_EQ(seen, expected);
+}
+
+TEST(PaginationHelpersTest, NewsIteratorCollectsAllPages) {
+    FakeClient client;
+    auto news = makeNewsIterator(client, {"AAPL"});
+    auto [status, articles] = news.collectAll();
+    EXPECT_TRUE(status.ok());
+    EXPECT_EQ(articles.size(), 3u);
+}
+
+namespace {
+
+// Counts copies so tests can check that pages are moved rather than copied.
+struct Tracked {
+    static inline int copies = 0;
+    int value = 0;
+    Tracked(int v = 0) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { ++copies; }
+    Tracked(Tracked&&) noexcept = default;
+    Tracked& operator=(const Tracked& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+    Tracked& operator=(Tracked&&) noexcept = default;
+};
+
+PageIterator<Tracked>::FetchFunc makeTrackedFetch(int pages) {
+    return [pages](const std::string& token) {
+        int index = token.empty() ? 0 : std::stoi(token);
+        Page<Tracked> page;
+        page.items = {Tracked(index * 2), Tracked(index * 2 + 1)};
+        if (index + 1 < pages) {
+            page.next_page_token = std::to_string(index + 1);
+        }
+        return std::make_pair(Status(), std::move(page));
+    };
+}
+
+struct VectorSink {
+    std::size_t reserved = 0;
+    std::vector<int> values;
+    void reserve(std::size_t n) { reserved = n; }
+    void append(std::vector<Tracked>&& items) {
+        for (auto& item : items) {
+            values.push_back(item.value);
+        }
+    }
+};
+
+}  // namespace
+
+TEST(PageIteratorTest, CollectAllMovesItems) {
+    PageIterator<Tracked> it(makeTrackedFetch(5));
+    int copies_before = Tracked::copies;
+    auto [status, items] = it.collectAll(10);
+    EXPECT_TRUE(status.ok());
+    ASSERT_EQ(items.size(), 10u);
+    EXPECT_EQ(items[9].value, 9);
+    EXPECT_GE(items.capacity(), 10u);
+    // Only the initializer lists in the fetch function copy
+    EXPECT_EQ(Tracked::copies - copies_before, 10);
+}
+
+TEST(PageIteratorTest, CollectIntoSink) {
+    PageIterator<Tracked> it(makeTrackedFetch(3));
+    VectorSink sink;
+    EXPECT_TRUE(it.collectInto(sink, 6).ok());
+    EXPECT_EQ(sink.reserved, 6u);
+    EXPECT_EQ(sink.values, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(PageIteratorTest, CollectIntoColumns) {
+    PageIterator<Bar> it([](const std::string& token) {
+        Page<Bar> page;
+        page.items.resize(2);
+        page.items[0].close_price = token.empty() ? 1.0 : 3.0;
+        page.items[1].close_price = token.empty() ? 2.0 : 4.0;
+        page.items[1].timestamp = "2024-01-02T00:00:00Z";
+        page.next_page_token = token.empty() ? "next" : "";
+        return std::make_pair(Status(), std::move(page));
+    });
+    BarColumns columns;
+    EXPECT_TRUE(it.collectInto(columns).ok());
+    ASSERT_EQ(columns.size(), 4u);
+    EXPECT_EQ(columns.close_prices, (std::vector<double>{1.0, 2.0, 3.0, 4.0}));
+    EXPECT_EQ(columns.timestamps[3], "2024-01-02T00:00:00Z");
+}
@@ -0,0 +1,261 @@
+#include <alpaca/markets/position_ledger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+Account makeAccount(const std::string& cash, const std::string& buying_power) {
+    Account account;
+    account.cash = cash;
+    account.buying_power = buying_power;
+    account.multiplier = "2";
+    return account;
+}
+
+Position makePosition(const std::string& symbol, const std::string& qty, const std::string& side,
+                      const std::string& avg_entry_price, const std::string& current_price) {
+    Position position;
+    position.symbol = symbol;
+    position.qty = qty;
+    position.side = side;
+    position.avg_entry_price = avg_entry_price;
+    position.current_price = current_price;
+    return position;
+}
+
+TradeUpdate makeFill(const std::string& symbol, const std::string& side, const std::string& qty,
+                     const std::string& price, const std::string& position_qty = "") {
+    TradeUpdate update;
+    update.event = "fill";
+    update.order.symbol = symbol;
+    update.order.side = side;
+    update.qty = qty;
+    update.price = price;
+    update.position_qty = position_qty;
+    return update;
+}
+
+}  // namespace
+
+TEST(PositionLedgerTest, ReconcileParsesRESTResults) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger
+                    .reconcile(makeAccount("10000", "20000"), {makePosition("AAPL", "100", "long", "150", "160"),
+                                                               makePosition("TSLA", "10", "short", "200", "190")})
+                    .ok());
+
+    auto snapshot = ledger.snapshot();
+    const LedgerPosition* aapl = snapshot->find("AAPL");
+    ASSERT_NE(aapl, nullptr);
+    EXPECT_DOUBLE_EQ(aapl->qty, 100);
+    EXPECT_DOUBLE_EQ(aapl->cost_basis, 15000);
+    EXPECT_DOUBLE_EQ(aapl->market_value, 16000);
+    EXPECT_DOUBLE_EQ(aapl->unrealized_pl, 1000);
+
+    EXPECT_DOUBLE_EQ(snapshot->qty("TSLA"), -10);
+    EXPECT_DOUBLE_EQ(snapshot->find("TSLA")->unrealized_pl, 100);
+    EXPECT_DOUBLE_EQ(snapshot->qty("MSFT"), 0);
+
+    EXPECT_DOUBLE_EQ(snapshot->account.long_market_value, 16000);
+    EXPECT_DOUBLE_EQ(snapshot->account.short_market_value, -1900);
+    EXPECT_DOUBLE_EQ(snapshot->account.equity, 10000 + 16000 - 1900);
+    EXPECT_DOUBLE_EQ(snapshot->account.buying_power, 20000);
+    EXPECT_DOUBLE_EQ(snapshot->account.multiplier, 2);
+}
+
+TEST(PositionLedgerTest, FillsAdjustAverageEntryAndCash) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", "20000"), {}).ok());
+
+    ASSERT_TRUE(ledger.applyFill(makeFill("AAPL", "buy", "10", "100")).ok());
+    ASSERT_TRUE(ledger.applyFill(makeFill("AAPL", "buy", "10", "110")).ok());
+    auto snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 20);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->avg_entry_price, 105);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 10000 - 1000 - 1100);
+    EXPECT_DOUBLE_EQ(snapshot->account.buying_power, 20000 - 2100);
+
+    ASSERT_TRUE(ledger.applyFill(makeFill("AAPL", "sell", "5", "120")).ok());
+    snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 15);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->avg_entry_price, 105);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->realized_pl, 75);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 10000 - 2100 + 600);
+}
+
+TEST(PositionLedgerTest, FillThroughZeroFlipsPosition) {
+    PositionLedger ledger;
+    ledger.applyFill("AAPL", 10, 100);
+    ledger.applyFill("AAPL", -15, 90);
+
+    auto snapshot = ledger.snapshot();
+    const LedgerPosition* aapl = snapshot->find("AAPL");
+    EXPECT_DOUBLE_EQ(aapl->qty, -5);
+    EXPECT_DOUBLE_EQ(aapl->avg_entry_price, 90);
+    EXPECT_DOUBLE_EQ(aapl->realized_pl, -100);
+
+    ledger.applyFill("AAPL", 5, 80);
+    snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 0);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->avg_entry_price, 0);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->realized_pl, -100 + 50);
+}
+
+TEST(PositionLedgerTest, PositionQtyFromEventWins) {
+    PositionLedger ledger;
+    ledger.applyFill("AAPL", 10, 100);
+    // A partial fill of 5 was missed; the event reports the true position
+    ASSERT_TRUE(ledger.applyFill(makeFill("AAPL", "buy", "5", "100", "20")).ok());
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->qty("AAPL"), 20);
+}
+
+TEST(PositionLedgerTest, IgnoresNonFillEventsAndRejectsBadFills) {
+    PositionLedger ledger;
+    TradeUpdate canceled = makeFill("AAPL", "buy", "10", "100");
+    canceled.event = "canceled";
+    EXPECT_TRUE(ledger.applyFill(canceled).ok());
+    EXPECT_EQ(ledger.snapshot()->find("AAPL"), nullptr);
+
+    EXPECT_FALSE(ledger.applyFill(makeFill("AAPL", "buy", "", "100")).ok());
+    EXPECT_FALSE(ledger.applyFill(makeFill("AAPL", "hold", "10", "100")).ok());
+}
+
+TEST(PositionLedgerTest, MarkToMarket) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("0", "0"), {makePosition("AAPL", "100", "long", "150", "150")}).ok());
+
+    SymbolMap<Quote> quotes;
+    Quote quote;
+    quote.bid_price = 159.9;
+    quote.ask_price = 160.1;
+    quotes["AAPL"] = quote;
+    quotes["MSFT"] = quote;
+    ledger.updatePrices(quotes);
+
+    auto snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->current_price, 160);
+    EXPECT_NEAR(snapshot->find("AAPL")->unrealized_pl, 1000, 1e-6);
+    EXPECT_EQ(snapshot->find("MSFT"), nullptr);
+    EXPECT_NEAR(snapshot->account.equity, 16000, 1e-6);
+
+    ledger.updatePrice("AAPL", 140);
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->find("AAPL")->unrealized_pl, -1000);
+}
+
+TEST(PositionLedgerTest, ReconcileKeepsRealizedPL) {
+    PositionLedger ledger;
+    ledger.applyFill("AAPL", 10, 100);
+    ledger.applyFill("AAPL", -5, 110);
+    ASSERT_TRUE(ledger.reconcile(makeAccount("0", "0"), {makePosition("AAPL", "5", "long", "100", "110")}).ok());
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->find("AAPL")->realized_pl, 50);
+}
+
+TEST(PositionLedgerTest, ReconcileReappliesFillsFromDuringTheFetch) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", "20000"), {makePosition("AAPL", "10", "long", "100", "100")})
+                    .ok());
+
+    auto token = ledger.beginReconcile();
+    // Fills arrive while the account and positions are being fetched
+    ASSERT_TRUE(ledger.applyFill(makeFill("AAPL", "sell", "5", "110", "5")).ok());
+    ASSERT_TRUE(ledger.applyFill(makeFill("MSFT", "buy", "2", "300")).ok());
+
+    // The REST results predate both fills
+    ASSERT_TRUE(ledger
+                    .reconcile(makeAccount("10000", "20000"), {makePosition("AAPL", "10", "long", "100", "100")},
+                               token)
+                    .ok());
+    auto snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 5);
+    EXPECT_DOUBLE_EQ(snapshot->find("AAPL")->realized_pl, 50);
+    EXPECT_DOUBLE_EQ(snapshot->qty("MSFT"), 2);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 10000 + 550 - 600);
+
+    // Fills before the token are not applied again
+    token = ledger.beginReconcile();
+    ASSERT_TRUE(ledger.reconcile(makeAccount("9950", "20000"), {makePosition("AAPL", "5", "long", "100", "110")},
+                                 token)
+                    .ok());
+    snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 5);
+    EXPECT_DOUBLE_EQ(snapshot->qty("MSFT"), 0);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 9950);
+}
+
+TEST(PositionLedgerTest, RedeliveredFillsAreBookedOnce) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", "20000"), {}).ok());
+
+    TradeUpdate fill = makeFill("AAPL", "buy", "10", "100");
+    fill.execution_id = "exec-1";
+    ASSERT_TRUE(ledger.applyFill(fill).ok());
+    ASSERT_TRUE(ledger.applyFill(fill).ok());
+
+    auto snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 10);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 9000);
+    EXPECT_DOUBLE_EQ(snapshot->account.buying_power, 19000);
+
+    fill.execution_id = "exec-2";
+    ASSERT_TRUE(ledger.applyFill(fill).ok());
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->qty("AAPL"), 20);
+}
+
+TEST(PositionLedgerTest, SnapshotsAreConsistent) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("100000", "100000"), {}).ok());
+
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                auto snapshot = ledger.snapshot();
+                // Every buy moves cash and position together
+                if (snapshot->account.cash + snapshot->qty("AAPL") * 10 != 100000) {
+                    ++inconsistent;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ledger.applyFill("AAPL", 1, 10);
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->qty("AAPL"), 1000);
+}
+
+TEST(PositionLedgerTest, RejectsMalformedNumbers) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", "20000"), {makePosition("AAPL", "100", "long", "150", "160")})
+                    .ok());
+
+    for (const char* qty : {"abc", "1O0", " 100", "inf", "nan", "0x10"}) {
+        Status status = ledger.reconcile(makeAccount("0", "0"), {makePosition("AAPL", qty, "long", "150", "160")});
+        EXPECT_FALSE(status.ok()) << qty;
+    }
+    EXPECT_FALSE(ledger.reconcile(makeAccount("lots", "0"), {}).ok());
+
+    // Failed updates leave the ledger as it was instead of booking zeros
+    auto snapshot = ledger.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot->qty("AAPL"), 100);
+    EXPECT_DOUBLE_EQ(snapshot->account.cash, 10000);
+    EXPECT_EQ(snapshot->version, 1u);
+
+    EXPECT_FALSE(ledger.applyFill(makeFill("AAPL", "buy", "10", "1OO")).ok());
+    EXPECT_FALSE(ledger.applyFill(makeFill("AAPL", "buy", "10", "100", "?")).ok());
+    EXPECT_DOUBLE_EQ(ledger.snapshot()->qty("AAPL"), 100);
+    EXPECT_EQ(ledger.snapshot()->version, 1u);
+}
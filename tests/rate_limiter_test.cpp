@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "detail/rate_limiter.hpp"
+
+using namespace alpaca::markets;
+using namespace std::chrono_literals;
+
+TEST(RateLimiterTest, AllowsBurstThenWaitsForWindow) {
+    detail::RateLimiter limiter(3, 100ms);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i) {
+        limiter.acquire();
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 50ms);
+
+    // The fourth request waits until the first has left the window
+    limiter.acquire();
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 100ms);
+}
+
+TEST(RateLimiterTest, LimitsAcrossThreads) {
+    detail::RateLimiter limiter(4, 100ms);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 3; ++i) {
+                limiter.acquire();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // 12 requests at 4 per window need two full windows after the first burst
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 200ms);
+}
@@ -0,0 +1,127 @@
+#include <alpaca/markets/config.hpp>
+#include <alpaca/markets/response_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(ResponseCacheTest, StoreAndLookup) {
+    ResponseCache cache(8);
+    EXPECT_FALSE(cache.lookup<std::string>("/v2/clock").value);
+
+    cache.store<std::string>("/v2/clock", "open", std::chrono::minutes(1), "\"v1\"");
+    auto hit = cache.lookup<std::string>("/v2/clock");
+    ASSERT_TRUE(hit.value);
+    EXPECT_TRUE(hit.fresh);
+    EXPECT_EQ(*hit.value, "open");
+    EXPECT_EQ(hit.etag, "\"v1\"");
+}
+
+TEST(ResponseCacheTest, LookupChecksType) {
+    ResponseCache cache(8);
+    cache.store<int>("/v2/clock", 1, std::chrono::minutes(1));
+    EXPECT_FALSE(cache.lookup<std::string>("/v2/clock").value);
+    EXPECT_TRUE(cache.lookup<int>("/v2/clock").value);
+}
+
+TEST(ResponseCacheTest, ExpiredEntriesKeepETagForRevalidation) {
+    ResponseCache cache(8);
+    cache.store<int>("/v2/assets/AAPL", 1, std::chrono::milliseconds(0), "\"abc\"");
+    cache.store<int>("/v2/assets/MSFT", 2, std::chrono::milliseconds(0));
+
+    auto stale = cache.lookup<int>("/v2/assets/AAPL");
+    ASSERT_TRUE(stale.value);
+    EXPECT_FALSE(stale.fresh);
+    EXPECT_EQ(stale.etag, "\"abc\"");
+
+    // Without an ETag an expired entry is useless and is dropped
+    EXPECT_FALSE(cache.lookup<int>("/v2/assets/MSFT").value);
+    EXPECT_EQ(cache.size(), 1u);
+
+    cache.renew("/v2/assets/AAPL", std::chrono::minutes(1));
+    EXPECT_TRUE(cache.lookup<int>("/v2/assets/AAPL").fresh);
+}
+
+TEST(ResponseCacheTest, EvictsLeastRecentlyUsed) {
+    ResponseCache cache(2);
+    cache.store<int>("a", 1, std::chrono::minutes(1));
+    cache.store<int>("b", 2, std::chrono::minutes(1));
+    cache.lookup<int>("a");
+    cache.store<int>("c", 3, std::chrono::minutes(1));
+
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.lookup<int>("a").value);
+    EXPECT_FALSE(cache.lookup<int>("b").value);
+    EXPECT_TRUE(cache.lookup<int>("c").value);
+}
+
+TEST(ResponseCacheTest, StoreReplacesExistingEntry) {
+    ResponseCache cache(2);
+    cache.store<int>("a", 1, std::chrono::minutes(1), "\"1\"");
+    cache.store<int>("a", 2, std::chrono::minutes(1), "\"2\"");
+    EXPECT_EQ(cache.size(), 1u);
+    auto hit = cache.lookup<int>("a");
+    EXPECT_EQ(*hit.value, 2);
+    EXPECT_EQ(hit.etag, "\"2\"");
+}
+
+TEST(ResponseCacheTest, InvalidateByPrefix) {
+    ResponseCache cache(8);
+    cache.store<int>("/v2/assets/AAPL", 1, std::chrono::minutes(1));
+    cache.store<int>("/v2/assets?status=active", 2, std::chrono::minutes(1));
+    cache.store<int>("/v2/clock", 3, std::chrono::minutes(1));
+
+    cache.invalidate("/v2/assets");
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_TRUE(cache.lookup<int>("/v2/clock").value);
+
+    cache.invalidate();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(ResponseCacheTest, ValuesOutliveEviction) {
+    ResponseCache cache(1);
+    cache.store<std::vector<int>>("a", {1, 2, 3}, std::chrono::minutes(1));
+    auto hit = cache.lookup<std::vector<int>>("a");
+    cache.store<int>("b", 1, std::chrono::minutes(1));
+    ASSERT_TRUE(hit.value);
+    EXPECT_EQ(hit.value->size(), 3u);
+}
+
+TEST(ResponseCacheTest, ConcurrentAccess) {
+    ResponseCache cache(16);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 1000; ++i) {
+                std::string key = std::to_string((i + t) % 32);
+                cache.store<int>(key, i, std::chrono::minutes(1));
+                cache.lookup<int>(key);
+                if (i % 100 == 0) {
+                    cache.invalidate(key);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(cache.size(), 16u);
+}
+
+TEST(ResponseCacheTest, CacheConfigDefaults) {
+    CacheConfig config;
+    EXPECT_FALSE(config.enabled);
+    EXPECT_TRUE(config.revalidate);
+    EXPECT_TRUE(CacheConfig::defaultEnabled().enabled);
+
+    Environment env;
+    EXPECT_FALSE(env.getCacheConfig().enabled);
+    env.setCacheConfig(CacheConfig::defaultEnabled());
+    EXPECT_TRUE(env.getCacheConfig().enabled);
+}
@@ -0,0 +1,239 @@
+#include <alpaca/markets/risk_checks.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace alpaca::markets;
+
+namespace {
+
+OrderIntent makeIntent(const std::string& symbol, OrderSide side, double qty, double limit_price = 0.0) {
+    OrderIntent intent;
+    intent.symbol = symbol;
+    intent.side = side;
+    intent.type = limit_price > 0 ? OrderType::Limit : OrderType::Market;
+    intent.qty = qty;
+    intent.limit_price = limit_price;
+    return intent;
+}
+
+Quote makeQuote(double bid, double ask) {
+    Quote quote;
+    quote.bid_price = bid;
+    quote.ask_price = ask;
+    return quote;
+}
+
+Asset makeAsset(const std::string& symbol, bool shortable, bool easy_to_borrow) {
+    Asset asset;
+    asset.symbol = symbol;
+    asset.tradable = true;
+    asset.shortable = shortable;
+    asset.easy_to_borrow = easy_to_borrow;
+    return asset;
+}
+
+Account makeAccount(const std::string& cash, int daytrade_count = 0) {
+    Account account;
+    account.cash = cash;
+    account.buying_power = cash;
+    account.daytrade_count = daytrade_count;
+    return account;
+}
+
+}  // namespace
+
+TEST(RiskChecksTest, EmptyPipelineAccepts) {
+    RiskChecks checks;
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 1e9)).ok());
+}
+
+TEST(RiskChecksTest, MaxNotionalUsesLimitThenQuote) {
+    RiskChecks checks;
+    checks.add("max_notional", risk::maxNotional(10000));
+
+    RiskContext context;
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 50, 150), context).ok());
+    Status status = checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 100, 150), context);
+    EXPECT_FALSE(status.ok());
+    EXPECT_NE(status.getMessage().find("Pre-trade check max_notional rejected order"), std::string::npos);
+
+    // Market orders are valued at the quote midpoint, and rejected if there is none
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 10), context).ok());
+    context.quote = makeQuote(99.9, 100.1);
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 99), context).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 101), context).ok());
+
+    OrderIntent notional = makeIntent("AAPL", OrderSide::Buy, 0);
+    notional.notional = 20000;
+    EXPECT_FALSE(checks.evaluate(notional, context).ok());
+}
+
+TEST(RiskChecksTest, MaxPositionCountsHeldShares) {
+    PositionLedger ledger;
+    ledger.applyFill("AAPL", 800, 100);
+    RiskChecks checks({.ledger = &ledger});
+    checks.add("max_position", risk::maxPosition(1000));
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 200)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 201)).ok());
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 1800)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 1801)).ok());
+}
+
+TEST(RiskChecksTest, PriceBandAgainstQuote) {
+    auto latest_quote = [](std::string_view symbol) -> std::optional<Quote> {
+        if (symbol == "AAPL") {
+            return makeQuote(99.5, 100.5);
+        }
+        return std::nullopt;
+    };
+    RiskChecks checks({.quote = latest_quote});
+    checks.add("price_band", risk::priceBand(0.05));
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 10, 104.9)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 10, 1049)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10, 94)).ok());
+    // No quote: nothing to compare against
+    EXPECT_TRUE(checks.evaluate(makeIntent("MSFT", OrderSide::Buy, 10, 1049)).ok());
+}
+
+TEST(RiskChecksTest, PatternDayTrader) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", 3), {}).ok());
+    ledger.applyFill("AAPL", 10, 100);
+    RiskChecks checks({.ledger = &ledger});
+    checks.add("pattern_day_trader", risk::patternDayTrader());
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 10)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+
+    ASSERT_TRUE(ledger.reconcile(makeAccount("30000", 3), {}).ok());
+    ledger.applyFill("AAPL", 10, 100);
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+}
+
+TEST(RiskChecksTest, PatternDayTraderLetsOvernightPositionsClose) {
+    PositionLedger ledger;
+    Position overnight;
+    overnight.symbol = "AAPL";
+    overnight.qty = "10";
+    overnight.avg_entry_price = "100";
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", 3), {overnight}).ok());
+    RiskChecks checks({.ledger = &ledger});
+    checks.add("pattern_day_trader", risk::patternDayTrader());
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+
+    // Adding to it today makes a sale a day trade, in the ledger or earlier in the batch
+    std::vector<OrderIntent> batch = {makeIntent("AAPL", OrderSide::Buy, 5)};
+    OrderIntent sell = makeIntent("AAPL", OrderSide::Sell, 10);
+    sell.batch = &batch;
+    EXPECT_FALSE(checks.evaluate(sell).ok());
+
+    ledger.applyFill("AAPL", 5, 101);
+    EXPECT_EQ(ledger.snapshot()->find("AAPL")->opened_qty, 5);
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+    // A reconcile keeps what was opened today
+    overnight.qty = "15";
+    ASSERT_TRUE(ledger.reconcile(makeAccount("10000", 3), {overnight}).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+
+    ledger.startTradingDay();
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+}
+
+TEST(RiskChecksTest, ShortableAndEasyToBorrow) {
+    PositionLedger ledger;
+    ledger.applyFill("GME", 10, 20);
+    AssetUniverse universe({makeAsset("AAPL", true, true), makeAsset("GME", true, false), makeAsset("OTC", false, false)});
+    RiskChecks checks({.ledger = &ledger, .assets = &universe});
+    checks.add("shortable", risk::shortable());
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10)).ok());
+    EXPECT_TRUE(checks.evaluate(makeIntent("GME", OrderSide::Sell, 10)).ok());  // Closes the long
+    EXPECT_FALSE(checks.evaluate(makeIntent("GME", OrderSide::Sell, 11)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("OTC", OrderSide::Sell, 1)).ok());
+    EXPECT_TRUE(checks.evaluate(makeIntent("OTC", OrderSide::Buy, 1)).ok());
+    EXPECT_TRUE(checks.evaluate(makeIntent("UNKNOWN", OrderSide::Sell, 1)).ok());
+}
+
+TEST(RiskChecksTest, ShortableSizesNotionalSells) {
+    PositionLedger ledger;
+    ledger.applyFill("AAPL", 10, 100);
+    AssetUniverse universe({makeAsset("AAPL", true, true), makeAsset("MSFT", true, true)});
+    RiskChecks checks({.ledger = &ledger, .assets = &universe});
+    checks.add("shortable", risk::shortable());
+
+    auto notionalSell = [](const std::string& symbol, double notional) {
+        OrderIntent intent = makeIntent(symbol, OrderSide::Sell, 0);
+        intent.notional = notional;
+        return intent;
+    };
+    // Valued at the ledger's mark of 100
+    EXPECT_TRUE(checks.evaluate(notionalSell("AAPL", 1000)).ok());
+    EXPECT_FALSE(checks.evaluate(notionalSell("AAPL", 1001)).ok());
+    // Shortable, but a notional order can't open a short
+    EXPECT_FALSE(checks.evaluate(notionalSell("MSFT", 100)).ok());
+}
+
+TEST(RiskChecksTest, BuyingPowerIgnoresClosingQuantity) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("1000"), {}).ok());
+    ledger.applyFill("AAPL", 5, 100);
+    RiskChecks checks({.ledger = &ledger});
+    checks.add("buying_power", risk::buyingPower());
+
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 5, 100)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 6, 100)).ok());
+    // Selling 10 closes 5 and opens a 5 share short
+    EXPECT_TRUE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 10, 100)).ok());
+    EXPECT_FALSE(checks.evaluate(makeIntent("AAPL", OrderSide::Sell, 11, 100)).ok());
+}
+
+TEST(RiskChecksTest, BatchCountsEarlierOrders) {
+    PositionLedger ledger;
+    ASSERT_TRUE(ledger.reconcile(makeAccount("1000"), {}).ok());
+    ledger.applyFill("AAPL", 5, 100);
+    RiskChecks checks({.ledger = &ledger});
+    checks.add("max_position", risk::maxPosition(10)).add("buying_power", risk::buyingPower());
+
+    // Alone, each order fits; after the earlier ones in the batch, the last does not
+    std::vector<OrderIntent> batch = {makeIntent("AAPL", OrderSide::Buy, 4, 100)};
+    OrderIntent next = makeIntent("AAPL", OrderSide::Buy, 2, 100);
+    EXPECT_TRUE(checks.evaluate(next).ok());
+    next.batch = &batch;
+    EXPECT_FALSE(checks.evaluate(next).ok());  // 11 shares, and 600 of the 500 left
+
+    batch = {makeIntent("MSFT", OrderSide::Buy, 2, 100)};
+    OrderIntent buy = makeIntent("AAPL", OrderSide::Buy, 4, 100);
+    EXPECT_TRUE(checks.evaluate(buy).ok());
+    buy.batch = &batch;
+    EXPECT_FALSE(checks.evaluate(buy).ok());  // 200 of the 500 left already used
+
+    // Closing part of a position earlier in the batch uses no buying power
+    batch = {makeIntent("AAPL", OrderSide::Sell, 5, 100)};
+    buy.batch = &batch;
+    EXPECT_TRUE(checks.evaluate(buy).ok());
+}
+
+TEST(RiskChecksTest, FirstFailureWins) {
+    int calls = 0;
+    RiskChecks checks;
+    checks.add("first", [&](const OrderIntent&, const RiskContext&) {
+        ++calls;
+        return Status(1, "no");
+    });
+    checks.add("second", [&](const OrderIntent&, const RiskContext&) {
+        ++calls;
+        return Status();
+    });
+    Status status = checks.evaluate(makeIntent("AAPL", OrderSide::Buy, 1));
+    EXPECT_EQ(status.getMessage(), "Pre-trade check first rejected order: no");
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(checks.size(), 2u);
+}
@@ -0,0 +1,266 @@
+// Differential tests for the simdjson backend: every input is decoded by the
+// simdjson decoders and by the RapidJSON field tables, and the two must agree.
+// Only built into the suite when ALPACA_MARKETS_JSON_BACKEND=simdjson.
+#ifdef ALPACA_MARKETS_USE_SIMDJSON
+
+#include <alpaca/markets/bars.hpp>
+#include <alpaca/markets/crypto.hpp>
+#include <alpaca/markets/multi_quote.hpp>
+#include <alpaca/markets/multi_trade.hpp>
+#include <alpaca/markets/snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "detail/decode.hpp"
+#include "detail/simdjson_decode.hpp"
+
+using namespace alpaca::markets;
+
+namespace {
+
+constexpr const char* kParseError = "parse error";
+
+void expectSame(const Trade& a, const Trade& b) {
+    EXPECT_EQ(a.price, b.price);
+    EXPECT_EQ(a.size, b.size);
+    EXPECT_EQ(a.exchange, b.exchange);
+    EXPECT_EQ(a.id, b.id);
+    EXPECT_EQ(a.timestamp, b.timestamp);
+    EXPECT_EQ(a.conditions, b.conditions);
+    EXPECT_EQ(a.tape, b.tape);
+}
+
+void expectSame(const Quote& a, const Quote& b) {
+    EXPECT_EQ(a.ask_price, b.ask_price);
+    EXPECT_EQ(a.ask_size, b.ask_size);
+    EXPECT_EQ(a.ask_exchange, b.ask_exchange);
+    EXPECT_EQ(a.bid_price, b.bid_price);
+    EXPECT_EQ(a.bid_size, b.bid_size);
+    EXPECT_EQ(a.bid_exchange, b.bid_exchange);
+    EXPECT_EQ(a.timestamp, b.timestamp);
+    EXPECT_EQ(a.conditions, b.conditions);
+}
+
+void expectSame(const Bar& a, const Bar& b) {
+    EXPECT_EQ(a.timestamp, b.timestamp);
+    EXPECT_EQ(a.open_price, b.open_price);
+    EXPECT_EQ(a.high_price, b.high_price);
+    EXPECT_EQ(a.low_price, b.low_price);
+    EXPECT_EQ(a.close_price, b.close_price);
+    EXPECT_EQ(a.volume, b.volume);
+    EXPECT_EQ(a.trade_count, b.trade_count);
+    EXPECT_EQ(a.vwap, b.vwap);
+}
+
+void expectSame(const CryptoTrade& a, const CryptoTrade& b) {
+    EXPECT_EQ(a.price, b.price);
+    EXPECT_EQ(a.size, b.size);
+    EXPECT_EQ(a.timestamp, b.timestamp);
+    EXPECT_EQ(a.id, b.id);
+    EXPECT_EQ(a.taker_side, b.taker_side);
+}
+
+void expectSame(const CryptoQuote& a, const CryptoQuote& b) {
+    EXPECT_EQ(a.ask_price, b.ask_price);
+    EXPECT_EQ(a.ask_size, b.ask_size);
+    EXPECT_EQ(a.bid_price, b.bid_price);
+    EXPECT_EQ(a.bid_size, b.bid_size);
+    EXPECT_EQ(a.timestamp, b.timestamp);
+}
+
+void expectSame(const CryptoBar& a, const CryptoBar& b) {
+    EXPECT_EQ(a.timestamp, b.timestamp);
+    EXPECT_EQ(a.open_price, b.open_price);
+    EXPECT_EQ(a.high_price, b.high_price);
+    EXPECT_EQ(a.low_price, b.low_price);
+    EXPECT_EQ(a.close_price, b.close_price);
+    EXPECT_EQ(a.volume, b.volume);
+    EXPECT_EQ(a.trade_count, b.trade_count);
+    EXPECT_EQ(a.vwap, b.vwap);
+}
+
+void expectSame(const Snapshot& a, const Snapshot& b) {
+    expectSame(a.latest_trade, b.latest_trade);
+    expectSame(a.latest_quote, b.latest_quote);
+    expectSame(a.minute_bar, b.minute_bar);
+    expectSame(a.daily_bar, b.daily_bar);
+    expectSame(a.prev_daily_bar, b.prev_daily_bar);
+}
+
+template <typename T>
+void expectSame(const std::vector<T>& a, const std::vector<T>& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        SCOPED_TRACE(i);
+        expectSame(a[i], b[i]);
+    }
+}
+
+template <typename V>
+void expectSame(const std::map<std::string, V>& a, const std::map<std::string, V>& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (auto ia = a.begin(), ib = b.begin(); ia != a.end(); ++ia, ++ib) {
+        SCOPED_TRACE(ia->first);
+        EXPECT_EQ(ia->first, ib->first);
+        expectSame(ia->second, ib->second);
+    }
+}
+
+template <typename T, typename Item>
+void expectSamePage(const T& a, const T& b, std::map<std::string, std::vector<Item>> T::*member) {
+    expectSame(a.*member, b.*member);
+    EXPECT_EQ(a.next_page_token, b.next_page_token);
+}
+
+/**
+ * @brief Decode json with both backends, through both simdjson overloads, and compare the results.
+ */
+template <typename T, typename Compare>
+void expectBackendsAgree(const std::string& json, Compare&& compare) {
+    SCOPED_TRACE(json);
+
+    T expected;
+    Status expected_status;
+    rapidjson::Document d;
+    if (d.Parse(json.c_str()).HasParseError()) {
+        expected_status = Status(1, kParseError);
+    } else {
+        expected_status = detail::decode(d, expected);
+    }
+
+    T copied;
+    Status copied_status = detail::simd::decodeJSON(json, copied, kParseError);
+    EXPECT_EQ(copied_status.ok(), expected_status.ok());
+    EXPECT_EQ(copied_status.getMessage(), expected_status.getMessage());
+
+    std::string buffer = json;
+    T in_place;
+    Status in_place_status = detail::simd::decodeJSON(buffer, in_place, kParseError);
+    EXPECT_EQ(in_place_status.ok(), expected_status.ok());
+    EXPECT_EQ(in_place_status.getMessage(), expected_status.getMessage());
+
+    if (expected_status.ok()) {
+        compare(expected, copied);
+        compare(expected, in_place);
+    }
+}
+
+// Inputs every backend must agree on, beyond the well-formed fixtures: fields
+// of the wrong type, unknown members, escapes, and malformed documents.
+const std::vector<std::string> kMalformed = {
+    "",
+    "[]",
+    "42",
+    "{",
+    R"({"next_page_token": "abc"} trailing)",
+    R"({"next_page_token": 7})",
+};
+
+}  // namespace
+
+TEST(SimdjsonDecodeTest, BarsMatchRapidJSON) {
+    std::vector<std::string> inputs = {
+        R"({"bars": {"AAPL": [{"t": "2023-01-01T09:30:00Z", "o": 150.25, "h": 152.0, "l": 149.5,
+            "c": 151.75, "v": 1000000, "n": 5000, "vw": 151.0}],
+            "GOOG": [{"t": "2023-01-01T09:30:00Z", "o": 2800, "v": 500000}, {"o": "bad", "v": -1, "x": {}}]},
+            "next_page_token": "QUFQTHwy"})",
+        R"({"bars": {}, "next_page_token": null})",
+        R"({"bars": {"AAPL": {"t": "not an array"}}, "unknown": [1, 2, {"a": null}]})",
+        R"({"bars": {"AAPL": [{"t": "2023-01-01T09:30:00\"Z\\"}]}})",
+        R"({"bars": "not an object"})",
+        R"({"bars": {"AAPL": [7]}})",
+    };
+    inputs.insert(inputs.end(), kMalformed.begin(), kMalformed.end());
+    for (const auto& json : inputs) {
+        expectBackendsAgree<Bars>(json, [](const Bars& a, const Bars& b) { expectSamePage(a, b, &Bars::bars); });
+    }
+}
+
+TEST(SimdjsonDecodeTest, MultiTradesMatchRapidJSON) {
+    std::vector<std::string> inputs = {
+        R"({"trades": {"AAPL": [{"t": "2021-02-06T13:04:56.334320128Z", "x": "C", "p": 387.62, "s": 100,
+            "c": ["@", "I"], "i": 52983525029461, "z": "C"}],
+            "MSFT": [{"p": 1, "s": 2.5, "c": ["@", 3, "T"], "i": 18446744073709551615}]},
+            "next_page_token": "TVNGVHwy"})",
+        R"({"trades": {"AAPL": []}, "next_page_token": null})",
+        R"({"trades": {"AAPL": [{"c": "not an array", "z": 1}]}})",
+    };
+    inputs.insert(inputs.end(), kMalformed.begin(), kMalformed.end());
+    for (const auto& json : inputs) {
+        expectBackendsAgree<MultiTrades>(
+            json, [](const MultiTrades& a, const MultiTrades& b) { expectSamePage(a, b, &MultiTrades::trades); });
+    }
+}
+
+TEST(SimdjsonDecodeTest, MultiQuotesMatchRapidJSON) {
+    std::vector<std::string> inputs = {
+        R"({"quotes": {"AAPL": [{"t": "2021-02-06T13:35:08.946977536Z", "ax": "C", "ap": 387.7, "as": 1,
+            "bx": "N", "bp": 387.67, "bs": 1, "c": ["R"]}]}, "next_page_token": null})",
+        R"({"quotes": {"AAPL": [{"ap": "387.7", "as": -1, "c": []}], "TSLA": []}})",
+    };
+    inputs.insert(inputs.end(), kMalformed.begin(), kMalformed.end());
+    for (const auto& json : inputs) {
+        expectBackendsAgree<MultiQuotes>(
+            json, [](const MultiQuotes& a, const MultiQuotes& b) { expectSamePage(a, b, &MultiQuotes::quotes); });
+    }
+}
+
+TEST(SimdjsonDecodeTest, CryptoMatchRapidJSON) {
+    std::vector<std::string> trades = {
+        R"({"trades": {"BTC/USD": [{"t": "2024-01-01T00:00:00Z", "p": 42000.5, "s": 1, "i": 123, "tks": "B"},
+            {"p": "x", "tks": 1}]}, "next_page_token": "abc"})",
+    };
+    std::vector<std::string> quotes = {
+        R"({"quotes": {"BTC/USD": [{"t": "2024-01-01T00:00:00Z", "ap": 42001.0, "as": 0.25, "bp": 41999.0,
+            "bs": 1.5}]}})",
+    };
+    std::vector<std::string> bars = {
+        R"({"bars": {"ETH/USD": [{"t": "2024-01-01T00:00:00Z", "o": 2300.1, "h": 2310, "l": 2290, "c": 2305,
+            "v": 12.5, "n": 42, "vw": 2301.7}]}, "next_page_token": null})",
+    };
+    trades.insert(trades.end(), kMalformed.begin(), kMalformed.end());
+    quotes.insert(quotes.end(), kMalformed.begin(), kMalformed.end());
+    bars.insert(bars.end(), kMalformed.begin(), kMalformed.end());
+
+    for (const auto& json : trades) {
+        expectBackendsAgree<CryptoTrades>(
+            json, [](const CryptoTrades& a, const CryptoTrades& b) { expectSamePage(a, b, &CryptoTrades::trades); });
+    }
+    for (const auto& json : quotes) {
+        expectBackendsAgree<CryptoQuotes>(
+            json, [](const CryptoQuotes& a, const CryptoQuotes& b) { expectSamePage(a, b, &CryptoQuotes::quotes); });
+    }
+    for (const auto& json : bars) {
+        expectBackendsAgree<CryptoBars>(
+            json, [](const CryptoBars& a, const CryptoBars& b) { expectSamePage(a, b, &CryptoBars::bars); });
+    }
+}
+
+TEST(SimdjsonDecodeTest, SnapshotsMatchRapidJSON) {
+    std::vector<std::string> inputs = {
+        R"({"snapshots": {"AAPL": {
+            "latestTrade": {"t": "2021-05-11T20:00:00.435997104Z", "x": "Q", "p": 125.91, "s": 5589631,
+                "c": ["@", "M"], "i": 179430, "z": "C"},
+            "latestQuote": {"t": "2021-05-11T22:05:02.307304704Z", "ax": "P", "ap": 125.68, "as": 12,
+                "bx": "P", "bp": 125.6, "bs": 4, "c": ["R"]},
+            "minuteBar": {"t": "2021-05-11T22:02:00Z", "o": 125.66, "h": 125.66, "l": 125.66, "c": 125.66,
+                "v": 396},
+            "dailyBar": {"t": "2021-05-11T04:00:00Z", "o": 123.5, "v": 125863164, "n": 1, "vw": 125.2},
+            "prevDailyBar": null},
+            "MSFT": {"latestTrade": "not an object", "minuteBar": {"v": 1.5}}}})",
+        R"({"snapshots": {}})",
+        R"({"snapshots": null})",
+        R"({"snapshots": {"AAPL": 1}})",
+    };
+    inputs.insert(inputs.end(), kMalformed.begin(), kMalformed.end());
+    for (const auto& json : inputs) {
+        expectBackendsAgree<Snapshots>(
+            json, [](const Snapshots& a, const Snapshots& b) { expectSame(a.snapshots, b.snapshots); });
+    }
+}
+
+#endif  // ALPACA_MARKETS_USE_SIMDJSON
@@ -0,0 +1,125 @@
+#include <alpaca/markets/config.hpp>
+#include <alpaca/markets/single_flight.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(SingleFlightTest, SequentialCallsEachRun) {
+    SingleFlight<int> flights;
+    int calls = 0;
+    bool shared = true;
+    EXPECT_EQ(flights.run("key", [&] { return ++calls; }, &shared), 1);
+    EXPECT_FALSE(shared);
+    EXPECT_EQ(flights.run("key", [&] { return ++calls; }), 2);
+    EXPECT_EQ(flights.inFlight(), 0u);
+}
+
+TEST(SingleFlightTest, ConcurrentCallsShareOneResult) {
+    SingleFlight<std::string> flights;
+    std::atomic<int> calls{0};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::thread leader([&] {
+        flights.run("GET /v2/clock", [&] {
+            ++calls;
+            released.wait();
+            return std::string("open");
+        });
+    });
+    while (flights.inFlight() == 0) {
+        std::this_thread::yield();
+    }
+
+    std::vector<std::future<std::pair<std::string, bool>>> waiters;
+    for (int i = 0; i < 8; ++i) {
+        waiters.push_back(std::async(std::launch::async, [&] {
+            bool shared = false;
+            std::string value = flights.run("GET /v2/clock", [&] {
+                ++calls;
+                return std::string("closed");
+            }, &shared);
+            return std::make_pair(value, shared);
+        }));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    release.set_value();
+    leader.join();
+
+    int shared_count = 0;
+    for (auto& waiter : waiters) {
+        auto [value, shared] = waiter.get();
+        // A waiter that arrived after the leader finished runs its own call
+        if (shared) {
+            EXPECT_EQ(value, "open");
+            ++shared_count;
+        }
+    }
+    EXPECT_EQ(calls.load(), 1 + 8 - shared_count);
+    EXPECT_EQ(flights.inFlight(), 0u);
+}
+
+TEST(SingleFlightTest, DistinctKeysDoNotShare) {
+    SingleFlight<int> flights;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto first = std::async(std::launch::async, [&] {
+        return flights.run("a", [&] {
+            released.wait();
+            return 1;
+        });
+    });
+    while (flights.inFlight() == 0) {
+        std::this_thread::yield();
+    }
+    bool shared = true;
+    EXPECT_EQ(flights.run("b", [] { return 2; }, &shared), 2);
+    EXPECT_FALSE(shared);
+    release.set_value();
+    EXPECT_EQ(first.get(), 1);
+}
+
+TEST(SingleFlightTest, ExceptionsReachEveryWaiter) {
+    SingleFlight<int> flights;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto leader = std::async(std::launch::async, [&] {
+        return flights.run("key", [&]() -> int {
+            released.wait();
+            throw std::runtime_error("failed");
+        });
+    });
+    while (flights.inFlight() == 0) {
+        std::this_thread::yield();
+    }
+    auto waiter = std::async(std::launch::async, [&] { return flights.run("key", [] { return 0; }); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    release.set_value();
+
+    EXPECT_THROW(leader.get(), std::runtime_error);
+    // The waiter either shared the failure or started after it and ran its own call
+    try {
+        EXPECT_EQ(waiter.get(), 0);
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "failed");
+    }
+    EXPECT_EQ(flights.inFlight(), 0u);
+}
+
+TEST(SingleFlightTest, CoalescingIsOptIn) {
+    Environment env;
+    EXPECT_FALSE(env.getRequestCoalescing());
+    env.setRequestCoalescing(true);
+    EXPECT_TRUE(env.getRequestCoalescing());
+}
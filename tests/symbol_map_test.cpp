@@ -0,0 +1,67 @@
+#include <alpaca/markets/symbol_map.hpp>
+#include <alpaca/markets/trade.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(SymbolMapTest, SortsEntriesOnConstruction) {
+    std::vector<SymbolMap<int>::value_type> entries = {{"MSFT", 2}, {"AAPL", 1}, {"TSLA", 3}};
+    SymbolMap<int> map(std::move(entries));
+
+    ASSERT_EQ(map.size(), 3u);
+    std::vector<std::string> symbols;
+    for (const auto& [symbol, value] : map) {
+        symbols.push_back(symbol);
+    }
+    EXPECT_EQ(symbols, (std::vector<std::string>{"AAPL", "MSFT", "TSLA"}));
+}
+
+TEST(SymbolMapTest, DuplicateSymbolsKeepLastEntry) {
+    SymbolMap<int> map({{"AAPL", 1}, {"MSFT", 2}, {"AAPL", 3}});
+    ASSERT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.at("AAPL"), 3);
+    EXPECT_EQ(map.at("MSFT"), 2);
+}
+
+TEST(SymbolMapTest, Lookup) {
+    SymbolMap<Trade> trades({{"AAPL", Trade{}}, {"MSFT", Trade{}}});
+    trades.at("AAPL").price = 187.5;
+
+    auto it = trades.find("AAPL");
+    ASSERT_NE(it, trades.end());
+    EXPECT_DOUBLE_EQ(it->second.price, 187.5);
+    EXPECT_EQ(trades.find("TSLA"), trades.end());
+    EXPECT_TRUE(trades.contains("MSFT"));
+    EXPECT_EQ(trades.count("TSLA"), 0u);
+    EXPECT_THROW(trades.at("TSLA"), std::out_of_range);
+}
+
+TEST(SymbolMapTest, SubscriptInsertsInOrder) {
+    SymbolMap<int> map;
+    map["MSFT"] = 2;
+    map["AAPL"] = 1;
+    map["MSFT"] += 10;
+
+    ASSERT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.begin()->first, "AAPL");
+    EXPECT_EQ(map.at("MSFT"), 12);
+}
+
+TEST(SymbolMapTest, ConvertsToStdMap) {
+    SymbolMap<int> map({{"MSFT", 2}, {"AAPL", 1}});
+
+    std::map<std::string, int> copied = map;
+    EXPECT_EQ(copied.size(), 2u);
+    EXPECT_EQ(copied.at("AAPL"), 1);
+    EXPECT_EQ(map.size(), 2u);
+
+    std::pair<int, SymbolMap<int>> result{0, std::move(map)};
+    std::map<std::string, int> moved = std::move(result).second;
+    EXPECT_EQ(moved.at("MSFT"), 2);
+}
@@ -0,0 +1,91 @@
+#include <alpaca/markets/bars.hpp>
+#include <alpaca/markets/symbol.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace alpaca::markets;
+
+TEST(SymbolTest, InternAssignsDenseIds) {
+    SymbolTable table;
+    EXPECT_EQ(table.intern("AAPL"), 0u);
+    EXPECT_EQ(table.intern("MSFT"), 1u);
+    EXPECT_EQ(table.intern("AAPL"), 0u);
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.name(1), "MSFT");
+}
+
+TEST(SymbolTest, UnknownSymbolsAndIds) {
+    SymbolTable table;
+    table.intern("AAPL");
+    EXPECT_EQ(table.find("TSLA"), kInvalidSymbolId);
+    EXPECT_EQ(table.find("AAPL"), 0u);
+    EXPECT_TRUE(table.name(5).empty());
+    EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(SymbolTest, GlobalTable) {
+    SymbolId id = internSymbol("SYMBOL_TEST_GLOBAL");
+    EXPECT_EQ(symbolName(id), "SYMBOL_TEST_GLOBAL");
+    EXPECT_EQ(SymbolTable::global().find("SYMBOL_TEST_GLOBAL"), id);
+}
+
+TEST(SymbolTest, ConcurrentInterning) {
+    SymbolTable table;
+    constexpr int kThreads = 4;
+    constexpr int kSymbols = 1000;
+    std::vector<std::vector<SymbolId>> ids(kThreads, std::vector<SymbolId>(kSymbols));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kSymbols; ++i) {
+                ids[t][i] = table.intern("SYM" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(table.size(), static_cast<std::size_t>(kSymbols));
+    for (int i = 0; i < kSymbols; ++i) {
+        for (int t = 1; t < kThreads; ++t) {
+            EXPECT_EQ(ids[t][i], ids[0][i]);
+        }
+        EXPECT_EQ(table.name(ids[0][i]), "SYM" + std::to_string(i));
+    }
+}
+
+TEST(SymbolTest, IndexBySymbol) {
+    SymbolTable table;
+    table.intern("MSFT");
+
+    Bars bars;
+    bars.bars["AAPL"].resize(2);
+    bars.bars["MSFT"].resize(3);
+
+    auto indexed = indexBySymbol(std::move(bars.bars), table);
+    ASSERT_EQ(indexed.size(), 2u);
+    EXPECT_EQ(indexed[0].first, table.find("MSFT"));
+    EXPECT_EQ(indexed[0].second.size(), 3u);
+    EXPECT_EQ(indexed[1].first, table.find("AAPL"));
+    EXPECT_EQ(indexed[1].second.size(), 2u);
+}
+
+TEST(SymbolTest, IndexBySymbolMap) {
+    SymbolTable table;
+    table.intern("MSFT");
+
+    SymbolMap<Bar> bars({{"AAPL", Bar{}}, {"MSFT", Bar{}}});
+    bars.at("MSFT").volume = 7;
+
+    auto indexed = indexBySymbol(std::move(bars), table);
+    ASSERT_EQ(indexed.size(), 2u);
+    EXPECT_EQ(indexed[0].first, table.find("MSFT"));
+    EXPECT_EQ(indexed[0].second.volume, 7u);
+    EXPECT_EQ(indexed[1].first, table.find("AAPL"));
+    EXPECT_TRUE(bars.empty());
+}
@@ -60,3 +60,17 @@ TEST(TradeTest, FromJSONParseError) {
     Status status = trade.fromJSON("invalid json");
     EXPECT_FALSE(status.ok());
 }
+
+TEST(TradeTest, FromJSONInsitu) {
+    std::string json = R"({"p": 150.50, "s": 100, "x": "V", "i": 123456789, "t": "2023-01-01T10:00:00Z", "c": ["@"]})";
+
+    Trade trade;
+    Status status = trade.fromJSON(std::move(json));
+
+    EXPECT_TRUE(status.ok());
+    EXPECT_DOUBLE_EQ(trade.price, 150.50);
+    EXPECT_EQ(trade.exchange, "V");
+    EXPECT_EQ(trade.timestamp, "2023-01-01T10:00:00Z");
+    ASSERT_EQ(trade.conditions.size(), 1u);
+    EXPECT_EQ(trade.conditions[0], "@");
+}